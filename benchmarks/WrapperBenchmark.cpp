@@ -0,0 +1,217 @@
+/**
+ * Cost of the C wrappers against the C++ virtual calls they forward to.
+ *
+ * Each thunk is timed next to the direct call on the same stand-in
+ * object, over a simulation of a realistic size, and reported in
+ * nanoseconds and heap allocations per call. The best of several
+ * repetitions is kept. Built with CW_HEADER_ONLY, the same calls go
+ * through the inline thunks of Smp-C/Inline.h instead of the library.
+ */
+#include "Simulator.h"
+#include "Smp-C/AnySimple.h"
+#include "Smp-C/IField.h"
+#include "Smp-C/IOperation.h"
+#include "Smp-C/ISimpleArrayField.h"
+#include "Smp-C/ISimpleField.h"
+#include "Smp-C/Services/IScheduler.h"
+#include "Smp-C/Services/ITimeKeeper.h"
+#include "Smp-C/TypedArrayField.h"
+#include "Smp-C/Inline.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace {
+
+std::atomic<std::uint64_t> allocationCount{0u};
+
+void *Allocate(std::size_t size) {
+    allocationCount.fetch_add(1u, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size != 0u ? size : 1u)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+} /* namespace */
+
+void *operator new(std::size_t size) {
+    return Allocate(size);
+}
+
+void *operator new[](std::size_t size) {
+    return Allocate(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    allocationCount.fetch_add(1u, std::memory_order_relaxed);
+    return std::malloc(size != 0u ? size : 1u);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    allocationCount.fetch_add(1u, std::memory_order_relaxed);
+    return std::malloc(size != 0u ? size : 1u);
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+
+using CWraPPer::StandIn::Model;
+using CWraPPer::StandIn::Simulator;
+
+const int repetitions = 7;
+
+/* Keeps the results alive without the cost of a volatile access per call */
+template <typename T>
+void Consume(const T &value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+struct Result {
+    double nanoseconds;
+    double allocations;
+};
+
+/* Best of the repetitions of iterations calls of call; reset runs untimed after each repetition */
+template <typename Call, typename Reset>
+Result Measure(std::uint64_t iterations, Call call, Reset reset) {
+    Result best = {1e300, 0.0};
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+        const std::uint64_t allocations = allocationCount.load(std::memory_order_relaxed);
+        const auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0u; i < iterations; ++i) {
+            call(i);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        const double nanoseconds =
+            std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+        if (nanoseconds < best.nanoseconds) {
+            best.nanoseconds = nanoseconds;
+            best.allocations = static_cast<double>(allocationCount.load(std::memory_order_relaxed) - allocations)
+                / static_cast<double>(iterations);
+        }
+        reset();
+    }
+    return best;
+}
+
+template <typename Call>
+Result Measure(std::uint64_t iterations, Call call) {
+    return Measure(iterations, call, [] {});
+}
+
+void Report(const char *name, const Result &wrapper, const Result &direct) {
+    std::printf("%-40s %10.2f %10.2f %10.2f %12.3f %12.3f\n", name, wrapper.nanoseconds, direct.nanoseconds,
+        wrapper.nanoseconds - direct.nanoseconds, wrapper.allocations, direct.allocations);
+}
+
+} /* namespace */
+
+int main(int argc, char **argv) {
+    const std::uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000u;
+    const Smp::UInt64 arraySize = 64u;
+    Simulator simulator;
+    simulator.Populate(2000u, 10u, 1u, arraySize);
+    simulator.Connect();
+    Model *model = simulator.GetModels()[1000];
+    Smp::IField *field = model->GetField("F0");
+    Smp::ISimpleField *simpleField = dynamic_cast<Smp::ISimpleField *>(field);
+    Smp::ISimpleArrayField *arrayField = dynamic_cast<Smp::ISimpleArrayField *>(model->GetField("A0"));
+    Smp::Services::IScheduler *scheduler = simulator.GetScheduler();
+    Smp::Services::ITimeKeeper *timeKeeper = simulator.GetTimeKeeper();
+    Smp::IEntryPoint *entryPoint = model->GetStep();
+    Smp::IOperation *operation = model->GetSum();
+    Smp::IRequest *request = operation->CreateRequest();
+    request->SetParameterValue(0, Smp::AnySimple(Smp::PrimitiveTypeKind::PTK_Float64, 1.5));
+    request->SetParameterValue(1, Smp::AnySimple(Smp::PrimitiveTypeKind::PTK_Float64, 2.5));
+    /* Immediate events pile up in the scheduler: run them between repetitions */
+    const auto drainScheduler = [&simulator] {
+        simulator.GetStandInScheduler()->Advance(simulator.GetTimeKeeper()->GetSimulationTime());
+    };
+
+    std::printf("%-40s %10s %10s %10s %12s %12s\n", "call (ns/op, allocations/op)", "wrapper", "direct", "overhead",
+        "wrapper", "direct");
+
+    Report("IField_GetView",
+        Measure(iterations, [field](std::uint64_t) { Consume(root_Smp_IField_GetView(field)); }),
+        Measure(iterations, [field](std::uint64_t) { Consume(field->GetView()); }));
+
+    const root_Smp_PrimitiveTypeKind float64Kind =
+        static_cast<root_Smp_PrimitiveTypeKind>(Smp::PrimitiveTypeKind::PTK_Float64);
+    root_Smp_AnySimple value;
+    root_Smp_AnySimple_Construct(&value);
+    Report("ISimpleField_SetValue",
+        Measure(iterations, [simpleField, &value, float64Kind](std::uint64_t i) {
+            root_Smp_AnySimple_SetValueFloat64(&value, float64Kind, static_cast<double>(i));
+            root_Smp_ISimpleField_SetValue(simpleField, &value);
+        }),
+        Measure(iterations, [simpleField](std::uint64_t i) {
+            simpleField->SetValue(Smp::AnySimple(Smp::PrimitiveTypeKind::PTK_Float64, static_cast<double>(i)));
+        }));
+    root_Smp_AnySimple__AnySimple(&value);
+
+    Report("IScheduler_AddImmediateEvent",
+        Measure(iterations, [scheduler, entryPoint](std::uint64_t) {
+            Consume(root_Smp_Services_IScheduler_AddImmediateEvent(scheduler, entryPoint));
+        }, drainScheduler),
+        Measure(iterations, [scheduler, entryPoint](std::uint64_t) {
+            Consume(scheduler->AddImmediateEvent(entryPoint));
+        }, drainScheduler));
+
+    Report("ITimeKeeper_GetSimulationTime",
+        Measure(iterations, [timeKeeper](std::uint64_t) {
+            Consume(root_Smp_Services_ITimeKeeper_GetSimulationTime(timeKeeper));
+        }),
+        Measure(iterations, [timeKeeper](std::uint64_t) { Consume(timeKeeper->GetSimulationTime()); }));
+
+    std::vector<root_Smp_AnySimple> values(arraySize);
+    root_Smp_AnySimple_ConstructArray(values.data(), arraySize);
+    std::vector<Smp::AnySimple> directValues(arraySize);
+    Report("ISimpleArrayField_GetValues (64)",
+        Measure(iterations, [arrayField, &values, arraySize](std::uint64_t) {
+            root_Smp_ISimpleArrayField_GetValues(arrayField, arraySize, values.data(), 0u);
+            Consume(values[0]);
+        }),
+        Measure(iterations, [arrayField, &directValues, arraySize](std::uint64_t) {
+            arrayField->GetValues(arraySize, directValues.data(), 0u);
+            Consume(directValues[0]);
+        }));
+    root_Smp_AnySimple_DestructArray(values.data(), arraySize);
+
+    /* Both sides copy the items straight out of the stand-in field, through its TypedArrayField */
+    std::vector<double> doubles(arraySize);
+    Report("ISimpleArrayField_GetValuesFloat64 (64)",
+        Measure(iterations, [arrayField, &doubles, arraySize](std::uint64_t) {
+            root_Smp_ISimpleArrayField_GetValuesFloat64(arrayField, arraySize, doubles.data(), 0u);
+            Consume(doubles[0]);
+        }),
+        Measure(iterations, [arrayField, &doubles, arraySize](std::uint64_t) {
+            dynamic_cast<CWraPPer::TypedArrayField *>(arrayField)->GetItems(arraySize, doubles.data(), 0u);
+            Consume(doubles[0]);
+        }));
+
+    Report("IOperation_Invoke",
+        Measure(iterations, [operation, request](std::uint64_t) { root_Smp_IOperation_Invoke(operation, request); }),
+        Measure(iterations, [operation, request](std::uint64_t) { operation->Invoke(request); }));
+    operation->DeleteRequest(request);
+    return 0;
+}
@@ -27,7 +27,11 @@ extern "C" {
 #endif /* CW_root_Smp */
 #define CW_SPACE CW_root_Smp
 
-typedef void CW(AnySimple);
+/* Opaque storage for a Smp::AnySimple: construct before use, destruct after */
+typedef union {
+    CW(UInt8) _storage[16];
+    CW(Int64) _alignment;
+} CW(AnySimple);
 
 #undef CW_SPACE
 
@@ -38,6 +42,11 @@ typedef void CW(AnySimple);
 #endif /* CW_root_Smp_AnySimple */
 #define CW_SPACE CW_root_Smp_AnySimple
 
+enum {
+    CW(Size) = sizeof(CW(CW_root_Smp, AnySimple)),
+    CW(Alignment) = 8
+};
+
 /* Error while processing function "AnySimple" at Smp/./AnySimple.h:34:9 (exported to Smp-C/AnySimple.h) : Skipping constructor */
 
 /* Error while processing function "AnySimple" at Smp/./AnySimple.h:38:18 (exported to Smp-C/AnySimple.h) : Skipping constructor */
@@ -52,13 +61,40 @@ typedef void CW(AnySimple);
 
 /* Error while processing function "operator=" at Smp/./AnySimple.h:69:20 (exported to Smp-C/AnySimple.h) : Reference type is not supported: AnySimple & */
 
-void
+CW_THUNK void
+CW(Construct)
+(
+    CW(CW_root_Smp, AnySimple) * memory
+);
+
+CW_THUNK void
+CW(ConstructCopy)
+(
+    CW(CW_root_Smp, AnySimple) * memory,
+    const CW(CW_root_Smp, AnySimple) * other
+);
+
+CW_THUNK void
+CW(ConstructArray)
+(
+    CW(CW_root_Smp, AnySimple) * memory,
+    CW(CW_root_Smp, UInt64) length
+);
+
+CW_THUNK void
+CW(DestructArray)
+(
+    CW(CW_root_Smp, AnySimple) * values,
+    CW(CW_root_Smp, UInt64) length
+);
+
+CW_THUNK void
 CW(_AnySimple)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(SetValueBool)
 (
     CW() * self,
@@ -66,7 +102,7 @@ CW(SetValueBool)
     CW(CW_root_Smp, Bool) value
 );
 
-void
+CW_THUNK void
 CW(SetValueChar8)
 (
     CW() * self,
@@ -74,7 +110,7 @@ CW(SetValueChar8)
     CW(CW_root_Smp, Char8) value
 );
 
-void
+CW_THUNK void
 CW(SetValueString8)
 (
     CW() * self,
@@ -82,7 +118,7 @@ CW(SetValueString8)
     CW(CW_root_Smp, String8) value
 );
 
-void
+CW_THUNK void
 CW(SetValueUInt8)
 (
     CW() * self,
@@ -90,7 +126,7 @@ CW(SetValueUInt8)
     CW(CW_root_Smp, UInt8) value
 );
 
-void
+CW_THUNK void
 CW(SetValueUInt16)
 (
     CW() * self,
@@ -98,7 +134,7 @@ CW(SetValueUInt16)
     CW(CW_root_Smp, UInt16) value
 );
 
-void
+CW_THUNK void
 CW(SetValueUInt32)
 (
     CW() * self,
@@ -106,7 +142,7 @@ CW(SetValueUInt32)
     CW(CW_root_Smp, UInt32) value
 );
 
-void
+CW_THUNK void
 CW(SetValueUInt64)
 (
     CW() * self,
@@ -114,7 +150,7 @@ CW(SetValueUInt64)
     CW(CW_root_Smp, UInt64) value
 );
 
-void
+CW_THUNK void
 CW(SetValueInt8)
 (
     CW() * self,
@@ -122,7 +158,7 @@ CW(SetValueInt8)
     CW(CW_root_Smp, Int8) value
 );
 
-void
+CW_THUNK void
 CW(SetValueInt16)
 (
     CW() * self,
@@ -130,7 +166,7 @@ CW(SetValueInt16)
     CW(CW_root_Smp, Int16) value
 );
 
-void
+CW_THUNK void
 CW(SetValueInt32)
 (
     CW() * self,
@@ -138,7 +174,7 @@ CW(SetValueInt32)
     CW(CW_root_Smp, Int32) value
 );
 
-void
+CW_THUNK void
 CW(SetValueInt64)
 (
     CW() * self,
@@ -146,7 +182,7 @@ CW(SetValueInt64)
     CW(CW_root_Smp, Int64) value
 );
 
-void
+CW_THUNK void
 CW(SetValueFloat32)
 (
     CW() * self,
@@ -154,7 +190,7 @@ CW(SetValueFloat32)
     CW(CW_root_Smp, Float32) value
 );
 
-void
+CW_THUNK void
 CW(SetValueFloat64)
 (
     CW() * self,
@@ -162,91 +198,91 @@ CW(SetValueFloat64)
     CW(CW_root_Smp, Float64) value
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(operatorBool)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Char8)
+CW_THUNK CW(CW_root_Smp, Char8)
 CW(operatorChar8)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(operatorString8)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt8)
+CW_THUNK CW(CW_root_Smp, UInt8)
 CW(operatorUInt8)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt16)
+CW_THUNK CW(CW_root_Smp, UInt16)
 CW(operatorUInt16)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt32)
+CW_THUNK CW(CW_root_Smp, UInt32)
 CW(operatorUInt32)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt64)
+CW_THUNK CW(CW_root_Smp, UInt64)
 CW(operatorUInt64)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int8)
+CW_THUNK CW(CW_root_Smp, Int8)
 CW(operatorInt8)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int16)
+CW_THUNK CW(CW_root_Smp, Int16)
 CW(operatorInt16)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(operatorInt32)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(operatorInt64)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Float32)
+CW_THUNK CW(CW_root_Smp, Float32)
 CW(operatorFloat32)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Float64)
+CW_THUNK CW(CW_root_Smp, Float64)
 CW(operatorFloat64)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(MoveString)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetType)
 (
     CW() * self
@@ -0,0 +1,588 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ANYSIMPLE_INL
+#define CWRAPPER_ANYSIMPLE_INL
+
+#include "Smp-C/AnySimple.h"
+#include <Smp/AnySimple.h>
+#include <new>
+
+static_assert(sizeof(CW(CW_root_Smp, AnySimple)) == sizeof(Smp::AnySimple), "AnySimple storage size mismatch");
+static_assert(alignof(CW(CW_root_Smp, AnySimple)) >= alignof(Smp::AnySimple), "AnySimple storage alignment mismatch");
+static_assert(CW(CW_root_Smp_AnySimple, Alignment) == alignof(Smp::AnySimple), "AnySimple alignment constant mismatch");
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::AnySimple ### */
+#define CW_SPACE CW_root_Smp_AnySimple
+
+/* Error while processing function "AnySimple" at Smp/./AnySimple.h:34:9 (exported to Smp-C/AnySimple.h) : Skipping constructor */
+
+/* Error while processing function "AnySimple" at Smp/./AnySimple.h:38:18 (exported to Smp-C/AnySimple.h) : Skipping constructor */
+
+/* Error while processing function "AnySimple" at Smp/./AnySimple.h:43:9 (exported to Smp-C/AnySimple.h) : Skipping templated function */
+
+/* Error while processing function "AnySimple" at Smp/./AnySimple.h:52:9 (exported to Smp-C/AnySimple.h) : Skipping constructor */
+
+/* Error while processing function "AnySimple" at Smp/./AnySimple.h:57:9 (exported to Smp-C/AnySimple.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./AnySimple.h:63:20 (exported to Smp-C/AnySimple.h) : Reference type is not supported: AnySimple & */
+
+/* Error while processing function "operator=" at Smp/./AnySimple.h:69:20 (exported to Smp-C/AnySimple.h) : Reference type is not supported: AnySimple & */
+
+CW_THUNK void
+CW(Construct)
+(
+    CW(CW_root_Smp, AnySimple) * memory
+) {
+    try {
+        new (memory) Smp::AnySimple(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(ConstructCopy)
+(
+    CW(CW_root_Smp, AnySimple) * memory,
+    const CW(CW_root_Smp, AnySimple) * other
+) {
+    try {
+        new (memory) Smp::AnySimple(
+            *reinterpret_cast<const Smp::AnySimple *>(other)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(ConstructArray)
+(
+    CW(CW_root_Smp, AnySimple) * memory,
+    CW(CW_root_Smp, UInt64) length
+) {
+    try {
+        for (CW(CW_root_Smp, UInt64) i = 0u; i < length; ++i) {
+            new (memory + i) Smp::AnySimple(
+            );
+        }
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(DestructArray)
+(
+    CW(CW_root_Smp, AnySimple) * values,
+    CW(CW_root_Smp, UInt64) length
+) {
+    try {
+        Smp::AnySimple *objects = reinterpret_cast<Smp::AnySimple *>(values);
+        for (CW(CW_root_Smp, UInt64) i = 0u; i < length; ++i) {
+            objects[i].~AnySimple(
+            );
+        }
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(_AnySimple)
+(
+    CW() * self
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->~AnySimple(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueBool)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Bool) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Bool>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueChar8)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Char8) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Char8>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueString8)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, String8) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::String8>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueUInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, UInt8) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::UInt8>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueUInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, UInt16) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::UInt16>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueUInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, UInt32) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::UInt32>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueUInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, UInt64) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::UInt64>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Int8) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Int8>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Int16) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Int16>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Int32) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Int32>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Int64) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Int64>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueFloat32)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Float32) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Float32>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValueFloat64)
+(
+    CW() * self,
+    CW(CW_root_Smp, PrimitiveTypeKind) kind,
+    CW(CW_root_Smp, Float64) value
+) {
+    try {
+        reinterpret_cast<Smp::AnySimple *>(self)->SetValue(
+            static_cast<Smp::PrimitiveTypeKind>(kind),
+            static_cast<Smp::Float64>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(operatorBool)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Bool(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Char8)
+CW(operatorChar8)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Char8)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Char8(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(operatorString8)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::String8(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt8)
+CW(operatorUInt8)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt8)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::UInt8(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt16)
+CW(operatorUInt16)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt16)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::UInt16(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt32)
+CW(operatorUInt32)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt32)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::UInt32(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(operatorUInt64)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::UInt64(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int8)
+CW(operatorInt8)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int8)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Int8(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int16)
+CW(operatorInt16)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int16)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Int16(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(operatorInt32)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Int32(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(operatorInt64)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Int64(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Float32)
+CW(operatorFloat32)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Float32)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Float32(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Float64)
+CW(operatorFloat64)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Float64)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->operator Smp::Float64(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(MoveString)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->MoveString(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
+CW(GetType)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(
+        reinterpret_cast<Smp::AnySimple *>(self)->GetType(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "operator==" at Smp/./AnySimple.h:216:14 (exported to Smp-C/AnySimple.h) : Reference type is not supported: const Smp::AnySimple & */
+
+/* Error while processing function "operator!=" at Smp/./AnySimple.h:222:14 (exported to Smp-C/AnySimple.h) : Reference type is not supported: const Smp::AnySimple & */
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+/* Error while processing function "operator<<" at Smp/./AnySimple.h:285:19 (exported to Smp-C/AnySimple.h) : Reference type is not supported: std::ostream & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ANYSIMPLE_INL */
@@ -0,0 +1,31 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_BOOL_INL
+#define CWRAPPER_BOOL_INL
+
+#include "Smp-C/Bool.h"
+#include <Smp/Bool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_BOOL_INL */
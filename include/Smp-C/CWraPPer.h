@@ -8,6 +8,8 @@
 // #define CW_PREFIX pre /* uncomment to add a prefix to every name */
 // #define CW_POSTFIX post /* uncomment to add a postfix to every name */
 #define CW_SEPARATOR _ /* names' separator */
+/* CW_HEADER_ONLY inlines every wrapper in C++ units (see Smp-C/Inline.h). Pass it as -DCW_HEADER_ONLY
+ * to the consumer's C++ units only; never define it here, as the library is built from this same header. */
 
 /* Utils */
 #define CW_CONCAT3(a, b, c) a ## b ## c
@@ -17,6 +19,13 @@
 #define CW_SWITCH_BUILD_SPACE(_1, _2, name, ...) name
 #define CW_BUILD_SPACE(...) CW_SWITCH_BUILD_SPACE(__VA_ARGS__, CW_BUILD_SPACE_RELATIVE, CW_BUILD_SPACE_ABSOLUTE)(__VA_ARGS__)
 
+/* Linkage: the library sources (CW_BUILDING_LIBRARY) always define the wrappers out of line */
+#if defined(CW_HEADER_ONLY) && defined(__cplusplus) && !defined(CW_BUILDING_LIBRARY)
+    #define CW_THUNK static inline
+#else
+    #define CW_THUNK
+#endif
+
 /* Name Retrieving */
 #if defined(CW_PREFIX) && defined(CW_POSTFIX)
     #define CW_NAME_SPACE() CW_CC3EX(CW_PREFIX, CW_SEPARATOR, CW_CC3EX(CW_SPACE, CW_SEPARATOR, CW_POSTFIX))
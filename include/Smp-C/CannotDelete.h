@@ -40,25 +40,25 @@ typedef void CW(CannotDelete);
 #endif /* CW_root_Smp_CannotDelete */
 #define CW_SPACE CW_root_Smp_CannotDelete
 
-void
+CW_THUNK void
 CW(_CannotDelete)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetContainerName)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IComponent) *
+CW_THUNK const CW(CW_root_Smp, IComponent) *
 CW(GetComponent)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetLowerLimit)
 (
     CW() * self
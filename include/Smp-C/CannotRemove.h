@@ -40,25 +40,25 @@ typedef void CW(CannotRemove);
 #endif /* CW_root_Smp_CannotRemove */
 #define CW_SPACE CW_root_Smp_CannotRemove
 
-void
+CW_THUNK void
 CW(_CannotRemove)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetReferenceName)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IComponent) *
+CW_THUNK const CW(CW_root_Smp, IComponent) *
 CW(GetComponent)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetLowerLimit)
 (
     CW() * self
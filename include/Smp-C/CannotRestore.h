@@ -37,7 +37,7 @@ typedef void CW(CannotRestore);
 #endif /* CW_root_Smp_CannotRestore */
 #define CW_SPACE CW_root_Smp_CannotRestore
 
-void
+CW_THUNK void
 CW(_CannotRestore)
 (
     CW() * self
@@ -37,7 +37,7 @@ typedef void CW(CannotStore);
 #endif /* CW_root_Smp_CannotStore */
 #define CW_SPACE CW_root_Smp_CannotStore
 
-void
+CW_THUNK void
 CW(_CannotStore)
 (
     CW() * self
@@ -30,7 +30,12 @@ extern "C" {
 
 typedef void CW(ICollection);
 
-typedef void CW(CollectionIterator);
+/* Caller-owned state of a walk over a collection, see its Begin and Next */
+typedef struct {
+    const CW(ICollection) * collection;
+    CW(UInt64) index;
+    CW(UInt64) size;
+} CW(CollectionIterator);
 
 #undef CW_SPACE
 
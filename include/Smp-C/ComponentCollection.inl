@@ -0,0 +1,157 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_COMPONENTCOLLECTION_INL
+#define CWRAPPER_COMPONENTCOLLECTION_INL
+
+#include "Smp-C/ComponentCollection.h"
+#include <Smp/ComponentCollection.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ComponentCollection ### */
+#define CW_SPACE CW_root_Smp_ComponentCollection
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(Size)
+(
+    const CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<const Smp::ComponentCollection *>(self)->size(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(ToArray)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) capacity,
+    CW(CW_root_Smp, IComponent) ** items
+) {
+    CW(CW_root_Smp, UInt64) count = 0u;
+    try {
+        const Smp::ComponentCollection *collection = static_cast<const Smp::ComponentCollection *>(self);
+        for (auto it = collection->begin(), end = collection->end(); it != end && count < capacity; ++it) {
+            items[count++] = static_cast<CW(CW_root_Smp, IComponent) *>(*it);
+        }
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return count;
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(Empty)
+(
+    const CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<const Smp::ComponentCollection *>(self)->empty(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IComponent) *
+CW(At)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) index
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IComponent) *>(
+        static_cast<const Smp::ComponentCollection *>(self)->at(
+            static_cast<std::size_t>(index)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IComponent) *
+CW(AtString8)
+(
+    const CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IComponent) *>(
+        static_cast<const Smp::ComponentCollection *>(self)->at(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(Begin)
+(
+    const CW() * self,
+    CW(CW_root_Smp, CollectionIterator) * iterator
+) {
+    iterator->collection = self;
+    iterator->index = 0u;
+    iterator->size = 0u;
+    try {
+        iterator->size = static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<const Smp::ComponentCollection *>(self)->size(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, IComponent) *
+CW(Next)
+(
+    CW(CW_root_Smp, CollectionIterator) * iterator
+) {
+    if (iterator->index >= iterator->size) {
+        return nullptr;
+    }
+    try {
+        return static_cast<CW(CW_root_Smp, IComponent) *>(
+        static_cast<const Smp::ComponentCollection *>(iterator->collection)->at(
+            static_cast<std::size_t>(iterator->index++)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_COMPONENTCOLLECTION_INL */
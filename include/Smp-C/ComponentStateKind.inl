@@ -0,0 +1,33 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_COMPONENTSTATEKIND_INL
+#define CWRAPPER_COMPONENTSTATEKIND_INL
+
+#include "Smp-C/ComponentStateKind.h"
+#include <Smp/ComponentStateKind.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+/* Error while processing function "operator<<" at Smp/ComponentStateKind.h:73:19 (exported to Smp-C/ComponentStateKind.h) : Reference type is not supported: std::ostream & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_COMPONENTSTATEKIND_INL */
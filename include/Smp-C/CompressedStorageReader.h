@@ -0,0 +1,112 @@
+/**
+ * Storage reader restoring a state vector compressed in independent
+ * blocks.
+ *
+ * Implements IStorageReader (through GetStorageReader). The file is
+ * mapped in memory read only. Restore decompresses the whole blocks it
+ * covers straight into the destination, in parallel on a pool of
+ * workerCount threads plus the calling one; a block read in part is
+ * decompressed once and kept. Seek moves to the start of any block.
+ * POSIX only.
+ */
+#ifndef CWRAPPER_COMPRESSEDSTORAGEREADER_H
+#define CWRAPPER_COMPRESSEDSTORAGEREADER_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IStorageReader.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(CompressedStorageReader);
+
+#undef CW_SPACE
+
+
+/* ### Smp::CompressedStorageReader ### */
+#ifndef CW_root_Smp_CompressedStorageReader
+#define CW_root_Smp_CompressedStorageReader CW_BUILD_SPACE(CW_root_Smp, CompressedStorageReader)
+#endif /* CW_root_Smp_CompressedStorageReader */
+#define CW_SPACE CW_root_Smp_CompressedStorageReader
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) workerCount
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IStorageReader) *
+CW(GetStorageReader)
+(
+    CW() * self
+);
+
+/* Returns the size of the state vector */
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+);
+
+/* Returns the number of bytes restored or skipped so far */
+CW(CW_root_Smp, UInt64)
+CW(GetPosition)
+(
+    const CW() * self
+);
+
+/* Returns the size of the blocks, the last one may be shorter */
+CW(CW_root_Smp, UInt64)
+CW(GetBlockSize)
+(
+    const CW() * self
+);
+
+/* Returns the number of blocks */
+CW(CW_root_Smp, UInt64)
+CW(GetBlockCount)
+(
+    const CW() * self
+);
+
+/* Next Restore starts at the block, GetBlockCount for the end */
+void
+CW(Seek)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) block
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_COMPRESSEDSTORAGEREADER_H */
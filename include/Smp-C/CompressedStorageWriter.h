@@ -0,0 +1,93 @@
+/**
+ * Storage writer compressing the state vector in independent blocks.
+ *
+ * Implements IStorageWriter (through GetStorageWriter). The stored bytes
+ * are cut in blocks of blockSize bytes (0 for 1 MiB, below 4 GiB), each
+ * compressed on its own with the LZ4-style codec of the library. Store
+ * only copies the bytes into the next block: full blocks are compressed
+ * on a pool of workerCount threads (0 for the background thread alone)
+ * and written by a background thread while Store goes on. Destroy writes
+ * the last block and the block index, so the file is only usable
+ * afterwards. Once a block could not be written, every later Store and
+ * Destroy report CannotStore and no index is written.
+ */
+#ifndef CWRAPPER_COMPRESSEDSTORAGEWRITER_H
+#define CWRAPPER_COMPRESSEDSTORAGEWRITER_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IStorageWriter.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(CompressedStorageWriter);
+
+#undef CW_SPACE
+
+
+/* ### Smp::CompressedStorageWriter ### */
+#ifndef CW_root_Smp_CompressedStorageWriter
+#define CW_root_Smp_CompressedStorageWriter CW_BUILD_SPACE(CW_root_Smp, CompressedStorageWriter)
+#endif /* CW_root_Smp_CompressedStorageWriter */
+#define CW_SPACE CW_root_Smp_CompressedStorageWriter
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) blockSize,
+    CW(CW_root_Smp, UInt64) workerCount
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IStorageWriter) *
+CW(GetStorageWriter)
+(
+    CW() * self
+);
+
+/* Returns the number of bytes given to Store */
+CW(CW_root_Smp, UInt64)
+CW(GetStoredSize)
+(
+    const CW() * self
+);
+
+/* Returns the number of bytes written to the file so far */
+CW(CW_root_Smp, UInt64)
+CW(GetWrittenSize)
+(
+    const CW() * self
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_COMPRESSEDSTORAGEWRITER_H */
@@ -38,19 +38,19 @@ typedef void CW(ContainerFull);
 #endif /* CW_root_Smp_ContainerFull */
 #define CW_SPACE CW_root_Smp_ContainerFull
 
-void
+CW_THUNK void
 CW(_ContainerFull)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetContainerName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetContainerSize)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_CONTAINERFULL_INL
+#define CWRAPPER_CONTAINERFULL_INL
+
+#include "Smp-C/ContainerFull.h"
+#include <Smp/ContainerFull.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ContainerFull ### */
+#define CW_SPACE CW_root_Smp_ContainerFull
+
+CW_THUNK void
+CW(_ContainerFull)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ContainerFull *>(self)->~ContainerFull(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetContainerName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::ContainerFull *>(self)->GetContainerName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetContainerSize)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::ContainerFull *>(self)->GetContainerSize(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "ContainerFull" at Smp/ContainerFull.h:29:11 (exported to Smp-C/ContainerFull.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/ContainerFull.h:29:11 (exported to Smp-C/ContainerFull.h) : Reference type is not supported: ContainerFull & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_CONTAINERFULL_INL */
@@ -0,0 +1,86 @@
+/**
+ * Storage reader restoring a delta breakpoint.
+ *
+ * Implements IStorageReader (through GetStorageReader). The breakpoint
+ * path/fileName and every file of its chain are mapped in memory read
+ * only; Restore copies each chunk straight from the file holding it, so
+ * the full state comes back whatever the length of the chain. POSIX only.
+ */
+#ifndef CWRAPPER_DELTASTORAGEREADER_H
+#define CWRAPPER_DELTASTORAGEREADER_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IStorageReader.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(DeltaStorageReader);
+
+#undef CW_SPACE
+
+
+/* ### Smp::DeltaStorageReader ### */
+#ifndef CW_root_Smp_DeltaStorageReader
+#define CW_root_Smp_DeltaStorageReader CW_BUILD_SPACE(CW_root_Smp, DeltaStorageReader)
+#endif /* CW_root_Smp_DeltaStorageReader */
+#define CW_SPACE CW_root_Smp_DeltaStorageReader
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IStorageReader) *
+CW(GetStorageReader)
+(
+    CW() * self
+);
+
+/* Returns the size of the full state vector */
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+);
+
+/* Returns the number of bytes restored so far */
+CW(CW_root_Smp, UInt64)
+CW(GetPosition)
+(
+    const CW() * self
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_DELTASTORAGEREADER_H */
@@ -0,0 +1,97 @@
+/**
+ * Storage writer keeping only the blocks changed since a previous
+ * breakpoint.
+ *
+ * Implements IStorageWriter (through GetStorageWriter). Each Store block
+ * is cut in chunks of chunkSize bytes (0 for 16 KiB) and each chunk is
+ * hashed; a chunk whose hash matches the chunk at the same place in the
+ * breakpoint previousFileName (in the same directory, NULL or "" for a
+ * full breakpoint) is not written again, the manifest pointing to the
+ * file that holds it instead. A delta breakpoint keeps the chunk size of
+ * its previous one. Destroy writes the manifest, so the file is only
+ * usable afterwards; older files of the chain must be kept as long as a
+ * newer breakpoint refers to them, and Create fails with CannotStore when
+ * fileName is one of them. Once a Store has failed, every later
+ * Store fails too and Destroy reports CannotStore and leaves a file no
+ * reader accepts. POSIX only.
+ */
+#ifndef CWRAPPER_DELTASTORAGEWRITER_H
+#define CWRAPPER_DELTASTORAGEWRITER_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IStorageWriter.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(DeltaStorageWriter);
+
+#undef CW_SPACE
+
+
+/* ### Smp::DeltaStorageWriter ### */
+#ifndef CW_root_Smp_DeltaStorageWriter
+#define CW_root_Smp_DeltaStorageWriter CW_BUILD_SPACE(CW_root_Smp, DeltaStorageWriter)
+#endif /* CW_root_Smp_DeltaStorageWriter */
+#define CW_SPACE CW_root_Smp_DeltaStorageWriter
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, String8) previousFileName,
+    CW(CW_root_Smp, UInt64) chunkSize
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IStorageWriter) *
+CW(GetStorageWriter)
+(
+    CW() * self
+);
+
+/* Returns the number of bytes given to Store */
+CW(CW_root_Smp, UInt64)
+CW(GetStoredSize)
+(
+    const CW() * self
+);
+
+/* Returns the number of bytes of changed chunks written to the file */
+CW(CW_root_Smp, UInt64)
+CW(GetWrittenSize)
+(
+    const CW() * self
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_DELTASTORAGEWRITER_H */
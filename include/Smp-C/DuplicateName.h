@@ -38,13 +38,13 @@ typedef void CW(DuplicateName);
 #endif /* CW_root_Smp_DuplicateName */
 #define CW_SPACE CW_root_Smp_DuplicateName
 
-void
+CW_THUNK void
 CW(_DuplicateName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetDuplicateName)
 (
     CW() * self
@@ -38,19 +38,19 @@ typedef void CW(DuplicateUuid);
 #endif /* CW_root_Smp_DuplicateUuid */
 #define CW_SPACE CW_root_Smp_DuplicateUuid
 
-void
+CW_THUNK void
 CW(_DuplicateUuid)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetOldName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetNewName)
 (
     CW() * self
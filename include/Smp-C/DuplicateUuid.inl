@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_DUPLICATEUUID_INL
+#define CWRAPPER_DUPLICATEUUID_INL
+
+#include "Smp-C/DuplicateUuid.h"
+#include <Smp/DuplicateUuid.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::DuplicateUuid ### */
+#define CW_SPACE CW_root_Smp_DuplicateUuid
+
+CW_THUNK void
+CW(_DuplicateUuid)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::DuplicateUuid *>(self)->~DuplicateUuid(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetOldName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::DuplicateUuid *>(self)->GetOldName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetNewName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::DuplicateUuid *>(self)->GetNewName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "DuplicateUuid" at Smp/./DuplicateUuid.h:30:11 (exported to Smp-C/DuplicateUuid.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./DuplicateUuid.h:30:11 (exported to Smp-C/DuplicateUuid.h) : Reference type is not supported: DuplicateUuid & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_DUPLICATEUUID_INL */
@@ -0,0 +1,137 @@
+/**
+ * Entry points implemented in C.
+ *
+ * An entry point pairs a C function with its user data and can be passed
+ * wherever an IEntryPoint is expected (scheduler, event manager, ...).
+ * Entry points are carved out of slabs owned by a pool, so creating
+ * thousands of them costs a few allocations in total (slabSize entry
+ * points per slab, 0 for the default). The name and the description are
+ * not copied and must outlive the entry point.
+ *
+ * Subscribe acquires an entry point and subscribes it to an event of an
+ * event manager in one call; Unsubscribe undoes both.
+ */
+#ifndef CWRAPPER_ENTRYPOINTPOOL_H
+#define CWRAPPER_ENTRYPOINTPOOL_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IEntryPoint.h"
+#include "Smp-C/IObject.h"
+#include "Smp-C/PrimitiveTypes.h"
+#include "Smp-C/Services/EventId.h"
+#include "Smp-C/Services/IEventManager.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void (* CW(EntryPointFunction))(void * userData);
+
+typedef struct {
+    CW(EntryPointFunction) function;
+    void * userData;
+    CW(String8) name;
+    CW(String8) description;
+} CW(EntryPointDefinition);
+
+typedef void CW(EntryPointPool);
+
+#undef CW_SPACE
+
+
+/* ### Smp::EntryPointPool ### */
+#ifndef CW_root_Smp_EntryPointPool
+#define CW_root_Smp_EntryPointPool CW_BUILD_SPACE(CW_root_Smp, EntryPointPool)
+#endif /* CW_root_Smp_EntryPointPool */
+#define CW_SPACE CW_root_Smp_EntryPointPool
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) slabSize
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IEntryPoint) *
+CW(Acquire)
+(
+    CW() * self,
+    const CW(CW_root_Smp, EntryPointDefinition) * definition,
+    CW(CW_root_Smp, IObject) * parent
+);
+
+CW(CW_root_Smp, UInt64)
+CW(AcquireBatch)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp, EntryPointDefinition) * definitions,
+    CW(CW_root_Smp, IObject) * parent,
+    CW(CW_root_Smp, IEntryPoint) ** entryPoints
+);
+
+/* Release and ReleaseBatch ignore NULL entry points */
+void
+CW(Release)
+(
+    CW() * self,
+    CW(CW_root_Smp, IEntryPoint) * entryPoint
+);
+
+void
+CW(ReleaseBatch)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    CW(CW_root_Smp, IEntryPoint) * const * entryPoints
+);
+
+/* Returns the subscribed entry point, NULL if it could not be subscribed */
+CW(CW_root_Smp, IEntryPoint) *
+CW(Subscribe)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, IEventManager) * eventManager,
+    CW(CW_root_Smp_Services, EventId) event,
+    const CW(CW_root_Smp, EntryPointDefinition) * definition,
+    CW(CW_root_Smp, IObject) * parent
+);
+
+/* Releases the entry point once unsubscribed */
+void
+CW(Unsubscribe)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, IEventManager) * eventManager,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, IEntryPoint) * entryPoint
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ENTRYPOINTPOOL_H */
@@ -41,19 +41,19 @@ typedef void CW(EventSinkAlreadySubscribed);
 #endif /* CW_root_Smp_EventSinkAlreadySubscribed */
 #define CW_SPACE CW_root_Smp_EventSinkAlreadySubscribed
 
-void
+CW_THUNK void
 CW(_EventSinkAlreadySubscribed)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEventSink) *
+CW_THUNK const CW(CW_root_Smp, IEventSink) *
 CW(GetEventSink)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEventSource) *
+CW_THUNK const CW(CW_root_Smp, IEventSource) *
 CW(GetEventSource)
 (
     CW() * self
@@ -11,8 +11,10 @@ extern "C" {
 #endif /* __cplusplus */
 
 
+#include "Smp-C/CollectionIterator.h"
 #include "Smp-C/ICollection.h"
 #include "Smp-C/IEventSink.h"
+#include "Smp-C/PrimitiveTypes.h"
 
 
 /* ### root ### */
@@ -32,6 +34,62 @@ typedef void CW(EventSinkCollection);
 #undef CW_SPACE
 
 
+/* ### Smp::EventSinkCollection ### */
+#ifndef CW_root_Smp_EventSinkCollection
+#define CW_root_Smp_EventSinkCollection CW_BUILD_SPACE(CW_root_Smp, EventSinkCollection)
+#endif /* CW_root_Smp_EventSinkCollection */
+#define CW_SPACE CW_root_Smp_EventSinkCollection
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(Size)
+(
+    const CW() * self
+);
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(ToArray)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) capacity,
+    CW(CW_root_Smp, IEventSink) ** items
+);
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(Empty)
+(
+    const CW() * self
+);
+
+CW_THUNK CW(CW_root_Smp, IEventSink) *
+CW(At)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) index
+);
+
+CW_THUNK CW(CW_root_Smp, IEventSink) *
+CW(AtString8)
+(
+    const CW() * self,
+    CW(CW_root_Smp, String8) name
+);
+
+CW_THUNK void
+CW(Begin)
+(
+    const CW() * self,
+    CW(CW_root_Smp, CollectionIterator) * iterator
+);
+
+CW_THUNK CW(CW_root_Smp, IEventSink) *
+CW(Next)
+(
+    CW(CW_root_Smp, CollectionIterator) * iterator
+);
+
+#undef CW_SPACE
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -41,19 +41,19 @@ typedef void CW(EventSinkNotSubscribed);
 #endif /* CW_root_Smp_EventSinkNotSubscribed */
 #define CW_SPACE CW_root_Smp_EventSinkNotSubscribed
 
-void
+CW_THUNK void
 CW(_EventSinkNotSubscribed)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEventSource) *
+CW_THUNK const CW(CW_root_Smp, IEventSource) *
 CW(GetEventSource)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEventSink) *
+CW_THUNK const CW(CW_root_Smp, IEventSink) *
 CW(GetEventSink)
 (
     CW() * self
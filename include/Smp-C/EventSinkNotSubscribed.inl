@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_EVENTSINKNOTSUBSCRIBED_INL
+#define CWRAPPER_EVENTSINKNOTSUBSCRIBED_INL
+
+#include "Smp-C/EventSinkNotSubscribed.h"
+#include <Smp/EventSinkNotSubscribed.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::EventSinkNotSubscribed ### */
+#define CW_SPACE CW_root_Smp_EventSinkNotSubscribed
+
+CW_THUNK void
+CW(_EventSinkNotSubscribed)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::EventSinkNotSubscribed *>(self)->~EventSinkNotSubscribed(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, IEventSource) *
+CW(GetEventSource)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IEventSource) *>(
+        static_cast<Smp::EventSinkNotSubscribed *>(self)->GetEventSource(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, IEventSink) *
+CW(GetEventSink)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IEventSink) *>(
+        static_cast<Smp::EventSinkNotSubscribed *>(self)->GetEventSink(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "EventSinkNotSubscribed" at Smp/./EventSinkNotSubscribed.h:38:11 (exported to Smp-C/EventSinkNotSubscribed.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./EventSinkNotSubscribed.h:38:11 (exported to Smp-C/EventSinkNotSubscribed.h) : Reference type is not supported: EventSinkNotSubscribed & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_EVENTSINKNOTSUBSCRIBED_INL */
@@ -40,37 +40,37 @@ typedef void CW(Exception);
 #endif /* CW_root_Smp_Exception */
 #define CW_SPACE CW_root_Smp_Exception
 
-void
+CW_THUNK void
 CW(_Exception)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, Char8) *
+CW_THUNK const CW(CW_root_Smp, Char8) *
 CW(what)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetDescription)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetMessage)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IObject) *
+CW_THUNK const CW(CW_root_Smp, IObject) *
 CW(GetSender)
 (
     CW() * self
@@ -0,0 +1,129 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_EXCEPTION_INL
+#define CWRAPPER_EXCEPTION_INL
+
+#include "Smp-C/Exception.h"
+#include <Smp/Exception.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Exception ### */
+#define CW_SPACE CW_root_Smp_Exception
+
+CW_THUNK void
+CW(_Exception)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Exception *>(self)->~Exception(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, Char8) *
+CW(what)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, Char8) *>(
+        static_cast<Smp::Exception *>(self)->what(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::Exception *>(self)->GetName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetDescription)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::Exception *>(self)->GetDescription(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetMessage)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::Exception *>(self)->GetMessage(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, IObject) *
+CW(GetSender)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IObject) *>(
+        static_cast<Smp::Exception *>(self)->GetSender(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "Exception" at Smp/Exception.h:39:11 (exported to Smp-C/Exception.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/Exception.h:39:11 (exported to Smp-C/Exception.h) : Reference type is not supported: Exception & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_EXCEPTION_INL */
@@ -0,0 +1,142 @@
+/**
+ * Per-thread record of the last C++ exception caught by a wrapper.
+ *
+ * No exception crosses the C boundary: every wrapper catches it, fills the
+ * calling thread's record and returns a zero value. The record is
+ * preallocated, so reporting an error never allocates. It is sticky, like
+ * errno: a successful call leaves it untouched, and it keeps the last
+ * failure until Clear is called. A zero result is therefore only known to
+ * be a failure if the record was clear before the call: call Clear first,
+ * then check GetLast (NULL when nothing was caught) after the call.
+ */
+#ifndef CWRAPPER_EXCEPTIONRECORD_H
+#define CWRAPPER_EXCEPTIONRECORD_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IObject.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef CW(Int32) CW(ExceptionKind);
+
+typedef struct {
+    CW(ExceptionKind) kind;
+    const CW(IObject) * sender;
+    CW(Char8) name[64];
+    CW(Char8) message[1024];
+} CW(ExceptionRecord);
+
+#undef CW_SPACE
+
+
+/* ### Smp::ExceptionKind ### */
+#ifndef CW_root_Smp_ExceptionKind
+#define CW_root_Smp_ExceptionKind CW_BUILD_SPACE(CW_root_Smp, ExceptionKind)
+#endif /* CW_root_Smp_ExceptionKind */
+#define CW_SPACE CW_root_Smp_ExceptionKind
+
+enum {
+    CW(None) = 0,
+    CW(Unknown),
+    CW(Exception),
+    CW(CannotDelete),
+    CW(CannotRemove),
+    CW(CannotRestore),
+    CW(CannotStore),
+    CW(ContainerFull),
+    CW(DuplicateName),
+    CW(DuplicateUuid),
+    CW(EventSinkAlreadySubscribed),
+    CW(EventSinkNotSubscribed),
+    CW(FieldAlreadyConnected),
+    CW(FieldNotConnected),
+    CW(FileNotFound),
+    CW(InvalidAccess),
+    CW(InvalidAnyType),
+    CW(InvalidArrayIndex),
+    CW(InvalidArraySize),
+    CW(InvalidArrayValue),
+    CW(InvalidComponentState),
+    CW(InvalidEventSink),
+    CW(InvalidFieldName),
+    CW(InvalidFieldValue),
+    CW(InvalidFile),
+    CW(InvalidObjectName),
+    CW(InvalidObjectType),
+    CW(InvalidOperationName),
+    CW(InvalidParameterCount),
+    CW(InvalidParameterIndex),
+    CW(InvalidParameterValue),
+    CW(InvalidParent),
+    CW(InvalidPropertyValue),
+    CW(InvalidSimulatorState),
+    CW(InvalidSmpVersion),
+    CW(InvalidTarget),
+    CW(InvalidType),
+    CW(NoDynamicInvocation),
+    CW(NotContained),
+    CW(NotReferenced),
+    CW(ReferenceFull),
+    CW(VoidOperation),
+    CW(DuplicateLiteral),
+    CW(InvalidArrayItemType),
+    CW(InvalidParameterDirection),
+    CW(InvalidPrimitiveType),
+    CW(TypeAlreadyRegistered),
+    CW(TypeNotRegistered),
+    CW(EntryPointAlreadySubscribed),
+    CW(EntryPointNotSubscribed),
+    CW(InvalidCycleTime),
+    CW(InvalidEventId),
+    CW(InvalidEventName),
+    CW(InvalidEventTime),
+    CW(InvalidSimulationTime)
+};
+
+#undef CW_SPACE
+
+
+/* ### Smp::ExceptionRecord ### */
+#ifndef CW_root_Smp_ExceptionRecord
+#define CW_root_Smp_ExceptionRecord CW_BUILD_SPACE(CW_root_Smp, ExceptionRecord)
+#endif /* CW_root_Smp_ExceptionRecord */
+#define CW_SPACE CW_root_Smp_ExceptionRecord
+
+const CW(CW_root_Smp, ExceptionRecord) *
+CW(GetLast)
+(
+    void
+);
+
+void
+CW(Clear)
+(
+    void
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_EXCEPTIONRECORD_H */
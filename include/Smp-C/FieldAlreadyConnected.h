@@ -41,19 +41,19 @@ typedef void CW(FieldAlreadyConnected);
 #endif /* CW_root_Smp_FieldAlreadyConnected */
 #define CW_SPACE CW_root_Smp_FieldAlreadyConnected
 
-void
+CW_THUNK void
 CW(_FieldAlreadyConnected)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IOutputField) *
+CW_THUNK const CW(CW_root_Smp, IOutputField) *
 CW(GetSource)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IField) *
+CW_THUNK const CW(CW_root_Smp, IField) *
 CW(GetTarget)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_FIELDALREADYCONNECTED_INL
+#define CWRAPPER_FIELDALREADYCONNECTED_INL
+
+#include "Smp-C/FieldAlreadyConnected.h"
+#include <Smp/FieldAlreadyConnected.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::FieldAlreadyConnected ### */
+#define CW_SPACE CW_root_Smp_FieldAlreadyConnected
+
+CW_THUNK void
+CW(_FieldAlreadyConnected)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::FieldAlreadyConnected *>(self)->~FieldAlreadyConnected(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, IOutputField) *
+CW(GetSource)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IOutputField) *>(
+        static_cast<Smp::FieldAlreadyConnected *>(self)->GetSource(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, IField) *
+CW(GetTarget)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IField) *>(
+        static_cast<Smp::FieldAlreadyConnected *>(self)->GetTarget(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "FieldAlreadyConnected" at Smp/./FieldAlreadyConnected.h:38:11 (exported to Smp-C/FieldAlreadyConnected.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./FieldAlreadyConnected.h:38:11 (exported to Smp-C/FieldAlreadyConnected.h) : Reference type is not supported: FieldAlreadyConnected & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_FIELDALREADYCONNECTED_INL */
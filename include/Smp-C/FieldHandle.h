@@ -0,0 +1,245 @@
+/**
+ * Field handles: a simple field resolved once from its path.
+ *
+ * Resolve looks the field up by name a single time and keeps the
+ * ISimpleField pointer together with its primitive type kind in a small
+ * caller-owned struct. Typed accessors on the handle then go straight to
+ * the field without any name resolution. A handle stays valid as long as
+ * the field it was resolved from.
+ */
+#ifndef CWRAPPER_FIELDHANDLE_H
+#define CWRAPPER_FIELDHANDLE_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/AnySimple.h"
+#include "Smp-C/IComponent.h"
+#include "Smp-C/IField.h"
+#include "Smp-C/ISimpleField.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef struct {
+    CW(ISimpleField) * field;
+    CW(PrimitiveTypeKind) kind;
+} CW(FieldHandle);
+
+#undef CW_SPACE
+
+
+/* ### Smp::FieldHandle ### */
+#ifndef CW_root_Smp_FieldHandle
+#define CW_root_Smp_FieldHandle CW_BUILD_SPACE(CW_root_Smp, FieldHandle)
+#endif /* CW_root_Smp_FieldHandle */
+#define CW_SPACE CW_root_Smp_FieldHandle
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(Resolve)
+(
+    CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, IComponent) * component,
+    CW(CW_root_Smp, String8) fullName
+);
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(FromField)
+(
+    CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, IField) * field
+);
+
+CW_THUNK void
+CW(GetValue)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, AnySimple) * value
+);
+
+CW_THUNK void
+CW(SetValue)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    const CW(CW_root_Smp, AnySimple) * value
+);
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(GetBool)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, Char8)
+CW(GetChar8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, UInt8)
+CW(GetUInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, UInt16)
+CW(GetUInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, UInt32)
+CW(GetUInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(GetUInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, Int8)
+CW(GetInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, Int16)
+CW(GetInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, Float32)
+CW(GetFloat32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK CW(CW_root_Smp, Float64)
+CW(GetFloat64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+);
+
+CW_THUNK void
+CW(SetBool)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Bool) value
+);
+
+CW_THUNK void
+CW(SetChar8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Char8) value
+);
+
+CW_THUNK void
+CW(SetUInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt8) value
+);
+
+CW_THUNK void
+CW(SetUInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt16) value
+);
+
+CW_THUNK void
+CW(SetUInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt32) value
+);
+
+CW_THUNK void
+CW(SetUInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt64) value
+);
+
+CW_THUNK void
+CW(SetInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int8) value
+);
+
+CW_THUNK void
+CW(SetInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int16) value
+);
+
+CW_THUNK void
+CW(SetInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int32) value
+);
+
+CW_THUNK void
+CW(SetInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int64) value
+);
+
+CW_THUNK void
+CW(SetFloat32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Float32) value
+);
+
+CW_THUNK void
+CW(SetFloat64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Float64) value
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_FIELDHANDLE_H */
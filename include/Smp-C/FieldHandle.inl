@@ -0,0 +1,514 @@
+/**
+ * Field handles: a simple field resolved once from its path.
+ */
+#ifndef CWRAPPER_FIELDHANDLE_INL
+#define CWRAPPER_FIELDHANDLE_INL
+
+#include "Smp-C/FieldHandle.h"
+#include <Smp/IComponent.h>
+#include <Smp/ISimpleField.h>
+
+namespace {
+
+inline Smp::ISimpleField *FieldHandleField(const CW(CW_root_Smp, FieldHandle) &handle) {
+    return static_cast<Smp::ISimpleField *>(handle.field);
+}
+
+template <typename T, Smp::PrimitiveTypeKind Kind, T Smp::AnySimple::PrimitiveTypeValue::*Member>
+T FieldHandleGet(const CW(CW_root_Smp, FieldHandle) &handle) {
+    const Smp::AnySimple value = FieldHandleField(handle)->GetValue();
+    if (value.type == Kind) {
+        return value.value.*Member;
+    }
+    return static_cast<T>(value);
+}
+
+template <typename T>
+void FieldHandleSet(const CW(CW_root_Smp, FieldHandle) &handle, T value) {
+    Smp::AnySimple any;
+    any.SetValue(static_cast<Smp::PrimitiveTypeKind>(handle.kind), value);
+    FieldHandleField(handle)->SetValue(any);
+}
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::FieldHandle ### */
+#define CW_SPACE CW_root_Smp_FieldHandle
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(Resolve)
+(
+    CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, IComponent) * component,
+    CW(CW_root_Smp, String8) fullName
+) {
+    try {
+        return CW(FromField)(
+            self,
+            static_cast<Smp::IComponent *>(component)->GetField(
+                static_cast<Smp::String8>(fullName)
+            )
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(FromField)
+(
+    CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, IField) * field
+) {
+    try {
+        Smp::ISimpleField *simpleField = dynamic_cast<Smp::ISimpleField *>(static_cast<Smp::IField *>(field));
+        self->field = static_cast<CW(CW_root_Smp, ISimpleField) *>(simpleField);
+        self->kind = simpleField != nullptr
+            ? static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(simpleField->GetPrimitiveTypeKind())
+            : static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(Smp::PrimitiveTypeKind::PTK_None);
+        return simpleField != nullptr;
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(GetValue)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple *>(value) = FieldHandleField(*self)->GetValue(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValue)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    const CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        FieldHandleField(*self)->SetValue(
+            *reinterpret_cast<const Smp::AnySimple *>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(GetBool)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        FieldHandleGet<Smp::Bool, Smp::PrimitiveTypeKind::PTK_Bool, &Smp::AnySimple::PrimitiveTypeValue::boolValue>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Char8)
+CW(GetChar8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Char8)>(
+        FieldHandleGet<Smp::Char8, Smp::PrimitiveTypeKind::PTK_Char8, &Smp::AnySimple::PrimitiveTypeValue::char8Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt8)
+CW(GetUInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt8)>(
+        FieldHandleGet<Smp::UInt8, Smp::PrimitiveTypeKind::PTK_UInt8, &Smp::AnySimple::PrimitiveTypeValue::uInt8Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt16)
+CW(GetUInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt16)>(
+        FieldHandleGet<Smp::UInt16, Smp::PrimitiveTypeKind::PTK_UInt16, &Smp::AnySimple::PrimitiveTypeValue::uInt16Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt32)
+CW(GetUInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt32)>(
+        FieldHandleGet<Smp::UInt32, Smp::PrimitiveTypeKind::PTK_UInt32, &Smp::AnySimple::PrimitiveTypeValue::uInt32Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(GetUInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        FieldHandleGet<Smp::UInt64, Smp::PrimitiveTypeKind::PTK_UInt64, &Smp::AnySimple::PrimitiveTypeValue::uInt64Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int8)
+CW(GetInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int8)>(
+        FieldHandleGet<Smp::Int8, Smp::PrimitiveTypeKind::PTK_Int8, &Smp::AnySimple::PrimitiveTypeValue::int8Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int16)
+CW(GetInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int16)>(
+        FieldHandleGet<Smp::Int16, Smp::PrimitiveTypeKind::PTK_Int16, &Smp::AnySimple::PrimitiveTypeValue::int16Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        FieldHandleGet<Smp::Int32, Smp::PrimitiveTypeKind::PTK_Int32, &Smp::AnySimple::PrimitiveTypeValue::int32Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        FieldHandleGet<Smp::Int64, Smp::PrimitiveTypeKind::PTK_Int64, &Smp::AnySimple::PrimitiveTypeValue::int64Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Float32)
+CW(GetFloat32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Float32)>(
+        FieldHandleGet<Smp::Float32, Smp::PrimitiveTypeKind::PTK_Float32, &Smp::AnySimple::PrimitiveTypeValue::float32Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Float64)
+CW(GetFloat64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Float64)>(
+        FieldHandleGet<Smp::Float64, Smp::PrimitiveTypeKind::PTK_Float64, &Smp::AnySimple::PrimitiveTypeValue::float64Value>(
+            *self
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(SetBool)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Bool) value
+) {
+    try {
+        FieldHandleSet<Smp::Bool>(
+            *self,
+            static_cast<Smp::Bool>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetChar8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Char8) value
+) {
+    try {
+        FieldHandleSet<Smp::Char8>(
+            *self,
+            static_cast<Smp::Char8>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetUInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt8) value
+) {
+    try {
+        FieldHandleSet<Smp::UInt8>(
+            *self,
+            static_cast<Smp::UInt8>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetUInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt16) value
+) {
+    try {
+        FieldHandleSet<Smp::UInt16>(
+            *self,
+            static_cast<Smp::UInt16>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetUInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt32) value
+) {
+    try {
+        FieldHandleSet<Smp::UInt32>(
+            *self,
+            static_cast<Smp::UInt32>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetUInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, UInt64) value
+) {
+    try {
+        FieldHandleSet<Smp::UInt64>(
+            *self,
+            static_cast<Smp::UInt64>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetInt8)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int8) value
+) {
+    try {
+        FieldHandleSet<Smp::Int8>(
+            *self,
+            static_cast<Smp::Int8>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetInt16)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int16) value
+) {
+    try {
+        FieldHandleSet<Smp::Int16>(
+            *self,
+            static_cast<Smp::Int16>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetInt32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int32) value
+) {
+    try {
+        FieldHandleSet<Smp::Int32>(
+            *self,
+            static_cast<Smp::Int32>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetInt64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Int64) value
+) {
+    try {
+        FieldHandleSet<Smp::Int64>(
+            *self,
+            static_cast<Smp::Int64>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetFloat32)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Float32) value
+) {
+    try {
+        FieldHandleSet<Smp::Float32>(
+            *self,
+            static_cast<Smp::Float32>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetFloat64)
+(
+    const CW(CW_root_Smp, FieldHandle) * self,
+    CW(CW_root_Smp, Float64) value
+) {
+    try {
+        FieldHandleSet<Smp::Float64>(
+            *self,
+            static_cast<Smp::Float64>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_FIELDHANDLE_INL */
@@ -0,0 +1,112 @@
+/**
+ * Read and write plans over a fixed set of simple fields.
+ *
+ * A plan is compiled once from field handles (or from field paths below
+ * a component) and lays the fields out in a contiguous buffer, in the
+ * given order, each at its natural alignment for its primitive type kind
+ * (Duration and DateTime are stored as Int64). GetSize and GetOffset
+ * describe the layout; Read copies every current value into a caller
+ * buffer and Write sets every field from one; both return the number of
+ * fields processed. Creation returns NULL if a field is missing or is a
+ * String8 field.
+ */
+#ifndef CWRAPPER_FIELDPLAN_H
+#define CWRAPPER_FIELDPLAN_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/FieldHandle.h"
+#include "Smp-C/IComponent.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(FieldPlan);
+
+#undef CW_SPACE
+
+
+/* ### Smp::FieldPlan ### */
+#ifndef CW_root_Smp_FieldPlan
+#define CW_root_Smp_FieldPlan CW_BUILD_SPACE(CW_root_Smp, FieldPlan)
+#endif /* CW_root_Smp_FieldPlan */
+#define CW_SPACE CW_root_Smp_FieldPlan
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp, FieldHandle) * handles
+);
+
+CW() *
+CW(CreateFromPaths)
+(
+    CW(CW_root_Smp, IComponent) * component,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp, String8) * fullNames
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, UInt64)
+CW(GetCount)
+(
+    const CW() * self
+);
+
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+);
+
+CW(CW_root_Smp, UInt64)
+CW(GetOffset)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) index
+);
+
+CW(CW_root_Smp, UInt64)
+CW(Read)
+(
+    const CW() * self,
+    void * buffer
+);
+
+CW(CW_root_Smp, UInt64)
+CW(Write)
+(
+    const CW() * self,
+    const void * buffer
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_FIELDPLAN_H */
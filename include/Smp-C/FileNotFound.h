@@ -38,13 +38,13 @@ typedef void CW(FileNotFound);
 #endif /* CW_root_Smp_FileNotFound */
 #define CW_SPACE CW_root_Smp_FileNotFound
 
-void
+CW_THUNK void
 CW(_FileNotFound)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetFileName)
 (
     CW() * self
@@ -0,0 +1,136 @@
+/**
+ * Branching of a simulation into forked processes, for Monte Carlo runs.
+ *
+ * Branch forks the process count times, at most maxRunning children at
+ * a time (0 for one per processor). Each child starts from a copy-on-write
+ * image of the simulation as it was when Branch was called, so no state is
+ * stored or restored: Branch returns the index of the branch (1 to count)
+ * in the child, which typically perturbs fields with
+ * IComponent_SetSimpleValue, runs the simulation on, passes its results to
+ * Send and ends with Exit. In the calling process, Branch returns 0 once
+ * every child has exited; the results and the exit status of each branch
+ * are then available. It returns UINT64_MAX instead when a child could
+ * not be forked or watched, so that no failure is taken for a branch.
+ *
+ * Branch may be called from a Hold point (the child calls Run) or from an
+ * entry point (the child simply returns). Only the calling thread exists
+ * in a child, so no other thread of the process (worker pools, logger
+ * threads) may be in use when Branch is called. POSIX only.
+ */
+#ifndef CWRAPPER_FORKSNAPSHOT_H
+#define CWRAPPER_FORKSNAPSHOT_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(ForkSnapshot);
+
+#undef CW_SPACE
+
+
+/* ### Smp::ForkSnapshot ### */
+#ifndef CW_root_Smp_ForkSnapshot
+#define CW_root_Smp_ForkSnapshot CW_BUILD_SPACE(CW_root_Smp, ForkSnapshot)
+#endif /* CW_root_Smp_ForkSnapshot */
+#define CW_SPACE CW_root_Smp_ForkSnapshot
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) maxRunning
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+/*
+ * Returns the branch index in a child, 0 in the calling process once all
+ * children have exited, UINT64_MAX in the calling process on failure (see
+ * ExceptionRecord): children already started are waited for, or killed if
+ * they can no longer be watched
+ */
+CW(CW_root_Smp, UInt64)
+CW(Branch)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count
+);
+
+/* Returns the branch index of the current process, 0 outside of a child */
+CW(CW_root_Smp, UInt64)
+CW(GetBranch)
+(
+    const CW() * self
+);
+
+/* Child only: appends size bytes to the results of the branch */
+void
+CW(Send)
+(
+    CW() * self,
+    const void * data,
+    CW(CW_root_Smp, UInt64) size
+);
+
+/* Child only: flushes the standard streams and ends the child without returning */
+void
+CW(Exit)
+(
+    CW() * self,
+    CW(CW_root_Smp, Int32) status
+);
+
+/* Returns the number of bytes sent by a branch */
+CW(CW_root_Smp, UInt64)
+CW(GetResultSize)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) branch
+);
+
+/* Returns the bytes sent by a branch, valid until the next Branch */
+const void *
+CW(GetResult)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) branch
+);
+
+/* Returns the exit status of a branch, or minus the signal that ended it */
+CW(CW_root_Smp, Int32)
+CW(GetExitStatus)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) branch
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_FORKSNAPSHOT_H */
@@ -41,19 +41,19 @@ typedef void CW(IAggregate);
 #endif /* CW_root_Smp_IAggregate */
 #define CW_SPACE CW_root_Smp_IAggregate
 
-void
+CW_THUNK void
 CW(_IAggregate)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, ReferenceCollection) *
+CW_THUNK const CW(CW_root_Smp, ReferenceCollection) *
 CW(GetReferences)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IReference) *
+CW_THUNK CW(CW_root_Smp, IReference) *
 CW(GetReference)
 (
     CW() * self,
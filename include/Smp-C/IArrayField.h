@@ -38,19 +38,19 @@ typedef void CW(IArrayField);
 #endif /* CW_root_Smp_IArrayField */
 #define CW_SPACE CW_root_Smp_IArrayField
 
-void
+CW_THUNK void
 CW(_IArrayField)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt64)
+CW_THUNK CW(CW_root_Smp, UInt64)
 CW(GetSize)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(GetItem)
 (
     CW() * self,
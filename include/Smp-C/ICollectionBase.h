@@ -37,7 +37,7 @@ typedef void CW(ICollectionBase);
 #endif /* CW_root_Smp_ICollectionBase */
 #define CW_SPACE CW_root_Smp_ICollectionBase
 
-void
+CW_THUNK void
 CW(_ICollectionBase)
 (
     CW() * self
@@ -78,26 +78,26 @@ typedef void CW(IComponent);
 #endif /* CW_root_Smp_IComponent */
 #define CW_SPACE CW_root_Smp_IComponent
 
-void
+CW_THUNK void
 CW(_IComponent)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, ComponentStateKind)
+CW_THUNK CW(CW_root_Smp, ComponentStateKind)
 CW(GetState)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Publish)
 (
     CW() * self,
     CW(CW_root_Smp, IPublication) * receiver
 );
 
-void
+CW_THUNK void
 CW(Configure)
 (
     CW() * self,
@@ -105,27 +105,27 @@ CW(Configure)
     CW(CW_root_Smp_Services, ILinkRegistry) * linkRegistry
 );
 
-void
+CW_THUNK void
 CW(Connect)
 (
     CW() * self,
     CW(CW_root_Smp, ISimulator) * simulator
 );
 
-void
+CW_THUNK void
 CW(Disconnect)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(GetField)
 (
     CW() * self,
     CW(CW_root_Smp, String8) fullName
 );
 
-const CW(CW_root_Smp, FieldCollection) *
+CW_THUNK const CW(CW_root_Smp, FieldCollection) *
 CW(GetFields)
 (
     CW() * self
@@ -133,9 +133,15 @@ CW(GetFields)
 
 /* Error while processing function "GetUuid" at Smp/IComponent.h:159:34 (exported to Smp-C/IComponent.h) : Reference type is not supported: const Smp::Uuid & */
 
-/* Error while processing function "GetSimpleValue" at Smp/IComponent.h:177:32 (exported to Smp-C/IComponent.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetSimpleValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) fullName,
+    CW(CW_root_Smp, AnySimple) * value
+);
 
-void
+CW_THUNK void
 CW(SetSimpleValue)
 (
     CW() * self,
@@ -143,7 +149,7 @@ CW(SetSimpleValue)
     CW(CW_root_Smp, AnySimple) * value
 );
 
-void
+CW_THUNK void
 CW(GetSimpleArrayValue)
 (
     CW() * self,
@@ -153,7 +159,7 @@ CW(GetSimpleArrayValue)
     CW(CW_root_Smp, UInt64) startIndex
 );
 
-void
+CW_THUNK void
 CW(SetSimpleArrayValue)
 (
     CW() * self,
@@ -163,7 +169,7 @@ CW(SetSimpleArrayValue)
     CW(CW_root_Smp, UInt64) startIndex
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(AddChild)
 (
     CW() * self,
@@ -171,7 +177,7 @@ CW(AddChild)
     const CW(CW_root_Smp, ICollectionBase) * collection
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(RemoveChild)
 (
     CW() * self,
@@ -179,7 +185,7 @@ CW(RemoveChild)
     const CW(CW_root_Smp, ICollectionBase) * collection
 );
 
-CW(CW_root_Smp, IObject) *
+CW_THUNK CW(CW_root_Smp, IObject) *
 CW(IsChildInCollection)
 (
     CW() * self,
@@ -0,0 +1,308 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ICOMPONENT_INL
+#define CWRAPPER_ICOMPONENT_INL
+
+#include "Smp-C/IComponent.h"
+#include <Smp/IComponent.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IComponent ### */
+#define CW_SPACE CW_root_Smp_IComponent
+
+CW_THUNK void
+CW(_IComponent)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->~IComponent(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, ComponentStateKind)
+CW(GetState)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, ComponentStateKind)>(
+        static_cast<Smp::IComponent *>(self)->GetState(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(Publish)
+(
+    CW() * self,
+    CW(CW_root_Smp, IPublication) * receiver
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->Publish(
+            static_cast<Smp::IPublication *>(receiver)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Configure)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, ILogger) * logger,
+    CW(CW_root_Smp_Services, ILinkRegistry) * linkRegistry
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->Configure(
+            static_cast<Smp::Services::ILogger *>(logger),
+            static_cast<Smp::Services::ILinkRegistry *>(linkRegistry)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Connect)
+(
+    CW() * self,
+    CW(CW_root_Smp, ISimulator) * simulator
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->Connect(
+            static_cast<Smp::ISimulator *>(simulator)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Disconnect)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->Disconnect(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, IField) *
+CW(GetField)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) fullName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IField) *>(
+        static_cast<Smp::IComponent *>(self)->GetField(
+            static_cast<Smp::String8>(fullName)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, FieldCollection) *
+CW(GetFields)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, FieldCollection) *>(
+        static_cast<Smp::IComponent *>(self)->GetFields(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "GetUuid" at Smp/IComponent.h:159:34 (exported to Smp-C/IComponent.h) : Reference type is not supported: const Smp::Uuid & */
+
+CW_THUNK void
+CW(GetSimpleValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) fullName,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple*>(value) =
+        static_cast<Smp::IComponent *>(self)->GetSimpleValue(
+            static_cast<Smp::String8>(fullName)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetSimpleValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) fullName,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->SetSimpleValue(
+            static_cast<Smp::String8>(fullName),
+            *reinterpret_cast<Smp::AnySimple*>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetSimpleArrayValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) fullName,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, AnySimple) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->GetSimpleArrayValue(
+            static_cast<Smp::String8>(fullName),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::AnySimple *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetSimpleArrayValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) fullName,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, AnySimpleArray) values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        static_cast<Smp::IComponent *>(self)->SetSimpleArrayValue(
+            static_cast<Smp::String8>(fullName),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::AnySimpleArray>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(AddChild)
+(
+    CW() * self,
+    CW(CW_root_Smp, IObject) * child,
+    const CW(CW_root_Smp, ICollectionBase) * collection
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IComponent *>(self)->AddChild(
+            static_cast<Smp::IObject *>(child),
+            static_cast<const Smp::ICollectionBase *>(collection)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(RemoveChild)
+(
+    CW() * self,
+    CW(CW_root_Smp, IObject) * child,
+    const CW(CW_root_Smp, ICollectionBase) * collection
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IComponent *>(self)->RemoveChild(
+            static_cast<Smp::IObject *>(child),
+            static_cast<const Smp::ICollectionBase *>(collection)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IObject) *
+CW(IsChildInCollection)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) child,
+    const CW(CW_root_Smp, ICollectionBase) * collection
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IObject) *>(
+        static_cast<Smp::IComponent *>(self)->IsChildInCollection(
+            static_cast<Smp::String8>(child),
+            static_cast<const Smp::ICollectionBase *>(collection)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IComponent" at Smp/IComponent.h:61:11 (exported to Smp-C/IComponent.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IComponent.h:61:11 (exported to Smp-C/IComponent.h) : Reference type is not supported: IComponent & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ICOMPONENT_INL */
@@ -41,19 +41,19 @@ typedef void CW(IComposite);
 #endif /* CW_root_Smp_IComposite */
 #define CW_SPACE CW_root_Smp_IComposite
 
-void
+CW_THUNK void
 CW(_IComposite)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, ContainerCollection) *
+CW_THUNK const CW(CW_root_Smp, ContainerCollection) *
 CW(GetContainers)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IContainer) *
+CW_THUNK CW(CW_root_Smp, IContainer) *
 CW(GetContainer)
 (
     CW() * self,
@@ -0,0 +1,86 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ICOMPOSITE_INL
+#define CWRAPPER_ICOMPOSITE_INL
+
+#include "Smp-C/IComposite.h"
+#include <Smp/IComposite.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IComposite ### */
+#define CW_SPACE CW_root_Smp_IComposite
+
+CW_THUNK void
+CW(_IComposite)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IComposite *>(self)->~IComposite(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, ContainerCollection) *
+CW(GetContainers)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, ContainerCollection) *>(
+        static_cast<Smp::IComposite *>(self)->GetContainers(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IContainer) *
+CW(GetContainer)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IContainer) *>(
+        static_cast<Smp::IComposite *>(self)->GetContainer(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IComposite" at Smp/./IComposite.h:43:11 (exported to Smp-C/IComposite.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./IComposite.h:43:11 (exported to Smp-C/IComposite.h) : Reference type is not supported: IComposite & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ICOMPOSITE_INL */
@@ -47,52 +47,52 @@ typedef void CW(IContainer);
 #endif /* CW_root_Smp_IContainer */
 #define CW_SPACE CW_root_Smp_IContainer
 
-void
+CW_THUNK void
 CW(_IContainer)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, ComponentCollection) *
+CW_THUNK const CW(CW_root_Smp, ComponentCollection) *
 CW(GetComponents)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IComponent) *
+CW_THUNK CW(CW_root_Smp, IComponent) *
 CW(GetComponent)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-void
+CW_THUNK void
 CW(AddComponent)
 (
     CW() * self,
     CW(CW_root_Smp, IComponent) * component
 );
 
-void
+CW_THUNK void
 CW(DeleteComponent)
 (
     CW() * self,
     CW(CW_root_Smp, IComponent) * component
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetCount)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetUpper)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetLower)
 (
     CW() * self
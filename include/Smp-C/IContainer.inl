@@ -0,0 +1,161 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ICONTAINER_INL
+#define CWRAPPER_ICONTAINER_INL
+
+#include "Smp-C/IContainer.h"
+#include <Smp/IContainer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IContainer ### */
+#define CW_SPACE CW_root_Smp_IContainer
+
+CW_THUNK void
+CW(_IContainer)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IContainer *>(self)->~IContainer(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, ComponentCollection) *
+CW(GetComponents)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, ComponentCollection) *>(
+        static_cast<Smp::IContainer *>(self)->GetComponents(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IComponent) *
+CW(GetComponent)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IComponent) *>(
+        static_cast<Smp::IContainer *>(self)->GetComponent(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(AddComponent)
+(
+    CW() * self,
+    CW(CW_root_Smp, IComponent) * component
+) {
+    try {
+        static_cast<Smp::IContainer *>(self)->AddComponent(
+            static_cast<Smp::IComponent *>(component)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(DeleteComponent)
+(
+    CW() * self,
+    CW(CW_root_Smp, IComponent) * component
+) {
+    try {
+        static_cast<Smp::IContainer *>(self)->DeleteComponent(
+            static_cast<Smp::IComponent *>(component)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetCount)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::IContainer *>(self)->GetCount(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetUpper)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::IContainer *>(self)->GetUpper(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetLower)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::IContainer *>(self)->GetLower(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IContainer" at Smp/IContainer.h:47:11 (exported to Smp-C/IContainer.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IContainer.h:47:11 (exported to Smp-C/IContainer.h) : Reference type is not supported: IContainer & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ICONTAINER_INL */
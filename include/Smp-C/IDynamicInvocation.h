@@ -49,40 +49,40 @@ typedef void CW(IDynamicInvocation);
 #endif /* CW_root_Smp_IDynamicInvocation */
 #define CW_SPACE CW_root_Smp_IDynamicInvocation
 
-void
+CW_THUNK void
 CW(_IDynamicInvocation)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Invoke)
 (
     CW() * self,
     CW(CW_root_Smp, IRequest) * request
 );
 
-CW(CW_root_Smp, IProperty) *
+CW_THUNK CW(CW_root_Smp, IProperty) *
 CW(GetProperty)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-const CW(CW_root_Smp, PropertyCollection) *
+CW_THUNK const CW(CW_root_Smp, PropertyCollection) *
 CW(GetProperties)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IOperation) *
+CW_THUNK CW(CW_root_Smp, IOperation) *
 CW(GetOperation)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-const CW(CW_root_Smp, OperationCollection) *
+CW_THUNK const CW(CW_root_Smp, OperationCollection) *
 CW(GetOperations)
 (
     CW() * self
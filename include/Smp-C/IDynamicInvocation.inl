@@ -0,0 +1,133 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IDYNAMICINVOCATION_INL
+#define CWRAPPER_IDYNAMICINVOCATION_INL
+
+#include "Smp-C/IDynamicInvocation.h"
+#include <Smp/IDynamicInvocation.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IDynamicInvocation ### */
+#define CW_SPACE CW_root_Smp_IDynamicInvocation
+
+CW_THUNK void
+CW(_IDynamicInvocation)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IDynamicInvocation *>(self)->~IDynamicInvocation(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Invoke)
+(
+    CW() * self,
+    CW(CW_root_Smp, IRequest) * request
+) {
+    try {
+        static_cast<Smp::IDynamicInvocation *>(self)->Invoke(
+            static_cast<Smp::IRequest *>(request)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, IProperty) *
+CW(GetProperty)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IProperty) *>(
+        static_cast<Smp::IDynamicInvocation *>(self)->GetProperty(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, PropertyCollection) *
+CW(GetProperties)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, PropertyCollection) *>(
+        static_cast<Smp::IDynamicInvocation *>(self)->GetProperties(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IOperation) *
+CW(GetOperation)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IOperation) *>(
+        static_cast<Smp::IDynamicInvocation *>(self)->GetOperation(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, OperationCollection) *
+CW(GetOperations)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, OperationCollection) *>(
+        static_cast<Smp::IDynamicInvocation *>(self)->GetOperations(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IDynamicInvocation" at Smp/./IDynamicInvocation.h:48:11 (exported to Smp-C/IDynamicInvocation.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./IDynamicInvocation.h:48:11 (exported to Smp-C/IDynamicInvocation.h) : Reference type is not supported: IDynamicInvocation & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IDYNAMICINVOCATION_INL */
@@ -37,13 +37,13 @@ typedef void CW(IEntryPoint);
 #endif /* CW_root_Smp_IEntryPoint */
 #define CW_SPACE CW_root_Smp_IEntryPoint
 
-void
+CW_THUNK void
 CW(_IEntryPoint)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Execute)
 (
     CW() * self
@@ -41,19 +41,19 @@ typedef void CW(IEntryPointPublisher);
 #endif /* CW_root_Smp_IEntryPointPublisher */
 #define CW_SPACE CW_root_Smp_IEntryPointPublisher
 
-void
+CW_THUNK void
 CW(_IEntryPointPublisher)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, EntryPointCollection) *
+CW_THUNK const CW(CW_root_Smp, EntryPointCollection) *
 CW(GetEntryPoints)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IEntryPoint) *
+CW_THUNK CW(CW_root_Smp, IEntryPoint) *
 CW(GetEntryPoint)
 (
     CW() * self,
@@ -41,19 +41,19 @@ typedef void CW(IEventConsumer);
 #endif /* CW_root_Smp_IEventConsumer */
 #define CW_SPACE CW_root_Smp_IEventConsumer
 
-void
+CW_THUNK void
 CW(_IEventConsumer)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, EventSinkCollection) *
+CW_THUNK const CW(CW_root_Smp, EventSinkCollection) *
 CW(GetEventSinks)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IEventSink) *
+CW_THUNK CW(CW_root_Smp, IEventSink) *
 CW(GetEventSink)
 (
     CW() * self,
@@ -41,19 +41,19 @@ typedef void CW(IEventProvider);
 #endif /* CW_root_Smp_IEventProvider */
 #define CW_SPACE CW_root_Smp_IEventProvider
 
-void
+CW_THUNK void
 CW(_IEventProvider)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, EventSourceCollection) *
+CW_THUNK const CW(CW_root_Smp, EventSourceCollection) *
 CW(GetEventSources)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IEventSource) *
+CW_THUNK CW(CW_root_Smp, IEventSource) *
 CW(GetEventSource)
 (
     CW() * self,
@@ -39,19 +39,19 @@ typedef void CW(IEventSink);
 #endif /* CW_root_Smp_IEventSink */
 #define CW_SPACE CW_root_Smp_IEventSink
 
-void
+CW_THUNK void
 CW(_IEventSink)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetEventArgType)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Notify)
 (
     CW() * self,
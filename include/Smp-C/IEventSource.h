@@ -44,33 +44,33 @@ typedef void CW(IEventSource);
 #endif /* CW_root_Smp_IEventSource */
 #define CW_SPACE CW_root_Smp_IEventSource
 
-void
+CW_THUNK void
 CW(_IEventSource)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Subscribe)
 (
     CW() * self,
     CW(CW_root_Smp, IEventSink) * eventSink
 );
 
-void
+CW_THUNK void
 CW(Unsubscribe)
 (
     CW() * self,
     CW(CW_root_Smp, IEventSink) * eventSink
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetEventArgType)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, EventSinkCollection) *
+CW_THUNK const CW(CW_root_Smp, EventSinkCollection) *
 CW(GetEventSinks)
 (
     CW() * self
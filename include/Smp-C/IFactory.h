@@ -44,21 +44,26 @@ typedef void CW(IFactory);
 #endif /* CW_root_Smp_IFactory */
 #define CW_SPACE CW_root_Smp_IFactory
 
-void
+CW_THUNK void
 CW(_IFactory)
 (
     CW() * self
 );
 
-/* Error while processing function "GetUuid" at Smp/IFactory.h:50:27 (exported to Smp-C/IFactory.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetUuid)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid
+);
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetTypeName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IComponent) *
+CW_THUNK CW(CW_root_Smp, IComponent) *
 CW(CreateInstance)
 (
     CW() * self,
@@ -67,7 +72,7 @@ CW(CreateInstance)
     CW(CW_root_Smp, IComposite) * parent
 );
 
-void
+CW_THUNK void
 CW(DeleteInstance)
 (
     CW() * self,
@@ -0,0 +1,120 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IFACTORY_INL
+#define CWRAPPER_IFACTORY_INL
+
+#include "Smp-C/IFactory.h"
+#include <Smp/IFactory.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IFactory ### */
+#define CW_SPACE CW_root_Smp_IFactory
+
+CW_THUNK void
+CW(_IFactory)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IFactory *>(self)->~IFactory(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetUuid)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid
+) {
+    try {
+        *reinterpret_cast<Smp::Uuid*>(uuid) =
+        static_cast<Smp::IFactory *>(self)->GetUuid(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetTypeName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::IFactory *>(self)->GetTypeName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IComponent) *
+CW(CreateInstance)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, IComposite) * parent
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IComponent) *>(
+        static_cast<Smp::IFactory *>(self)->CreateInstance(
+            static_cast<Smp::String8>(name),
+            static_cast<Smp::String8>(description),
+            static_cast<Smp::IComposite *>(parent)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(DeleteInstance)
+(
+    CW() * self,
+    CW(CW_root_Smp, IComponent) * instance
+) {
+    try {
+        static_cast<Smp::IFactory *>(self)->DeleteInstance(
+            static_cast<Smp::IComponent *>(instance)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "IFactory" at Smp/IFactory.h:40:11 (exported to Smp-C/IFactory.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IFactory.h:40:11 (exported to Smp-C/IFactory.h) : Reference type is not supported: IFactory & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IFACTORY_INL */
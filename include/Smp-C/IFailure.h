@@ -38,25 +38,25 @@ typedef void CW(IFailure);
 #endif /* CW_root_Smp_IFailure */
 #define CW_SPACE CW_root_Smp_IFailure
 
-void
+CW_THUNK void
 CW(_IFailure)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Fail)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Unfail)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsFailed)
 (
     CW() * self
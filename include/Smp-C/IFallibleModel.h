@@ -41,25 +41,25 @@ typedef void CW(IFallibleModel);
 #endif /* CW_root_Smp_IFallibleModel */
 #define CW_SPACE CW_root_Smp_IFallibleModel
 
-void
+CW_THUNK void
 CW(_IFallibleModel)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsFailed)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, FailureCollection) *
+CW_THUNK const CW(CW_root_Smp, FailureCollection) *
 CW(GetFailures)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IFailure) *
+CW_THUNK CW(CW_root_Smp, IFailure) *
 CW(GetFailure)
 (
     CW() * self,
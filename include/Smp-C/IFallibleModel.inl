@@ -0,0 +1,101 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IFALLIBLEMODEL_INL
+#define CWRAPPER_IFALLIBLEMODEL_INL
+
+#include "Smp-C/IFallibleModel.h"
+#include <Smp/IFallibleModel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IFallibleModel ### */
+#define CW_SPACE CW_root_Smp_IFallibleModel
+
+CW_THUNK void
+CW(_IFallibleModel)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IFallibleModel *>(self)->~IFallibleModel(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(IsFailed)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IFallibleModel *>(self)->IsFailed(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, FailureCollection) *
+CW(GetFailures)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, FailureCollection) *>(
+        static_cast<Smp::IFallibleModel *>(self)->GetFailures(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IFailure) *
+CW(GetFailure)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IFailure) *>(
+        static_cast<Smp::IFallibleModel *>(self)->GetFailure(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IFallibleModel" at Smp/./IFallibleModel.h:43:11 (exported to Smp-C/IFallibleModel.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./IFallibleModel.h:43:11 (exported to Smp-C/IFallibleModel.h) : Reference type is not supported: IFallibleModel & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IFALLIBLEMODEL_INL */
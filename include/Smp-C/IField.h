@@ -59,37 +59,37 @@ typedef void CW(IField);
 #endif /* CW_root_Smp_IField */
 #define CW_SPACE CW_root_Smp_IField
 
-void
+CW_THUNK void
 CW(_IField)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, ViewKind)
+CW_THUNK CW(CW_root_Smp, ViewKind)
 CW(GetView)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsState)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsInput)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsOutput)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp_Publication, IType) *
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
 CW(GetType)
 (
     CW() * self
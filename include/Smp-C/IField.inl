@@ -0,0 +1,141 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IFIELD_INL
+#define CWRAPPER_IFIELD_INL
+
+#include "Smp-C/IField.h"
+#include <Smp/IField.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication ### */
+#define CW_SPACE CW_root_Smp_Publication
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IField ### */
+#define CW_SPACE CW_root_Smp_IField
+
+CW_THUNK void
+CW(_IField)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IField *>(self)->~IField(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, ViewKind)
+CW(GetView)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, ViewKind)>(
+        static_cast<Smp::IField *>(self)->GetView(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(IsState)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IField *>(self)->IsState(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(IsInput)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IField *>(self)->IsInput(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(IsOutput)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IField *>(self)->IsOutput(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
+CW(GetType)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp_Publication, IType) *>(
+        static_cast<Smp::IField *>(self)->GetType(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IField" at Smp/IField.h:42:11 (exported to Smp-C/IField.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IField.h:42:11 (exported to Smp-C/IField.h) : Reference type is not supported: IField & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IFIELD_INL */
@@ -40,32 +40,32 @@ typedef void CW(IForcibleField);
 #endif /* CW_root_Smp_IForcibleField */
 #define CW_SPACE CW_root_Smp_IForcibleField
 
-void
+CW_THUNK void
 CW(_IForcibleField)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Force)
 (
     CW() * self,
     CW(CW_root_Smp, AnySimple) * value
 );
 
-void
+CW_THUNK void
 CW(Unforce)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsForced)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Freeze)
 (
     CW() * self
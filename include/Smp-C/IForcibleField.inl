@@ -0,0 +1,110 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IFORCIBLEFIELD_INL
+#define CWRAPPER_IFORCIBLEFIELD_INL
+
+#include "Smp-C/IForcibleField.h"
+#include <Smp/IForcibleField.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IForcibleField ### */
+#define CW_SPACE CW_root_Smp_IForcibleField
+
+CW_THUNK void
+CW(_IForcibleField)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IForcibleField *>(self)->~IForcibleField(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Force)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        static_cast<Smp::IForcibleField *>(self)->Force(
+            *reinterpret_cast<Smp::AnySimple*>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Unforce)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IForcibleField *>(self)->Unforce(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(IsForced)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IForcibleField *>(self)->IsForced(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(Freeze)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IForcibleField *>(self)->Freeze(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "IForcibleField" at Smp/./IForcibleField.h:30:11 (exported to Smp-C/IForcibleField.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./IForcibleField.h:30:11 (exported to Smp-C/IForcibleField.h) : Reference type is not supported: IForcibleField & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IFORCIBLEFIELD_INL */
@@ -37,13 +37,13 @@ typedef void CW(ILinkingComponent);
 #endif /* CW_root_Smp_ILinkingComponent */
 #define CW_SPACE CW_root_Smp_ILinkingComponent
 
-void
+CW_THUNK void
 CW(_ILinkingComponent)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(RemoveLinks)
 (
     CW() * self,
@@ -37,7 +37,7 @@ typedef void CW(IModel);
 #endif /* CW_root_Smp_IModel */
 #define CW_SPACE CW_root_Smp_IModel
 
-void
+CW_THUNK void
 CW(_IModel)
 (
     CW() * self
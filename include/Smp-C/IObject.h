@@ -37,31 +37,31 @@ typedef void CW(IObject);
 #endif /* CW_root_Smp_IObject */
 #define CW_SPACE CW_root_Smp_IObject
 
-void
+CW_THUNK void
 CW(_IObject)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetDescription)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IObject) *
+CW_THUNK CW(CW_root_Smp, IObject) *
 CW(GetParent)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IObject) *
+CW_THUNK CW(CW_root_Smp, IObject) *
 CW(GetChild)
 (
     CW() * self,
@@ -47,51 +47,51 @@ typedef void CW(IOperation);
 #endif /* CW_root_Smp_IOperation */
 #define CW_SPACE CW_root_Smp_IOperation
 
-void
+CW_THUNK void
 CW(_IOperation)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, ParameterCollection) *
+CW_THUNK const CW(CW_root_Smp, ParameterCollection) *
 CW(GetParameters)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IParameter) *
+CW_THUNK CW(CW_root_Smp, IParameter) *
 CW(GetParameter)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-CW(CW_root_Smp, IParameter) *
+CW_THUNK CW(CW_root_Smp, IParameter) *
 CW(GetReturnParameter)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, ViewKind)
+CW_THUNK CW(CW_root_Smp, ViewKind)
 CW(GetView)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IRequest) *
+CW_THUNK CW(CW_root_Smp, IRequest) *
 CW(CreateRequest)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Invoke)
 (
     CW() * self,
     CW(CW_root_Smp, IRequest) * request
 );
 
-void
+CW_THUNK void
 CW(DeleteRequest)
 (
     CW() * self,
@@ -0,0 +1,161 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IOPERATION_INL
+#define CWRAPPER_IOPERATION_INL
+
+#include "Smp-C/IOperation.h"
+#include <Smp/IOperation.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IOperation ### */
+#define CW_SPACE CW_root_Smp_IOperation
+
+CW_THUNK void
+CW(_IOperation)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IOperation *>(self)->~IOperation(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, ParameterCollection) *
+CW(GetParameters)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, ParameterCollection) *>(
+        static_cast<Smp::IOperation *>(self)->GetParameters(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IParameter) *
+CW(GetParameter)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IParameter) *>(
+        static_cast<Smp::IOperation *>(self)->GetParameter(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IParameter) *
+CW(GetReturnParameter)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IParameter) *>(
+        static_cast<Smp::IOperation *>(self)->GetReturnParameter(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, ViewKind)
+CW(GetView)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, ViewKind)>(
+        static_cast<Smp::IOperation *>(self)->GetView(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IRequest) *
+CW(CreateRequest)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IRequest) *>(
+        static_cast<Smp::IOperation *>(self)->CreateRequest(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(Invoke)
+(
+    CW() * self,
+    CW(CW_root_Smp, IRequest) * request
+) {
+    try {
+        static_cast<Smp::IOperation *>(self)->Invoke(
+            static_cast<Smp::IRequest *>(request)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(DeleteRequest)
+(
+    CW() * self,
+    CW(CW_root_Smp, IRequest) * request
+) {
+    try {
+        static_cast<Smp::IOperation *>(self)->DeleteRequest(
+            static_cast<Smp::IRequest *>(request)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "IOperation" at Smp/IOperation.h:43:11 (exported to Smp-C/IOperation.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IOperation.h:43:11 (exported to Smp-C/IOperation.h) : Reference type is not supported: IOperation & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IOPERATION_INL */
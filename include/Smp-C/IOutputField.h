@@ -42,39 +42,39 @@ typedef void CW(IOutputField);
 #endif /* CW_root_Smp_IOutputField */
 #define CW_SPACE CW_root_Smp_IOutputField
 
-void
+CW_THUNK void
 CW(_IOutputField)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Connect)
 (
     CW() * self,
     CW(CW_root_Smp, IField) * target
 );
 
-void
+CW_THUNK void
 CW(Disconnect)
 (
     CW() * self,
     CW(CW_root_Smp, IField) * target
 );
 
-void
+CW_THUNK void
 CW(Push)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, FieldCollection) *
+CW_THUNK const CW(CW_root_Smp, FieldCollection) *
 CW(GetInputFields)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsAutomatic)
 (
     CW() * self
@@ -0,0 +1,127 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IOUTPUTFIELD_INL
+#define CWRAPPER_IOUTPUTFIELD_INL
+
+#include "Smp-C/IOutputField.h"
+#include <Smp/IOutputField.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IOutputField ### */
+#define CW_SPACE CW_root_Smp_IOutputField
+
+CW_THUNK void
+CW(_IOutputField)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IOutputField *>(self)->~IOutputField(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Connect)
+(
+    CW() * self,
+    CW(CW_root_Smp, IField) * target
+) {
+    try {
+        static_cast<Smp::IOutputField *>(self)->Connect(
+            static_cast<Smp::IField *>(target)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Disconnect)
+(
+    CW() * self,
+    CW(CW_root_Smp, IField) * target
+) {
+    try {
+        static_cast<Smp::IOutputField *>(self)->Disconnect(
+            static_cast<Smp::IField *>(target)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Push)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IOutputField *>(self)->Push(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, FieldCollection) *
+CW(GetInputFields)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, FieldCollection) *>(
+        static_cast<Smp::IOutputField *>(self)->GetInputFields(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(IsAutomatic)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::IOutputField *>(self)->IsAutomatic(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IOutputField" at Smp/./IOutputField.h:33:11 (exported to Smp-C/IOutputField.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./IOutputField.h:33:11 (exported to Smp-C/IOutputField.h) : Reference type is not supported: IOutputField & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IOUTPUTFIELD_INL */
@@ -58,19 +58,19 @@ typedef void CW(IParameter);
 #endif /* CW_root_Smp_IParameter */
 #define CW_SPACE CW_root_Smp_IParameter
 
-void
+CW_THUNK void
 CW(_IParameter)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp_Publication, IType) *
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
 CW(GetType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Publication, ParameterDirectionKind)
+CW_THUNK CW(CW_root_Smp_Publication, ParameterDirectionKind)
 CW(GetDirection)
 (
     CW() * self
@@ -43,20 +43,20 @@ typedef void CW(IPersist);
 #endif /* CW_root_Smp_IPersist */
 #define CW_SPACE CW_root_Smp_IPersist
 
-void
+CW_THUNK void
 CW(_IPersist)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Restore)
 (
     CW() * self,
     CW(CW_root_Smp, IStorageReader) * reader
 );
 
-void
+CW_THUNK void
 CW(Store)
 (
     CW() * self,
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IPERSIST_INL
+#define CWRAPPER_IPERSIST_INL
+
+#include "Smp-C/IPersist.h"
+#include <Smp/IPersist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IPersist ### */
+#define CW_SPACE CW_root_Smp_IPersist
+
+CW_THUNK void
+CW(_IPersist)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IPersist *>(self)->~IPersist(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Restore)
+(
+    CW() * self,
+    CW(CW_root_Smp, IStorageReader) * reader
+) {
+    try {
+        static_cast<Smp::IPersist *>(self)->Restore(
+            static_cast<Smp::IStorageReader *>(reader)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Store)
+(
+    CW() * self,
+    CW(CW_root_Smp, IStorageWriter) * writer
+) {
+    try {
+        static_cast<Smp::IPersist *>(self)->Store(
+            static_cast<Smp::IStorageWriter *>(writer)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "IPersist" at Smp/IPersist.h:43:11 (exported to Smp-C/IPersist.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IPersist.h:43:11 (exported to Smp-C/IPersist.h) : Reference type is not supported: IPersist & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IPERSIST_INL */
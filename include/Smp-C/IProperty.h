@@ -63,40 +63,45 @@ typedef void CW(IProperty);
 #endif /* CW_root_Smp_IProperty */
 #define CW_SPACE CW_root_Smp_IProperty
 
-void
+CW_THUNK void
 CW(_IProperty)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp_Publication, IType) *
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
 CW(GetType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, AccessKind)
+CW_THUNK CW(CW_root_Smp, AccessKind)
 CW(GetAccess)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, ViewKind)
+CW_THUNK CW(CW_root_Smp, ViewKind)
 CW(GetView)
 (
     CW() * self
 );
 
-/* Error while processing function "GetValue" at Smp/IProperty.h:69:32 (exported to Smp-C/IProperty.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+);
 
-void
+CW_THUNK void
 CW(SetValue)
 (
     CW() * self,
     CW(CW_root_Smp, AnySimple) * value
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetPrimitiveTypeKind)
 (
     CW() * self
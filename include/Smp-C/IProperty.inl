@@ -0,0 +1,156 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IPROPERTY_INL
+#define CWRAPPER_IPROPERTY_INL
+
+#include "Smp-C/IProperty.h"
+#include <Smp/IProperty.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication ### */
+#define CW_SPACE CW_root_Smp_Publication
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IProperty ### */
+#define CW_SPACE CW_root_Smp_IProperty
+
+CW_THUNK void
+CW(_IProperty)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IProperty *>(self)->~IProperty(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
+CW(GetType)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp_Publication, IType) *>(
+        static_cast<Smp::IProperty *>(self)->GetType(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, AccessKind)
+CW(GetAccess)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, AccessKind)>(
+        static_cast<Smp::IProperty *>(self)->GetAccess(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, ViewKind)
+CW(GetView)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, ViewKind)>(
+        static_cast<Smp::IProperty *>(self)->GetView(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(GetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple*>(value) =
+        static_cast<Smp::IProperty *>(self)->GetValue(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        static_cast<Smp::IProperty *>(self)->SetValue(
+            *reinterpret_cast<Smp::AnySimple*>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
+CW(GetPrimitiveTypeKind)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(
+        static_cast<Smp::IProperty *>(self)->GetPrimitiveTypeKind(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IProperty" at Smp/IProperty.h:46:11 (exported to Smp-C/IProperty.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IProperty.h:46:11 (exported to Smp-C/IProperty.h) : Reference type is not supported: IProperty & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IPROPERTY_INL */
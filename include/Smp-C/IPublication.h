@@ -74,13 +74,13 @@ typedef void CW(IPublication);
 #endif /* CW_root_Smp_IPublication */
 #define CW_SPACE CW_root_Smp_IPublication
 
-void
+CW_THUNK void
 CW(_IPublication)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Publication, IPublishOperation) *
+CW_THUNK CW(CW_root_Smp_Publication, IPublishOperation) *
 CW(PublishOperationRaw)
 (
     CW() * self,
@@ -89,14 +89,14 @@ CW(PublishOperationRaw)
     CW(CW_root_Smp, ViewKind) view
 );
 
-void
+CW_THUNK void
 CW(PublishOperation)
 (
     CW() * self,
     CW(CW_root_Smp, IOperation) * operation
 );
 
-CW(CW_root_Smp, IProperty) *
+CW_THUNK CW(CW_root_Smp, IProperty) *
 CW(PublishPropertyRaw)
 (
     CW() * self,
@@ -107,46 +107,46 @@ CW(PublishPropertyRaw)
     CW(CW_root_Smp, ViewKind) view
 );
 
-void
+CW_THUNK void
 CW(PublishProperty)
 (
     CW() * self,
     CW(CW_root_Smp, IProperty) * property
 );
 
-CW(CW_root_Smp, IProperty) *
+CW_THUNK CW(CW_root_Smp, IProperty) *
 CW(GetProperty)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-const CW(CW_root_Smp, PropertyCollection) *
+CW_THUNK const CW(CW_root_Smp, PropertyCollection) *
 CW(GetProperties)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IOperation) *
+CW_THUNK CW(CW_root_Smp, IOperation) *
 CW(GetOperation)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-const CW(CW_root_Smp, OperationCollection) *
+CW_THUNK const CW(CW_root_Smp, OperationCollection) *
 CW(GetOperations)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Publication, ITypeRegistry) *
+CW_THUNK CW(CW_root_Smp_Publication, ITypeRegistry) *
 CW(GetTypeRegistry)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Unpublish)
 (
     CW() * self
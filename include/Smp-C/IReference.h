@@ -45,52 +45,52 @@ typedef void CW(IReference);
 #endif /* CW_root_Smp_IReference */
 #define CW_SPACE CW_root_Smp_IReference
 
-void
+CW_THUNK void
 CW(_IReference)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, ComponentCollection) *
+CW_THUNK const CW(CW_root_Smp, ComponentCollection) *
 CW(GetComponents)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IComponent) *
+CW_THUNK CW(CW_root_Smp, IComponent) *
 CW(GetComponent)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-void
+CW_THUNK void
 CW(AddComponent)
 (
     CW() * self,
     CW(CW_root_Smp, IComponent) * component
 );
 
-void
+CW_THUNK void
 CW(RemoveComponent)
 (
     CW() * self,
     CW(CW_root_Smp, IComponent) * component
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetCount)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetUpper)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetLower)
 (
     CW() * self
@@ -0,0 +1,161 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IREFERENCE_INL
+#define CWRAPPER_IREFERENCE_INL
+
+#include "Smp-C/IReference.h"
+#include <Smp/IReference.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IReference ### */
+#define CW_SPACE CW_root_Smp_IReference
+
+CW_THUNK void
+CW(_IReference)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IReference *>(self)->~IReference(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, ComponentCollection) *
+CW(GetComponents)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, ComponentCollection) *>(
+        static_cast<Smp::IReference *>(self)->GetComponents(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IComponent) *
+CW(GetComponent)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IComponent) *>(
+        static_cast<Smp::IReference *>(self)->GetComponent(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(AddComponent)
+(
+    CW() * self,
+    CW(CW_root_Smp, IComponent) * component
+) {
+    try {
+        static_cast<Smp::IReference *>(self)->AddComponent(
+            static_cast<Smp::IComponent *>(component)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(RemoveComponent)
+(
+    CW() * self,
+    CW(CW_root_Smp, IComponent) * component
+) {
+    try {
+        static_cast<Smp::IReference *>(self)->RemoveComponent(
+            static_cast<Smp::IComponent *>(component)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetCount)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::IReference *>(self)->GetCount(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetUpper)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::IReference *>(self)->GetUpper(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetLower)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::IReference *>(self)->GetLower(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IReference" at Smp/IReference.h:45:11 (exported to Smp-C/IReference.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/IReference.h:45:11 (exported to Smp-C/IReference.h) : Reference type is not supported: IReference & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IREFERENCE_INL */
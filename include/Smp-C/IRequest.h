@@ -42,38 +42,38 @@ typedef void CW(IRequest);
 #endif /* CW_root_Smp_IRequest */
 #define CW_SPACE CW_root_Smp_IRequest
 
-void
+CW_THUNK void
 CW(_IRequest)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, RequestType)
+CW_THUNK CW(CW_root_Smp, RequestType)
 CW(GetType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(GetParameterCount)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(GetParameterIndex)
 (
     CW() * self,
     CW(CW_root_Smp, String8) parameterName
 );
 
-void
+CW_THUNK void
 CW(SetParameterValue)
 (
     CW() * self,
@@ -81,16 +81,27 @@ CW(SetParameterValue)
     CW(CW_root_Smp, AnySimple) * value
 );
 
-/* Error while processing function "GetParameterValue" at Smp/./IRequest.h:102:32 (exported to Smp-C/IRequest.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetParameterValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, Int32) index,
+    CW(CW_root_Smp, AnySimple) * value
+);
 
-void
+CW_THUNK void
 CW(SetReturnValue)
 (
     CW() * self,
     CW(CW_root_Smp, AnySimple) * value
 );
 
-/* Error while processing function "GetReturnValue" at Smp/./IRequest.h:120:32 (exported to Smp-C/IRequest.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetReturnValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+);
 
 /* Error while processing function "operator=" at Smp/./IRequest.h:34:11 (exported to Smp-C/IRequest.h) : Reference type is not supported: IRequest & */
 
@@ -0,0 +1,178 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IREQUEST_INL
+#define CWRAPPER_IREQUEST_INL
+
+#include "Smp-C/IRequest.h"
+#include <Smp/IRequest.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::IRequest ### */
+#define CW_SPACE CW_root_Smp_IRequest
+
+CW_THUNK void
+CW(_IRequest)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::IRequest *>(self)->~IRequest(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::IRequest *>(self)->GetName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, RequestType)
+CW(GetType)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, RequestType)>(
+        static_cast<Smp::IRequest *>(self)->GetType(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetParameterCount)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        static_cast<Smp::IRequest *>(self)->GetParameterCount(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetParameterIndex)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) parameterName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        static_cast<Smp::IRequest *>(self)->GetParameterIndex(
+            static_cast<Smp::String8>(parameterName)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(SetParameterValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, Int32) index,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        static_cast<Smp::IRequest *>(self)->SetParameterValue(
+            static_cast<Smp::Int32>(index),
+            *reinterpret_cast<Smp::AnySimple*>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetParameterValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, Int32) index,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple*>(value) =
+        static_cast<Smp::IRequest *>(self)->GetParameterValue(
+            static_cast<Smp::Int32>(index)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetReturnValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        static_cast<Smp::IRequest *>(self)->SetReturnValue(
+            *reinterpret_cast<Smp::AnySimple*>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetReturnValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple*>(value) =
+        static_cast<Smp::IRequest *>(self)->GetReturnValue(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "operator=" at Smp/./IRequest.h:34:11 (exported to Smp-C/IRequest.h) : Reference type is not supported: IRequest & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IREQUEST_INL */
@@ -37,7 +37,7 @@ typedef void CW(IService);
 #endif /* CW_root_Smp_IService */
 #define CW_SPACE CW_root_Smp_IService
 
-void
+CW_THUNK void
 CW(_IService)
 (
     CW() * self
@@ -43,21 +43,27 @@ typedef void CW(ISimpleArrayField);
 #endif /* CW_root_Smp_ISimpleArrayField */
 #define CW_SPACE CW_root_Smp_ISimpleArrayField
 
-void
+CW_THUNK void
 CW(_ISimpleArrayField)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt64)
+CW_THUNK CW(CW_root_Smp, UInt64)
 CW(GetSize)
 (
     CW() * self
 );
 
-/* Error while processing function "GetValue" at Smp/./ISimpleArrayField.h:50:32 (exported to Smp-C/ISimpleArrayField.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) index,
+    CW(CW_root_Smp, AnySimple) * value
+);
 
-void
+CW_THUNK void
 CW(SetValue)
 (
     CW() * self,
@@ -65,7 +71,7 @@ CW(SetValue)
     CW(CW_root_Smp, AnySimple) * value
 );
 
-void
+CW_THUNK void
 CW(GetValues)
 (
     CW() * self,
@@ -74,7 +80,7 @@ CW(GetValues)
     CW(CW_root_Smp, UInt64) startIndex
 );
 
-void
+CW_THUNK void
 CW(SetValues)
 (
     CW() * self,
@@ -83,6 +89,229 @@ CW(SetValues)
     CW(CW_root_Smp, UInt64) startIndex
 );
 
+/*
+ * Typed GetValues and SetValues: values holds length items of the C type.
+ * They copy the items in one call only from a field implementing
+ * CWraPPer::TypedArrayField (Smp-C/TypedArrayField.h) with the same item
+ * kind, such as the fields of the stand-in simulator; fields of an SMP
+ * implementation do not implement it and go through an AnySimple per item.
+ */
+CW_THUNK void
+CW(GetValuesBool)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Bool) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesChar8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Char8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesUInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesUInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesUInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesUInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesFloat32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Float32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(GetValuesFloat64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Float64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesBool)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Bool) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesChar8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Char8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesUInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesUInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesUInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesUInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesFloat32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Float32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
+CW_THUNK void
+CW(SetValuesFloat64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Float64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+);
+
 /* Error while processing function "ISimpleArrayField" at Smp/./ISimpleArrayField.h:33:11 (exported to Smp-C/ISimpleArrayField.h) : Skipping constructor */
 
 /* Error while processing function "operator=" at Smp/./ISimpleArrayField.h:33:11 (exported to Smp-C/ISimpleArrayField.h) : Reference type is not supported: ISimpleArrayField & */
@@ -0,0 +1,681 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ISIMPLEARRAYFIELD_INL
+#define CWRAPPER_ISIMPLEARRAYFIELD_INL
+
+#include "Smp-C/ISimpleArrayField.h"
+#include "Smp-C/TypedArrayField.h"
+#include <Smp/ISimpleArrayField.h>
+#include <algorithm>
+
+namespace {
+
+/* Number of AnySimple kept on the stack per bulk transfer */
+constexpr Smp::UInt64 ChunkLength = 256u;
+
+template <typename T, Smp::PrimitiveTypeKind Kind, T Smp::AnySimple::PrimitiveTypeValue::*Member>
+void GetValuesAs(Smp::ISimpleArrayField *field, Smp::UInt64 length, T *values, Smp::UInt64 startIndex) {
+    const CWraPPer::TypedArrayField *typed = dynamic_cast<const CWraPPer::TypedArrayField *>(field);
+    if (typed != nullptr && typed->GetItemKind() == Kind) {
+        /* same kind on both sides: no AnySimple at all */
+        typed->GetItems(length, values, startIndex);
+        return;
+    }
+    Smp::AnySimple chunk[ChunkLength];
+    for (Smp::UInt64 done = 0u; done < length;) {
+        const Smp::UInt64 count = std::min(length - done, ChunkLength);
+        field->GetValues(count, chunk, startIndex + done);
+        bool sameKind = true;
+        for (Smp::UInt64 i = 0u; i < count; ++i) {
+            sameKind &= (chunk[i].type == Kind);
+        }
+        T *out = values + done;
+        if (sameKind) {
+            /* kind checked once for the whole chunk: plain strided copy */
+            for (Smp::UInt64 i = 0u; i < count; ++i) {
+                out[i] = chunk[i].value.*Member;
+            }
+        } else {
+            for (Smp::UInt64 i = 0u; i < count; ++i) {
+                out[i] = static_cast<T>(chunk[i]);
+            }
+        }
+        done += count;
+    }
+}
+
+template <typename T, Smp::PrimitiveTypeKind Kind, T Smp::AnySimple::PrimitiveTypeValue::*Member>
+void SetValuesAs(Smp::ISimpleArrayField *field, Smp::UInt64 length, const T *values, Smp::UInt64 startIndex) {
+    CWraPPer::TypedArrayField *typed = dynamic_cast<CWraPPer::TypedArrayField *>(field);
+    if (typed != nullptr && typed->GetItemKind() == Kind) {
+        typed->SetItems(length, values, startIndex);
+        return;
+    }
+    Smp::AnySimple chunk[ChunkLength];
+    for (Smp::UInt64 done = 0u; done < length;) {
+        const Smp::UInt64 count = std::min(length - done, ChunkLength);
+        const T *in = values + done;
+        for (Smp::UInt64 i = 0u; i < count; ++i) {
+            chunk[i].type = Kind;
+            chunk[i].value.*Member = in[i];
+        }
+        field->SetValues(count, chunk, startIndex + done);
+        done += count;
+    }
+}
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ISimpleArrayField ### */
+#define CW_SPACE CW_root_Smp_ISimpleArrayField
+
+CW_THUNK void
+CW(_ISimpleArrayField)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimpleArrayField *>(self)->~ISimpleArrayField(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<Smp::ISimpleArrayField *>(self)->GetSize(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(GetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) index,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple*>(value) =
+        static_cast<Smp::ISimpleArrayField *>(self)->GetValue(
+            static_cast<Smp::UInt64>(index)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) index,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        static_cast<Smp::ISimpleArrayField *>(self)->SetValue(
+            static_cast<Smp::UInt64>(index),
+            *reinterpret_cast<Smp::AnySimple*>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValues)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, AnySimple) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        static_cast<Smp::ISimpleArrayField *>(self)->GetValues(
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::AnySimple *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValues)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, AnySimpleArray) values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        static_cast<Smp::ISimpleArrayField *>(self)->SetValues(
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::AnySimpleArray>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesBool)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Bool) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Bool, Smp::PrimitiveTypeKind::PTK_Bool, &Smp::AnySimple::PrimitiveTypeValue::boolValue>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Bool *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesChar8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Char8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Char8, Smp::PrimitiveTypeKind::PTK_Char8, &Smp::AnySimple::PrimitiveTypeValue::char8Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Char8 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesUInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::UInt8, Smp::PrimitiveTypeKind::PTK_UInt8, &Smp::AnySimple::PrimitiveTypeValue::uInt8Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::UInt8 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesUInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::UInt16, Smp::PrimitiveTypeKind::PTK_UInt16, &Smp::AnySimple::PrimitiveTypeValue::uInt16Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::UInt16 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesUInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::UInt32, Smp::PrimitiveTypeKind::PTK_UInt32, &Smp::AnySimple::PrimitiveTypeValue::uInt32Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::UInt32 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesUInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, UInt64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::UInt64, Smp::PrimitiveTypeKind::PTK_UInt64, &Smp::AnySimple::PrimitiveTypeValue::uInt64Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::UInt64 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Int8, Smp::PrimitiveTypeKind::PTK_Int8, &Smp::AnySimple::PrimitiveTypeValue::int8Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Int8 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Int16, Smp::PrimitiveTypeKind::PTK_Int16, &Smp::AnySimple::PrimitiveTypeValue::int16Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Int16 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Int32, Smp::PrimitiveTypeKind::PTK_Int32, &Smp::AnySimple::PrimitiveTypeValue::int32Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Int32 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Int64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Int64, Smp::PrimitiveTypeKind::PTK_Int64, &Smp::AnySimple::PrimitiveTypeValue::int64Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Int64 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesFloat32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Float32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Float32, Smp::PrimitiveTypeKind::PTK_Float32, &Smp::AnySimple::PrimitiveTypeValue::float32Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Float32 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetValuesFloat64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    CW(CW_root_Smp, Float64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        GetValuesAs<Smp::Float64, Smp::PrimitiveTypeKind::PTK_Float64, &Smp::AnySimple::PrimitiveTypeValue::float64Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<Smp::Float64 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesBool)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Bool) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Bool, Smp::PrimitiveTypeKind::PTK_Bool, &Smp::AnySimple::PrimitiveTypeValue::boolValue>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Bool *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesChar8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Char8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Char8, Smp::PrimitiveTypeKind::PTK_Char8, &Smp::AnySimple::PrimitiveTypeValue::char8Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Char8 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesUInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::UInt8, Smp::PrimitiveTypeKind::PTK_UInt8, &Smp::AnySimple::PrimitiveTypeValue::uInt8Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::UInt8 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesUInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::UInt16, Smp::PrimitiveTypeKind::PTK_UInt16, &Smp::AnySimple::PrimitiveTypeValue::uInt16Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::UInt16 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesUInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::UInt32, Smp::PrimitiveTypeKind::PTK_UInt32, &Smp::AnySimple::PrimitiveTypeValue::uInt32Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::UInt32 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesUInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, UInt64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::UInt64, Smp::PrimitiveTypeKind::PTK_UInt64, &Smp::AnySimple::PrimitiveTypeValue::uInt64Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::UInt64 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesInt8)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int8) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Int8, Smp::PrimitiveTypeKind::PTK_Int8, &Smp::AnySimple::PrimitiveTypeValue::int8Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Int8 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesInt16)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int16) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Int16, Smp::PrimitiveTypeKind::PTK_Int16, &Smp::AnySimple::PrimitiveTypeValue::int16Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Int16 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesInt32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Int32, Smp::PrimitiveTypeKind::PTK_Int32, &Smp::AnySimple::PrimitiveTypeValue::int32Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Int32 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesInt64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Int64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Int64, Smp::PrimitiveTypeKind::PTK_Int64, &Smp::AnySimple::PrimitiveTypeValue::int64Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Int64 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesFloat32)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Float32) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Float32, Smp::PrimitiveTypeKind::PTK_Float32, &Smp::AnySimple::PrimitiveTypeValue::float32Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Float32 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValuesFloat64)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) length,
+    const CW(CW_root_Smp, Float64) * values,
+    CW(CW_root_Smp, UInt64) startIndex
+) {
+    try {
+        SetValuesAs<Smp::Float64, Smp::PrimitiveTypeKind::PTK_Float64, &Smp::AnySimple::PrimitiveTypeValue::float64Value>(
+            static_cast<Smp::ISimpleArrayField *>(self),
+            static_cast<Smp::UInt64>(length),
+            reinterpret_cast<const Smp::Float64 *>(values),
+            static_cast<Smp::UInt64>(startIndex)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "ISimpleArrayField" at Smp/./ISimpleArrayField.h:33:11 (exported to Smp-C/ISimpleArrayField.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./ISimpleArrayField.h:33:11 (exported to Smp-C/ISimpleArrayField.h) : Reference type is not supported: ISimpleArrayField & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ISIMPLEARRAYFIELD_INL */
@@ -40,21 +40,26 @@ typedef void CW(ISimpleField);
 #endif /* CW_root_Smp_ISimpleField */
 #define CW_SPACE CW_root_Smp_ISimpleField
 
-void
+CW_THUNK void
 CW(_ISimpleField)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetPrimitiveTypeKind)
 (
     CW() * self
 );
 
-/* Error while processing function "GetValue" at Smp/ISimpleField.h:43:32 (exported to Smp-C/ISimpleField.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+);
 
-void
+CW_THUNK void
 CW(SetValue)
 (
     CW() * self,
@@ -0,0 +1,99 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ISIMPLEFIELD_INL
+#define CWRAPPER_ISIMPLEFIELD_INL
+
+#include "Smp-C/ISimpleField.h"
+#include <Smp/ISimpleField.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ISimpleField ### */
+#define CW_SPACE CW_root_Smp_ISimpleField
+
+CW_THUNK void
+CW(_ISimpleField)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimpleField *>(self)->~ISimpleField(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
+CW(GetPrimitiveTypeKind)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(
+        static_cast<Smp::ISimpleField *>(self)->GetPrimitiveTypeKind(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(GetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple*>(value) =
+        static_cast<Smp::ISimpleField *>(self)->GetValue(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        static_cast<Smp::ISimpleField *>(self)->SetValue(
+            *reinterpret_cast<Smp::AnySimple*>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "ISimpleField" at Smp/ISimpleField.h:30:11 (exported to Smp-C/ISimpleField.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/ISimpleField.h:30:11 (exported to Smp-C/ISimpleField.h) : Reference type is not supported: ISimpleField & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ISIMPLEFIELD_INL */
@@ -100,160 +100,160 @@ typedef void CW(ISimulator);
 #endif /* CW_root_Smp_ISimulator */
 #define CW_SPACE CW_root_Smp_ISimulator
 
-void
+CW_THUNK void
 CW(_ISimulator)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Initialise)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Publish)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Configure)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Connect)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Run)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Hold)
 (
     CW() * self,
     CW(CW_root_Smp, Bool) immediate
 );
 
-void
+CW_THUNK void
 CW(Store)
 (
     CW() * self,
     CW(CW_root_Smp, String8) filename
 );
 
-void
+CW_THUNK void
 CW(Restore)
 (
     CW() * self,
     CW(CW_root_Smp, String8) filename
 );
 
-void
+CW_THUNK void
 CW(Reconnect)
 (
     CW() * self,
     CW(CW_root_Smp, IComponent) * root
 );
 
-void
+CW_THUNK void
 CW(Exit)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Abort)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, SimulatorStateKind)
+CW_THUNK CW(CW_root_Smp, SimulatorStateKind)
 CW(GetState)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(AddInitEntryPoint)
 (
     CW() * self,
     CW(CW_root_Smp, IEntryPoint) * entryPoint
 );
 
-void
+CW_THUNK void
 CW(AddModel)
 (
     CW() * self,
     CW(CW_root_Smp, IModel) * model
 );
 
-void
+CW_THUNK void
 CW(AddService)
 (
     CW() * self,
     CW(CW_root_Smp, IService) * service
 );
 
-CW(CW_root_Smp, IService) *
+CW_THUNK CW(CW_root_Smp, IService) *
 CW(GetService)
 (
     CW() * self,
     CW(CW_root_Smp, String8) name
 );
 
-CW(CW_root_Smp_Services, ILogger) *
+CW_THUNK CW(CW_root_Smp_Services, ILogger) *
 CW(GetLogger)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, ITimeKeeper) *
+CW_THUNK CW(CW_root_Smp_Services, ITimeKeeper) *
 CW(GetTimeKeeper)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, IScheduler) *
+CW_THUNK CW(CW_root_Smp_Services, IScheduler) *
 CW(GetScheduler)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, IEventManager) *
+CW_THUNK CW(CW_root_Smp_Services, IEventManager) *
 CW(GetEventManager)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, IResolver) *
+CW_THUNK CW(CW_root_Smp_Services, IResolver) *
 CW(GetResolver)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, ILinkRegistry) *
+CW_THUNK CW(CW_root_Smp_Services, ILinkRegistry) *
 CW(GetLinkRegistry)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(RegisterFactory)
 (
     CW() * self,
     CW(CW_root_Smp, IFactory) * componentFactory
 );
 
-CW(CW_root_Smp, IComponent) *
+CW_THUNK CW(CW_root_Smp, IComponent) *
 CW(CreateInstance)
 (
     CW() * self,
@@ -263,26 +263,26 @@ CW(CreateInstance)
     CW(CW_root_Smp, IComposite) * parent
 );
 
-CW(CW_root_Smp, IFactory) *
+CW_THUNK CW(CW_root_Smp, IFactory) *
 CW(GetFactory)
 (
     CW() * self,
     CW(CW_root_Smp, Uuid) * uuid
 );
 
-const CW(CW_root_Smp, FactoryCollection) *
+CW_THUNK const CW(CW_root_Smp, FactoryCollection) *
 CW(GetFactories)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Publication, ITypeRegistry) *
+CW_THUNK CW(CW_root_Smp_Publication, ITypeRegistry) *
 CW(GetTypeRegistry)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(LoadLibrary)
 (
     CW() * self,
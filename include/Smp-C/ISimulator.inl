@@ -0,0 +1,492 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ISIMULATOR_INL
+#define CWRAPPER_ISIMULATOR_INL
+
+#include "Smp-C/ISimulator.h"
+#include <Smp/ISimulator.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication ### */
+#define CW_SPACE CW_root_Smp_Publication
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ISimulator ### */
+#define CW_SPACE CW_root_Smp_ISimulator
+
+CW_THUNK void
+CW(_ISimulator)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->~ISimulator(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Initialise)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Initialise(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Publish)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Publish(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Configure)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Configure(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Connect)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Connect(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Run)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Run(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Hold)
+(
+    CW() * self,
+    CW(CW_root_Smp, Bool) immediate
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Hold(
+            static_cast<Smp::Bool>(immediate)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Store)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) filename
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Store(
+            static_cast<Smp::String8>(filename)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Restore)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) filename
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Restore(
+            static_cast<Smp::String8>(filename)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Reconnect)
+(
+    CW() * self,
+    CW(CW_root_Smp, IComponent) * root
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Reconnect(
+            static_cast<Smp::IComponent *>(root)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Exit)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Exit(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Abort)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->Abort(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, SimulatorStateKind)
+CW(GetState)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, SimulatorStateKind)>(
+        static_cast<Smp::ISimulator *>(self)->GetState(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(AddInitEntryPoint)
+(
+    CW() * self,
+    CW(CW_root_Smp, IEntryPoint) * entryPoint
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->AddInitEntryPoint(
+            static_cast<Smp::IEntryPoint *>(entryPoint)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(AddModel)
+(
+    CW() * self,
+    CW(CW_root_Smp, IModel) * model
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->AddModel(
+            static_cast<Smp::IModel *>(model)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(AddService)
+(
+    CW() * self,
+    CW(CW_root_Smp, IService) * service
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->AddService(
+            static_cast<Smp::IService *>(service)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, IService) *
+CW(GetService)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IService) *>(
+        static_cast<Smp::ISimulator *>(self)->GetService(
+            static_cast<Smp::String8>(name)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, ILogger) *
+CW(GetLogger)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, ILogger) *>(
+        static_cast<Smp::ISimulator *>(self)->GetLogger(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, ITimeKeeper) *
+CW(GetTimeKeeper)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, ITimeKeeper) *>(
+        static_cast<Smp::ISimulator *>(self)->GetTimeKeeper(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, IScheduler) *
+CW(GetScheduler)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, IScheduler) *>(
+        static_cast<Smp::ISimulator *>(self)->GetScheduler(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, IEventManager) *
+CW(GetEventManager)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, IEventManager) *>(
+        static_cast<Smp::ISimulator *>(self)->GetEventManager(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, IResolver) *
+CW(GetResolver)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, IResolver) *>(
+        static_cast<Smp::ISimulator *>(self)->GetResolver(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, ILinkRegistry) *
+CW(GetLinkRegistry)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, ILinkRegistry) *>(
+        static_cast<Smp::ISimulator *>(self)->GetLinkRegistry(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(RegisterFactory)
+(
+    CW() * self,
+    CW(CW_root_Smp, IFactory) * componentFactory
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->RegisterFactory(
+            static_cast<Smp::IFactory *>(componentFactory)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, IComponent) *
+CW(CreateInstance)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid,
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, IComposite) * parent
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IComponent) *>(
+        static_cast<Smp::ISimulator *>(self)->CreateInstance(
+            *reinterpret_cast<Smp::Uuid*>(uuid),
+            static_cast<Smp::String8>(name),
+            static_cast<Smp::String8>(description),
+            static_cast<Smp::IComposite *>(parent)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, IFactory) *
+CW(GetFactory)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IFactory) *>(
+        static_cast<Smp::ISimulator *>(self)->GetFactory(
+            *reinterpret_cast<Smp::Uuid*>(uuid)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, FactoryCollection) *
+CW(GetFactories)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, FactoryCollection) *>(
+        static_cast<Smp::ISimulator *>(self)->GetFactories(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Publication, ITypeRegistry) *
+CW(GetTypeRegistry)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Publication, ITypeRegistry) *>(
+        static_cast<Smp::ISimulator *>(self)->GetTypeRegistry(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(LoadLibrary)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) libraryPath,
+    CW(CW_root_Smp, LibraryLoadingFlag) flag
+) {
+    try {
+        static_cast<Smp::ISimulator *>(self)->LoadLibrary(
+            static_cast<Smp::String8>(libraryPath),
+            static_cast<Smp::LibraryLoadingFlag>(flag)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "ISimulator" at Smp/./ISimulator.h:71:11 (exported to Smp-C/ISimulator.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./ISimulator.h:71:11 (exported to Smp-C/ISimulator.h) : Reference type is not supported: ISimulator & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ISIMULATOR_INL */
@@ -38,13 +38,13 @@ typedef void CW(IStorageReader);
 #endif /* CW_root_Smp_IStorageReader */
 #define CW_SPACE CW_root_Smp_IStorageReader
 
-void
+CW_THUNK void
 CW(_IStorageReader)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Restore)
 (
     CW() * self,
@@ -52,13 +52,13 @@ CW(Restore)
     CW(CW_root_Smp, UInt64) size
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetStateVectorFileName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetStateVectorFilePath)
 (
     CW() * self
@@ -38,13 +38,13 @@ typedef void CW(IStorageWriter);
 #endif /* CW_root_Smp_IStorageWriter */
 #define CW_SPACE CW_root_Smp_IStorageWriter
 
-void
+CW_THUNK void
 CW(_IStorageWriter)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(Store)
 (
     CW() * self,
@@ -52,13 +52,13 @@ CW(Store)
     CW(CW_root_Smp, UInt64) size
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetStateVectorFileName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetStateVectorFilePath)
 (
     CW() * self
@@ -39,19 +39,19 @@ typedef void CW(IStructureField);
 #endif /* CW_root_Smp_IStructureField */
 #define CW_SPACE CW_root_Smp_IStructureField
 
-void
+CW_THUNK void
 CW(_IStructureField)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, FieldCollection) *
+CW_THUNK const CW(CW_root_Smp, FieldCollection) *
 CW(GetFields)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(GetField)
 (
     CW() * self,
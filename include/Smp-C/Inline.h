@@ -0,0 +1,189 @@
+/**
+ * Header-only form of the wrapper, for C++ translation units.
+ *
+ * With -DCW_HEADER_ONLY on the command line, every wrapper is declared
+ * static inline (see CW_THUNK in CWraPPer.h) and this file includes the
+ * definitions, the .inl files next to the headers (the library compiles
+ * the same files out of line), so the compiler can inline the thunk into
+ * the caller. Include it once per translation unit, at file scope, after
+ * any other Smp-C header.
+ *
+ * The exception record (Smp-C/ExceptionRecord.h) is not inlined: it holds
+ * per-thread state shared by every unit, so the library is still linked.
+ *
+ * A few thunks look for an opt-in C++ interface on the object with
+ * dynamic_cast (Smp-C/TypedArrayField.h, Smp-C/Services/BatchScheduler.h,
+ * Smp-C/Services/BatchEventManager.h) and fall back to the plain SMP
+ * calls when it is not implemented. These interfaces are declared in
+ * public headers so that the thunks inlined from here see them too.
+ */
+#ifndef CWRAPPER_INLINE_H
+#define CWRAPPER_INLINE_H
+
+#include "./CWraPPer.h"
+
+#if defined(CW_HEADER_ONLY) && defined(__cplusplus) && !defined(CW_BUILDING_LIBRARY)
+
+/* Library internal: fills the exception record from the catch blocks of the thunks */
+namespace CWraPPer {
+
+void CatchException() noexcept;
+
+} /* namespace CWraPPer */
+
+#include "./AccessKind.inl"
+#include "./AnySimple.inl"
+#include "./AnySimpleArray.inl"
+#include "./Bool.inl"
+#include "./CannotDelete.inl"
+#include "./CannotRemove.inl"
+#include "./CannotRestore.inl"
+#include "./CannotStore.inl"
+#include "./Char8.inl"
+#include "./CollectionIterator.inl"
+#include "./ComponentCollection.inl"
+#include "./ComponentStateKind.inl"
+#include "./ContainerCollection.inl"
+#include "./ContainerFull.inl"
+#include "./DateTime.inl"
+#include "./Publication/DuplicateLiteral.inl"
+#include "./DuplicateName.inl"
+#include "./DuplicateUuid.inl"
+#include "./Duration.inl"
+#include "./Services/EntryPointAlreadySubscribed.inl"
+#include "./EntryPointCollection.inl"
+#include "./Services/EntryPointNotSubscribed.inl"
+#include "./Services/EventId.inl"
+#include "./EventSinkAlreadySubscribed.inl"
+#include "./EventSinkCollection.inl"
+#include "./EventSinkNotSubscribed.inl"
+#include "./EventSourceCollection.inl"
+#include "./Exception.inl"
+#include "./FactoryCollection.inl"
+#include "./FailureCollection.inl"
+#include "./FieldAlreadyConnected.inl"
+#include "./FieldCollection.inl"
+#include "./FieldHandle.inl"
+#include "./FieldNotConnected.inl"
+#include "./FileNotFound.inl"
+#include "./Float32.inl"
+#include "./Float64.inl"
+#include "./IAggregate.inl"
+#include "./IArrayField.inl"
+#include "./Publication/IArrayType.inl"
+#include "./Publication/IClassType.inl"
+#include "./ICollection.inl"
+#include "./ICollectionBase.inl"
+#include "./IComponent.inl"
+#include "./IComposite.inl"
+#include "./IContainer.inl"
+#include "./IDynamicInvocation.inl"
+#include "./IEntryPoint.inl"
+#include "./IEntryPointPublisher.inl"
+#include "./Publication/IEnumerationType.inl"
+#include "./IEventConsumer.inl"
+#include "./Services/IEventManager.inl"
+#include "./IEventProvider.inl"
+#include "./IEventSink.inl"
+#include "./IEventSource.inl"
+#include "./IFactory.inl"
+#include "./IFailure.inl"
+#include "./IFallibleModel.inl"
+#include "./IField.inl"
+#include "./IForcibleField.inl"
+#include "./Services/ILinkRegistry.inl"
+#include "./ILinkingComponent.inl"
+#include "./Services/ILogger.inl"
+#include "./IModel.inl"
+#include "./IObject.inl"
+#include "./IOperation.inl"
+#include "./IOutputField.inl"
+#include "./IParameter.inl"
+#include "./IPersist.inl"
+#include "./IProperty.inl"
+#include "./IPublication.inl"
+#include "./Publication/IPublishField.inl"
+#include "./Publication/IPublishOperation.inl"
+#include "./IReference.inl"
+#include "./IRequest.inl"
+#include "./Services/IResolver.inl"
+#include "./Services/IScheduler.inl"
+#include "./IService.inl"
+#include "./ISimpleArrayField.inl"
+#include "./ISimpleField.inl"
+#include "./ISimulator.inl"
+#include "./IStorageReader.inl"
+#include "./IStorageWriter.inl"
+#include "./Publication/IStringType.inl"
+#include "./IStructureField.inl"
+#include "./Publication/IStructureType.inl"
+#include "./Services/ITimeKeeper.inl"
+#include "./Publication/IType.inl"
+#include "./Publication/ITypeRegistry.inl"
+#include "./Int16.inl"
+#include "./Int32.inl"
+#include "./Int64.inl"
+#include "./Int8.inl"
+#include "./InvalidAccess.inl"
+#include "./InvalidAnyType.inl"
+#include "./InvalidArrayIndex.inl"
+#include "./Publication/InvalidArrayItemType.inl"
+#include "./InvalidArraySize.inl"
+#include "./InvalidArrayValue.inl"
+#include "./InvalidComponentState.inl"
+#include "./Services/InvalidCycleTime.inl"
+#include "./Services/InvalidEventId.inl"
+#include "./Services/InvalidEventName.inl"
+#include "./InvalidEventSink.inl"
+#include "./Services/InvalidEventTime.inl"
+#include "./InvalidFieldName.inl"
+#include "./InvalidFieldValue.inl"
+#include "./InvalidFile.inl"
+#include "./InvalidObjectName.inl"
+#include "./InvalidObjectType.inl"
+#include "./InvalidOperationName.inl"
+#include "./InvalidParameterCount.inl"
+#include "./Publication/InvalidParameterDirection.inl"
+#include "./InvalidParameterIndex.inl"
+#include "./InvalidParameterValue.inl"
+#include "./InvalidParent.inl"
+#include "./Publication/InvalidPrimitiveType.inl"
+#include "./InvalidPropertyValue.inl"
+#include "./Services/InvalidSimulationTime.inl"
+#include "./InvalidSimulatorState.inl"
+#include "./InvalidSmpVersion.inl"
+#include "./InvalidTarget.inl"
+#include "./InvalidType.inl"
+#include "./LibraryLoadingFlag.inl"
+#include "./Services/LogMessageKind.inl"
+#include "./ModelCollection.inl"
+#include "./NoDynamicInvocation.inl"
+#include "./NotContained.inl"
+#include "./NotReferenced.inl"
+#include "./OperationCollection.inl"
+#include "./ParameterCollection.inl"
+#include "./Publication/ParameterDirectionKind.inl"
+#include "./PrimitiveTypeKind.inl"
+#include "./PrimitiveTypes.inl"
+#include "./PropertyCollection.inl"
+#include "./ReferenceCollection.inl"
+#include "./ReferenceFull.inl"
+#include "./RequestType.inl"
+#include "./ServiceCollection.inl"
+#include "./SimulatorStateKind.inl"
+#include "./String8.inl"
+#include "./Services/TimeKind.inl"
+#include "./Publication/TypeAlreadyRegistered.inl"
+#include "./Publication/TypeNotRegistered.inl"
+#include "./UInt16.inl"
+#include "./UInt32.inl"
+#include "./UInt64.inl"
+#include "./UInt8.inl"
+#include "./Uuid.inl"
+#include "./ViewKind.inl"
+#include "./Void.inl"
+#include "./VoidOperation.inl"
+
+#endif /* CW_HEADER_ONLY && __cplusplus && !CW_BUILDING_LIBRARY */
+
+#endif /* CWRAPPER_INLINE_H */
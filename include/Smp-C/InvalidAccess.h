@@ -38,13 +38,13 @@ typedef void CW(InvalidAccess);
 #endif /* CW_root_Smp_InvalidAccess */
 #define CW_SPACE CW_root_Smp_InvalidAccess
 
-void
+CW_THUNK void
 CW(_InvalidAccess)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetPropertyName)
 (
     CW() * self
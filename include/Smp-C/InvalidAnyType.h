@@ -39,15 +39,20 @@ typedef void CW(InvalidAnyType);
 #endif /* CW_root_Smp_InvalidAnyType */
 #define CW_SPACE CW_root_Smp_InvalidAnyType
 
-void
+CW_THUNK void
 CW(_InvalidAnyType)
 (
     CW() * self
 );
 
-/* Error while processing function "GetInvalidValue" at Smp/InvalidAnyType.h:41:32 (exported to Smp-C/InvalidAnyType.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetInvalidValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+);
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetExpectedType)
 (
     CW() * self
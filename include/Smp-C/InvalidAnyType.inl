@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDANYTYPE_INL
+#define CWRAPPER_INVALIDANYTYPE_INL
+
+#include "Smp-C/InvalidAnyType.h"
+#include <Smp/InvalidAnyType.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidAnyType ### */
+#define CW_SPACE CW_root_Smp_InvalidAnyType
+
+CW_THUNK void
+CW(_InvalidAnyType)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidAnyType *>(self)->~InvalidAnyType(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetInvalidValue)
+(
+    CW() * self,
+    CW(CW_root_Smp, AnySimple) * value
+) {
+    try {
+        *reinterpret_cast<Smp::AnySimple*>(value) =
+        static_cast<Smp::InvalidAnyType *>(self)->GetInvalidValue(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
+CW(GetExpectedType)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(
+        static_cast<Smp::InvalidAnyType *>(self)->GetExpectedType(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidAnyType" at Smp/InvalidAnyType.h:32:11 (exported to Smp-C/InvalidAnyType.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidAnyType.h:32:11 (exported to Smp-C/InvalidAnyType.h) : Reference type is not supported: InvalidAnyType & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDANYTYPE_INL */
@@ -38,19 +38,19 @@ typedef void CW(InvalidArrayIndex);
 #endif /* CW_root_Smp_InvalidArrayIndex */
 #define CW_SPACE CW_root_Smp_InvalidArrayIndex
 
-void
+CW_THUNK void
 CW(_InvalidArrayIndex)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetInvalidIndex)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetArraySize)
 (
     CW() * self
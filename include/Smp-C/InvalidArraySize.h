@@ -38,19 +38,19 @@ typedef void CW(InvalidArraySize);
 #endif /* CW_root_Smp_InvalidArraySize */
 #define CW_SPACE CW_root_Smp_InvalidArraySize
 
-void
+CW_THUNK void
 CW(_InvalidArraySize)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetArraySize)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetInvalidSize)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDARRAYSIZE_INL
+#define CWRAPPER_INVALIDARRAYSIZE_INL
+
+#include "Smp-C/InvalidArraySize.h"
+#include <Smp/InvalidArraySize.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidArraySize ### */
+#define CW_SPACE CW_root_Smp_InvalidArraySize
+
+CW_THUNK void
+CW(_InvalidArraySize)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidArraySize *>(self)->~InvalidArraySize(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetArraySize)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::InvalidArraySize *>(self)->GetArraySize(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetInvalidSize)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::InvalidArraySize *>(self)->GetInvalidSize(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidArraySize" at Smp/InvalidArraySize.h:28:11 (exported to Smp-C/InvalidArraySize.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidArraySize.h:28:11 (exported to Smp-C/InvalidArraySize.h) : Reference type is not supported: InvalidArraySize & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDARRAYSIZE_INL */
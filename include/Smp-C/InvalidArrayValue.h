@@ -38,13 +38,13 @@ typedef void CW(InvalidArrayValue);
 #endif /* CW_root_Smp_InvalidArrayValue */
 #define CW_SPACE CW_root_Smp_InvalidArrayValue
 
-void
+CW_THUNK void
 CW(_InvalidArrayValue)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetInvalidValueIndex)
 (
     CW() * self
@@ -38,19 +38,19 @@ typedef void CW(InvalidComponentState);
 #endif /* CW_root_Smp_InvalidComponentState */
 #define CW_SPACE CW_root_Smp_InvalidComponentState
 
-void
+CW_THUNK void
 CW(_InvalidComponentState)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, ComponentStateKind)
+CW_THUNK CW(CW_root_Smp, ComponentStateKind)
 CW(GetInvalidState)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, ComponentStateKind)
+CW_THUNK CW(CW_root_Smp, ComponentStateKind)
 CW(GetExpectedState)
 (
     CW() * self
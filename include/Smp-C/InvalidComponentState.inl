@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDCOMPONENTSTATE_INL
+#define CWRAPPER_INVALIDCOMPONENTSTATE_INL
+
+#include "Smp-C/InvalidComponentState.h"
+#include <Smp/InvalidComponentState.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidComponentState ### */
+#define CW_SPACE CW_root_Smp_InvalidComponentState
+
+CW_THUNK void
+CW(_InvalidComponentState)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidComponentState *>(self)->~InvalidComponentState(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, ComponentStateKind)
+CW(GetInvalidState)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, ComponentStateKind)>(
+        static_cast<Smp::InvalidComponentState *>(self)->GetInvalidState(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, ComponentStateKind)
+CW(GetExpectedState)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, ComponentStateKind)>(
+        static_cast<Smp::InvalidComponentState *>(self)->GetExpectedState(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidComponentState" at Smp/InvalidComponentState.h:29:11 (exported to Smp-C/InvalidComponentState.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidComponentState.h:29:11 (exported to Smp-C/InvalidComponentState.h) : Reference type is not supported: InvalidComponentState & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDCOMPONENTSTATE_INL */
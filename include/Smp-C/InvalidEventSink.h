@@ -41,19 +41,19 @@ typedef void CW(InvalidEventSink);
 #endif /* CW_root_Smp_InvalidEventSink */
 #define CW_SPACE CW_root_Smp_InvalidEventSink
 
-void
+CW_THUNK void
 CW(_InvalidEventSink)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEventSource) *
+CW_THUNK const CW(CW_root_Smp, IEventSource) *
 CW(GetEventSource)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEventSink) *
+CW_THUNK const CW(CW_root_Smp, IEventSink) *
 CW(GetEventSink)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDEVENTSINK_INL
+#define CWRAPPER_INVALIDEVENTSINK_INL
+
+#include "Smp-C/InvalidEventSink.h"
+#include <Smp/InvalidEventSink.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidEventSink ### */
+#define CW_SPACE CW_root_Smp_InvalidEventSink
+
+CW_THUNK void
+CW(_InvalidEventSink)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidEventSink *>(self)->~InvalidEventSink(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, IEventSource) *
+CW(GetEventSource)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IEventSource) *>(
+        static_cast<Smp::InvalidEventSink *>(self)->GetEventSource(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, IEventSink) *
+CW(GetEventSink)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IEventSink) *>(
+        static_cast<Smp::InvalidEventSink *>(self)->GetEventSink(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidEventSink" at Smp/InvalidEventSink.h:38:11 (exported to Smp-C/InvalidEventSink.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidEventSink.h:38:11 (exported to Smp-C/InvalidEventSink.h) : Reference type is not supported: InvalidEventSink & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDEVENTSINK_INL */
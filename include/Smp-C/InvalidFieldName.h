@@ -38,13 +38,13 @@ typedef void CW(InvalidFieldName);
 #endif /* CW_root_Smp_InvalidFieldName */
 #define CW_SPACE CW_root_Smp_InvalidFieldName
 
-void
+CW_THUNK void
 CW(_InvalidFieldName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetFieldName)
 (
     CW() * self
@@ -39,13 +39,13 @@ typedef void CW(InvalidFieldValue);
 #endif /* CW_root_Smp_InvalidFieldValue */
 #define CW_SPACE CW_root_Smp_InvalidFieldValue
 
-void
+CW_THUNK void
 CW(_InvalidFieldValue)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IField) *
+CW_THUNK const CW(CW_root_Smp, IField) *
 CW(GetField)
 (
     CW() * self
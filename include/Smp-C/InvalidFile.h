@@ -38,19 +38,19 @@ typedef void CW(InvalidFile);
 #endif /* CW_root_Smp_InvalidFile */
 #define CW_SPACE CW_root_Smp_InvalidFile
 
-void
+CW_THUNK void
 CW(_InvalidFile)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetFileName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetErrorMessage)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDFILE_INL
+#define CWRAPPER_INVALIDFILE_INL
+
+#include "Smp-C/InvalidFile.h"
+#include <Smp/InvalidFile.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidFile ### */
+#define CW_SPACE CW_root_Smp_InvalidFile
+
+CW_THUNK void
+CW(_InvalidFile)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidFile *>(self)->~InvalidFile(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetFileName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidFile *>(self)->GetFileName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetErrorMessage)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidFile *>(self)->GetErrorMessage(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidFile" at Smp/InvalidFile.h:29:11 (exported to Smp-C/InvalidFile.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidFile.h:29:11 (exported to Smp-C/InvalidFile.h) : Reference type is not supported: InvalidFile & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDFILE_INL */
@@ -38,13 +38,13 @@ typedef void CW(InvalidObjectName);
 #endif /* CW_root_Smp_InvalidObjectName */
 #define CW_SPACE CW_root_Smp_InvalidObjectName
 
-void
+CW_THUNK void
 CW(_InvalidObjectName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetInvalidName)
 (
     CW() * self
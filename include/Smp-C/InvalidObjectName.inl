@@ -0,0 +1,69 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDOBJECTNAME_INL
+#define CWRAPPER_INVALIDOBJECTNAME_INL
+
+#include "Smp-C/InvalidObjectName.h"
+#include <Smp/InvalidObjectName.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidObjectName ### */
+#define CW_SPACE CW_root_Smp_InvalidObjectName
+
+CW_THUNK void
+CW(_InvalidObjectName)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidObjectName *>(self)->~InvalidObjectName(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetInvalidName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidObjectName *>(self)->GetInvalidName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidObjectName" at Smp/InvalidObjectName.h:35:11 (exported to Smp-C/InvalidObjectName.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidObjectName.h:35:11 (exported to Smp-C/InvalidObjectName.h) : Reference type is not supported: InvalidObjectName & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDOBJECTNAME_INL */
@@ -39,13 +39,13 @@ typedef void CW(InvalidObjectType);
 #endif /* CW_root_Smp_InvalidObjectType */
 #define CW_SPACE CW_root_Smp_InvalidObjectType
 
-void
+CW_THUNK void
 CW(_InvalidObjectType)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IObject) *
+CW_THUNK const CW(CW_root_Smp, IObject) *
 CW(GetInvalidObject)
 (
     CW() * self
@@ -38,13 +38,13 @@ typedef void CW(InvalidOperationName);
 #endif /* CW_root_Smp_InvalidOperationName */
 #define CW_SPACE CW_root_Smp_InvalidOperationName
 
-void
+CW_THUNK void
 CW(_InvalidOperationName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetOperationName)
 (
     CW() * self
@@ -0,0 +1,69 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDOPERATIONNAME_INL
+#define CWRAPPER_INVALIDOPERATIONNAME_INL
+
+#include "Smp-C/InvalidOperationName.h"
+#include <Smp/InvalidOperationName.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidOperationName ### */
+#define CW_SPACE CW_root_Smp_InvalidOperationName
+
+CW_THUNK void
+CW(_InvalidOperationName)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidOperationName *>(self)->~InvalidOperationName(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetOperationName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidOperationName *>(self)->GetOperationName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidOperationName" at Smp/InvalidOperationName.h:29:11 (exported to Smp-C/InvalidOperationName.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidOperationName.h:29:11 (exported to Smp-C/InvalidOperationName.h) : Reference type is not supported: InvalidOperationName & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDOPERATIONNAME_INL */
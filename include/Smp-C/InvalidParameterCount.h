@@ -38,25 +38,25 @@ typedef void CW(InvalidParameterCount);
 #endif /* CW_root_Smp_InvalidParameterCount */
 #define CW_SPACE CW_root_Smp_InvalidParameterCount
 
-void
+CW_THUNK void
 CW(_InvalidParameterCount)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetOperationName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(GetOperationParameters)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(GetRequestParameters)
 (
     CW() * self
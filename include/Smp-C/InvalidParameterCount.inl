@@ -0,0 +1,99 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDPARAMETERCOUNT_INL
+#define CWRAPPER_INVALIDPARAMETERCOUNT_INL
+
+#include "Smp-C/InvalidParameterCount.h"
+#include <Smp/InvalidParameterCount.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidParameterCount ### */
+#define CW_SPACE CW_root_Smp_InvalidParameterCount
+
+CW_THUNK void
+CW(_InvalidParameterCount)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidParameterCount *>(self)->~InvalidParameterCount(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetOperationName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidParameterCount *>(self)->GetOperationName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetOperationParameters)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        static_cast<Smp::InvalidParameterCount *>(self)->GetOperationParameters(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetRequestParameters)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        static_cast<Smp::InvalidParameterCount *>(self)->GetRequestParameters(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidParameterCount" at Smp/InvalidParameterCount.h:29:11 (exported to Smp-C/InvalidParameterCount.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidParameterCount.h:29:11 (exported to Smp-C/InvalidParameterCount.h) : Reference type is not supported: InvalidParameterCount & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDPARAMETERCOUNT_INL */
@@ -38,25 +38,25 @@ typedef void CW(InvalidParameterIndex);
 #endif /* CW_root_Smp_InvalidParameterIndex */
 #define CW_SPACE CW_root_Smp_InvalidParameterIndex
 
-void
+CW_THUNK void
 CW(_InvalidParameterIndex)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetOperationName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(GetParameterIndex)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(GetParameterCount)
 (
     CW() * self
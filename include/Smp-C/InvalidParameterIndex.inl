@@ -0,0 +1,99 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDPARAMETERINDEX_INL
+#define CWRAPPER_INVALIDPARAMETERINDEX_INL
+
+#include "Smp-C/InvalidParameterIndex.h"
+#include <Smp/InvalidParameterIndex.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidParameterIndex ### */
+#define CW_SPACE CW_root_Smp_InvalidParameterIndex
+
+CW_THUNK void
+CW(_InvalidParameterIndex)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidParameterIndex *>(self)->~InvalidParameterIndex(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetOperationName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidParameterIndex *>(self)->GetOperationName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetParameterIndex)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        static_cast<Smp::InvalidParameterIndex *>(self)->GetParameterIndex(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int32)
+CW(GetParameterCount)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        static_cast<Smp::InvalidParameterIndex *>(self)->GetParameterCount(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidParameterIndex" at Smp/InvalidParameterIndex.h:30:11 (exported to Smp-C/InvalidParameterIndex.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidParameterIndex.h:30:11 (exported to Smp-C/InvalidParameterIndex.h) : Reference type is not supported: InvalidParameterIndex & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDPARAMETERINDEX_INL */
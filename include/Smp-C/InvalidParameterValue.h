@@ -38,19 +38,19 @@ typedef void CW(InvalidParameterValue);
 #endif /* CW_root_Smp_InvalidParameterValue */
 #define CW_SPACE CW_root_Smp_InvalidParameterValue
 
-void
+CW_THUNK void
 CW(_InvalidParameterValue)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetOperationName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetParameterName)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDPARAMETERVALUE_INL
+#define CWRAPPER_INVALIDPARAMETERVALUE_INL
+
+#include "Smp-C/InvalidParameterValue.h"
+#include <Smp/InvalidParameterValue.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidParameterValue ### */
+#define CW_SPACE CW_root_Smp_InvalidParameterValue
+
+CW_THUNK void
+CW(_InvalidParameterValue)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidParameterValue *>(self)->~InvalidParameterValue(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetOperationName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidParameterValue *>(self)->GetOperationName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetParameterName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::InvalidParameterValue *>(self)->GetParameterName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidParameterValue" at Smp/InvalidParameterValue.h:31:11 (exported to Smp-C/InvalidParameterValue.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidParameterValue.h:31:11 (exported to Smp-C/InvalidParameterValue.h) : Reference type is not supported: InvalidParameterValue & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDPARAMETERVALUE_INL */
@@ -39,19 +39,19 @@ typedef void CW(InvalidParent);
 #endif /* CW_root_Smp_InvalidParent */
 #define CW_SPACE CW_root_Smp_InvalidParent
 
-void
+CW_THUNK void
 CW(_InvalidParent)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IObject) *
+CW_THUNK const CW(CW_root_Smp, IObject) *
 CW(GetParentFound)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IObject) *
+CW_THUNK const CW(CW_root_Smp, IObject) *
 CW(GetParentExpected)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDPARENT_INL
+#define CWRAPPER_INVALIDPARENT_INL
+
+#include "Smp-C/InvalidParent.h"
+#include <Smp/InvalidParent.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::InvalidParent ### */
+#define CW_SPACE CW_root_Smp_InvalidParent
+
+CW_THUNK void
+CW(_InvalidParent)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::InvalidParent *>(self)->~InvalidParent(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK const CW(CW_root_Smp, IObject) *
+CW(GetParentFound)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IObject) *>(
+        static_cast<Smp::InvalidParent *>(self)->GetParentFound(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, IObject) *
+CW(GetParentExpected)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IObject) *>(
+        static_cast<Smp::InvalidParent *>(self)->GetParentExpected(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidParent" at Smp/InvalidParent.h:38:11 (exported to Smp-C/InvalidParent.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/InvalidParent.h:38:11 (exported to Smp-C/InvalidParent.h) : Reference type is not supported: InvalidParent & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDPARENT_INL */
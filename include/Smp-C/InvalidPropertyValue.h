@@ -39,13 +39,13 @@ typedef void CW(InvalidPropertyValue);
 #endif /* CW_root_Smp_InvalidPropertyValue */
 #define CW_SPACE CW_root_Smp_InvalidPropertyValue
 
-void
+CW_THUNK void
 CW(_InvalidPropertyValue)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IProperty) *
+CW_THUNK const CW(CW_root_Smp, IProperty) *
 CW(GetProperty)
 (
     CW() * self
@@ -38,13 +38,13 @@ typedef void CW(InvalidSimulatorState);
 #endif /* CW_root_Smp_InvalidSimulatorState */
 #define CW_SPACE CW_root_Smp_InvalidSimulatorState
 
-void
+CW_THUNK void
 CW(_InvalidSimulatorState)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, SimulatorStateKind)
+CW_THUNK CW(CW_root_Smp, SimulatorStateKind)
 CW(GetInvalidState)
 (
     CW() * self
@@ -38,13 +38,13 @@ typedef void CW(InvalidSmpVersion);
 #endif /* CW_root_Smp_InvalidSmpVersion */
 #define CW_SPACE CW_root_Smp_InvalidSmpVersion
 
-void
+CW_THUNK void
 CW(_InvalidSmpVersion)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt64)
+CW_THUNK CW(CW_root_Smp, UInt64)
 CW(GetLibrarySmpVersion)
 (
     CW() * self
@@ -41,19 +41,19 @@ typedef void CW(InvalidTarget);
 #endif /* CW_root_Smp_InvalidTarget */
 #define CW_SPACE CW_root_Smp_InvalidTarget
 
-void
+CW_THUNK void
 CW(_InvalidTarget)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IOutputField) *
+CW_THUNK const CW(CW_root_Smp, IOutputField) *
 CW(GetSource)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IField) *
+CW_THUNK const CW(CW_root_Smp, IField) *
 CW(GetTarget)
 (
     CW() * self
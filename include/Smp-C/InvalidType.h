@@ -37,7 +37,7 @@ typedef void CW(InvalidType);
 #endif /* CW_root_Smp_InvalidType */
 #define CW_SPACE CW_root_Smp_InvalidType
 
-void
+CW_THUNK void
 CW(_InvalidType)
 (
     CW() * self
@@ -0,0 +1,86 @@
+/**
+ * Storage reader restoring from a memory-mapped state vector file.
+ *
+ * Implements IStorageReader (through GetStorageReader), for ISimulator
+ * Restore or IPersist Restore. The file path/fileName is mapped in
+ * memory read only; Restore copies each block straight from the mapping,
+ * in the order they were stored. POSIX only.
+ */
+#ifndef CWRAPPER_MAPPEDSTORAGEREADER_H
+#define CWRAPPER_MAPPEDSTORAGEREADER_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IStorageReader.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(MappedStorageReader);
+
+#undef CW_SPACE
+
+
+/* ### Smp::MappedStorageReader ### */
+#ifndef CW_root_Smp_MappedStorageReader
+#define CW_root_Smp_MappedStorageReader CW_BUILD_SPACE(CW_root_Smp, MappedStorageReader)
+#endif /* CW_root_Smp_MappedStorageReader */
+#define CW_SPACE CW_root_Smp_MappedStorageReader
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IStorageReader) *
+CW(GetStorageReader)
+(
+    CW() * self
+);
+
+/* Returns the size of the state vector file */
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+);
+
+/* Returns the number of bytes restored so far */
+CW(CW_root_Smp, UInt64)
+CW(GetPosition)
+(
+    const CW() * self
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_MAPPEDSTORAGEREADER_H */
@@ -0,0 +1,82 @@
+/**
+ * Storage writer appending to a memory-mapped state vector file.
+ *
+ * Implements IStorageWriter (through GetStorageWriter), for ISimulator
+ * Store or IPersist Store. The file path/fileName is created with
+ * capacity bytes reserved and mapped in memory; Store copies each block
+ * right after the previous one, with no intermediate buffer, and grows
+ * the file when it is full. Destroy cuts the file to the bytes stored.
+ * POSIX only.
+ */
+#ifndef CWRAPPER_MAPPEDSTORAGEWRITER_H
+#define CWRAPPER_MAPPEDSTORAGEWRITER_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IStorageWriter.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(MappedStorageWriter);
+
+#undef CW_SPACE
+
+
+/* ### Smp::MappedStorageWriter ### */
+#ifndef CW_root_Smp_MappedStorageWriter
+#define CW_root_Smp_MappedStorageWriter CW_BUILD_SPACE(CW_root_Smp, MappedStorageWriter)
+#endif /* CW_root_Smp_MappedStorageWriter */
+#define CW_SPACE CW_root_Smp_MappedStorageWriter
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) capacity
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IStorageWriter) *
+CW(GetStorageWriter)
+(
+    CW() * self
+);
+
+/* Returns the number of bytes stored so far */
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_MAPPEDSTORAGEWRITER_H */
@@ -39,13 +39,13 @@ typedef void CW(NoDynamicInvocation);
 #endif /* CW_root_Smp_NoDynamicInvocation */
 #define CW_SPACE CW_root_Smp_NoDynamicInvocation
 
-void
+CW_THUNK void
 CW(_NoDynamicInvocation)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IComponent) *
+CW_THUNK const CW(CW_root_Smp, IComponent) *
 CW(GetComponent)
 (
     CW() * self
@@ -40,19 +40,19 @@ typedef void CW(NotContained);
 #endif /* CW_root_Smp_NotContained */
 #define CW_SPACE CW_root_Smp_NotContained
 
-void
+CW_THUNK void
 CW(_NotContained)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetContainerName)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IComponent) *
+CW_THUNK const CW(CW_root_Smp, IComponent) *
 CW(GetComponent)
 (
     CW() * self
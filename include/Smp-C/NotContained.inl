@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_NOTCONTAINED_INL
+#define CWRAPPER_NOTCONTAINED_INL
+
+#include "Smp-C/NotContained.h"
+#include <Smp/NotContained.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::NotContained ### */
+#define CW_SPACE CW_root_Smp_NotContained
+
+CW_THUNK void
+CW(_NotContained)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::NotContained *>(self)->~NotContained(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetContainerName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::NotContained *>(self)->GetContainerName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, IComponent) *
+CW(GetComponent)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IComponent) *>(
+        static_cast<Smp::NotContained *>(self)->GetComponent(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "NotContained" at Smp/NotContained.h:38:11 (exported to Smp-C/NotContained.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/NotContained.h:38:11 (exported to Smp-C/NotContained.h) : Reference type is not supported: NotContained & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_NOTCONTAINED_INL */
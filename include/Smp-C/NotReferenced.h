@@ -40,19 +40,19 @@ typedef void CW(NotReferenced);
 #endif /* CW_root_Smp_NotReferenced */
 #define CW_SPACE CW_root_Smp_NotReferenced
 
-void
+CW_THUNK void
 CW(_NotReferenced)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetReferenceName)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IComponent) *
+CW_THUNK const CW(CW_root_Smp, IComponent) *
 CW(GetComponent)
 (
     CW() * self
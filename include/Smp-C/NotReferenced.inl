@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_NOTREFERENCED_INL
+#define CWRAPPER_NOTREFERENCED_INL
+
+#include "Smp-C/NotReferenced.h"
+#include <Smp/NotReferenced.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::NotReferenced ### */
+#define CW_SPACE CW_root_Smp_NotReferenced
+
+CW_THUNK void
+CW(_NotReferenced)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::NotReferenced *>(self)->~NotReferenced(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetReferenceName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::NotReferenced *>(self)->GetReferenceName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp, IComponent) *
+CW(GetComponent)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp, IComponent) *>(
+        static_cast<Smp::NotReferenced *>(self)->GetComponent(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "NotReferenced" at Smp/NotReferenced.h:38:11 (exported to Smp-C/NotReferenced.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/NotReferenced.h:38:11 (exported to Smp-C/NotReferenced.h) : Reference type is not supported: NotReferenced & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_NOTREFERENCED_INL */
@@ -0,0 +1,95 @@
+/**
+ * Breakpoint driver storing and restoring components in parallel.
+ *
+ * Store walks the model tree of the simulator (every container of every
+ * composite, recursively) and gives each IPersist component its own
+ * storage segment; the segments are stored concurrently on a pool of
+ * workerCount threads (0 for the calling thread alone) and written to a
+ * single state vector file, indexed by component path. Store fails with
+ * CannotStore when two components have the same path (unnamed siblings,
+ * or a name holding a '/'). Restore walks the same tree and restores
+ * every component from its segment, in parallel. Components are stored
+ * and restored concurrently, so their Store and Restore must not share
+ * mutable state. The simulator itself is not stored, only its components.
+ *
+ * The segments are kept in memory until every component is stored, as
+ * their offsets in the file depend on the sizes before them: Store needs
+ * as much memory again as the state it writes, and copies it twice.
+ */
+#ifndef CWRAPPER_PARALLELSTORAGE_H
+#define CWRAPPER_PARALLELSTORAGE_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/ISimulator.h"
+#include "Smp-C/PrimitiveTypes.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(ParallelStorage);
+
+#undef CW_SPACE
+
+
+/* ### Smp::ParallelStorage ### */
+#ifndef CW_root_Smp_ParallelStorage
+#define CW_root_Smp_ParallelStorage CW_BUILD_SPACE(CW_root_Smp, ParallelStorage)
+#endif /* CW_root_Smp_ParallelStorage */
+#define CW_SPACE CW_root_Smp_ParallelStorage
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) workerCount
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+/* Returns the number of components stored */
+CW(CW_root_Smp, UInt64)
+CW(Store)
+(
+    CW() * self,
+    CW(CW_root_Smp, ISimulator) * simulator,
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+);
+
+/* Returns the number of components restored; every IPersist component needs a segment in the file */
+CW(CW_root_Smp, UInt64)
+CW(Restore)
+(
+    CW() * self,
+    CW(CW_root_Smp, ISimulator) * simulator,
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_PARALLELSTORAGE_H */
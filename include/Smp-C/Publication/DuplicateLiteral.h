@@ -47,19 +47,19 @@ typedef void CW(DuplicateLiteral);
 #endif /* CW_root_Smp_Publication_DuplicateLiteral */
 #define CW_SPACE CW_root_Smp_Publication_DuplicateLiteral
 
-void
+CW_THUNK void
 CW(_DuplicateLiteral)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetLiteralName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int32)
+CW_THUNK CW(CW_root_Smp, Int32)
 CW(GetLiteralValue)
 (
     CW() * self
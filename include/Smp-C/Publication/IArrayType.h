@@ -48,19 +48,19 @@ typedef void CW(IArrayType);
 #endif /* CW_root_Smp_Publication_IArrayType */
 #define CW_SPACE CW_root_Smp_Publication_IArrayType
 
-void
+CW_THUNK void
 CW(_IArrayType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt64)
+CW_THUNK CW(CW_root_Smp, UInt64)
 CW(GetSize)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp_Publication, IType) *
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
 CW(GetItemType)
 (
     CW() * self
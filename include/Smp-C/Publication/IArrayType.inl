@@ -0,0 +1,90 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IARRAYTYPE_INL
+#define CWRAPPER_IARRAYTYPE_INL
+
+#include "Smp-C/Publication/IArrayType.h"
+#include <Smp/Publication/IArrayType.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication ### */
+#define CW_SPACE CW_root_Smp_Publication
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication::IArrayType ### */
+#define CW_SPACE CW_root_Smp_Publication_IArrayType
+
+CW_THUNK void
+CW(_IArrayType)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Publication::IArrayType *>(self)->~IArrayType(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<Smp::Publication::IArrayType *>(self)->GetSize(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
+CW(GetItemType)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<const CW(CW_root_Smp_Publication, IType) *>(
+        static_cast<Smp::Publication::IArrayType *>(self)->GetItemType(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IArrayType" at Smp/./Publication/IArrayType.h:32:15 (exported to Smp-C/Publication/IArrayType.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./Publication/IArrayType.h:32:15 (exported to Smp-C/Publication/IArrayType.h) : Reference type is not supported: IArrayType & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IARRAYTYPE_INL */
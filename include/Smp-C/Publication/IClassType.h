@@ -46,7 +46,7 @@ typedef void CW(IClassType);
 #endif /* CW_root_Smp_Publication_IClassType */
 #define CW_SPACE CW_root_Smp_Publication_IClassType
 
-void
+CW_THUNK void
 CW(_IClassType)
 (
     CW() * self
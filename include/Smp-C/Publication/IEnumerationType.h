@@ -50,13 +50,13 @@ typedef void CW(IEnumerationType);
 #endif /* CW_root_Smp_Publication_IEnumerationType */
 #define CW_SPACE CW_root_Smp_Publication_IEnumerationType
 
-void
+CW_THUNK void
 CW(_IEnumerationType)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(AddLiteral)
 (
     CW() * self,
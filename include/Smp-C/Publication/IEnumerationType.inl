@@ -0,0 +1,79 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IENUMERATIONTYPE_INL
+#define CWRAPPER_IENUMERATIONTYPE_INL
+
+#include "Smp-C/Publication/IEnumerationType.h"
+#include <Smp/Publication/IEnumerationType.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication ### */
+#define CW_SPACE CW_root_Smp_Publication
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication::IEnumerationType ### */
+#define CW_SPACE CW_root_Smp_Publication_IEnumerationType
+
+CW_THUNK void
+CW(_IEnumerationType)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Publication::IEnumerationType *>(self)->~IEnumerationType(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(AddLiteral)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, Int32) value
+) {
+    try {
+        static_cast<Smp::Publication::IEnumerationType *>(self)->AddLiteral(
+            static_cast<Smp::String8>(name),
+            static_cast<Smp::String8>(description),
+            static_cast<Smp::Int32>(value)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "IEnumerationType" at Smp/./Publication/IEnumerationType.h:34:15 (exported to Smp-C/Publication/IEnumerationType.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./Publication/IEnumerationType.h:34:15 (exported to Smp-C/Publication/IEnumerationType.h) : Reference type is not supported: IEnumerationType & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IENUMERATIONTYPE_INL */
@@ -58,13 +58,13 @@ typedef void CW(IPublishField);
 #endif /* CW_root_Smp_Publication_IPublishField */
 #define CW_SPACE CW_root_Smp_Publication_IPublishField
 
-void
+CW_THUNK void
 CW(_IPublishField)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldBool)
 (
     CW() * self,
@@ -77,7 +77,7 @@ CW(PublishFieldBool)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldChar8)
 (
     CW() * self,
@@ -90,7 +90,7 @@ CW(PublishFieldChar8)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldInt8)
 (
     CW() * self,
@@ -103,7 +103,7 @@ CW(PublishFieldInt8)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldInt16)
 (
     CW() * self,
@@ -116,7 +116,7 @@ CW(PublishFieldInt16)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldInt32)
 (
     CW() * self,
@@ -129,7 +129,7 @@ CW(PublishFieldInt32)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldInt64)
 (
     CW() * self,
@@ -142,7 +142,7 @@ CW(PublishFieldInt64)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldUInt8)
 (
     CW() * self,
@@ -155,7 +155,7 @@ CW(PublishFieldUInt8)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldUInt16)
 (
     CW() * self,
@@ -168,7 +168,7 @@ CW(PublishFieldUInt16)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldUInt32)
 (
     CW() * self,
@@ -181,7 +181,7 @@ CW(PublishFieldUInt32)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldUInt64)
 (
     CW() * self,
@@ -194,7 +194,7 @@ CW(PublishFieldUInt64)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldFloat32)
 (
     CW() * self,
@@ -207,7 +207,7 @@ CW(PublishFieldFloat32)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldFloat64)
 (
     CW() * self,
@@ -220,7 +220,7 @@ CW(PublishFieldFloat64)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(PublishFieldVoid)
 (
     CW() * self,
@@ -234,14 +234,14 @@ CW(PublishFieldVoid)
     CW(CW_root_Smp, Bool) output
 );
 
-void
+CW_THUNK void
 CW(PublishFieldIField)
 (
     CW() * self,
     CW(CW_root_Smp, IField) * field
 );
 
-CW(CW_root_Smp_Publication, IPublishField) *
+CW_THUNK CW(CW_root_Smp_Publication, IPublishField) *
 CW(PublishArrayShort)
 (
     CW() * self,
@@ -251,7 +251,7 @@ CW(PublishArrayShort)
     CW(CW_root_Smp, Bool) state
 );
 
-CW(CW_root_Smp, ISimpleArrayField) *
+CW_THUNK CW(CW_root_Smp, ISimpleArrayField) *
 CW(PublishArray)
 (
     CW() * self,
@@ -266,7 +266,7 @@ CW(PublishArray)
     CW(CW_root_Smp, Bool) output
 );
 
-CW(CW_root_Smp_Publication, IPublishField) *
+CW_THUNK CW(CW_root_Smp_Publication, IPublishField) *
 CW(PublishStructure)
 (
     CW() * self,
@@ -276,14 +276,14 @@ CW(PublishStructure)
     CW(CW_root_Smp, Bool) state
 );
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(GetField)
 (
     CW() * self,
     CW(CW_root_Smp, String8) fullName
 );
 
-const CW(CW_root_Smp, FieldCollection) *
+CW_THUNK const CW(CW_root_Smp, FieldCollection) *
 CW(GetFields)
 (
     CW() * self
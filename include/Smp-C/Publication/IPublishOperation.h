@@ -53,13 +53,13 @@ typedef void CW(IPublishOperation);
 #endif /* CW_root_Smp_Publication_IPublishOperation */
 #define CW_SPACE CW_root_Smp_Publication_IPublishOperation
 
-void
+CW_THUNK void
 CW(_IPublishOperation)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(PublishParameter)
 (
     CW() * self,
@@ -47,13 +47,13 @@ typedef void CW(IStringType);
 #endif /* CW_root_Smp_Publication_IStringType */
 #define CW_SPACE CW_root_Smp_Publication_IStringType
 
-void
+CW_THUNK void
 CW(_IStringType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, UInt64)
+CW_THUNK CW(CW_root_Smp, UInt64)
 CW(GetMaxLength)
 (
     CW() * self
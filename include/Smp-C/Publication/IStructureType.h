@@ -53,13 +53,13 @@ typedef void CW(IStructureType);
 #endif /* CW_root_Smp_Publication_IStructureType */
 #define CW_SPACE CW_root_Smp_Publication_IStructureType
 
-void
+CW_THUNK void
 CW(_IStructureType)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(AddField)
 (
     CW() * self,
@@ -58,21 +58,26 @@ typedef void CW(IType);
 #endif /* CW_root_Smp_Publication_IType */
 #define CW_SPACE CW_root_Smp_Publication_IType
 
-void
+CW_THUNK void
 CW(_IType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetPrimitiveTypeKind)
 (
     CW() * self
 );
 
-/* Error while processing function "GetUuid" at Smp/Publication/IType.h:67:31 (exported to Smp-C/Publication/IType.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetUuid)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid
+);
 
-CW(CW_root_Smp, IField) *
+CW_THUNK CW(CW_root_Smp, IField) *
 CW(Publish)
 (
     CW() * self,
@@ -0,0 +1,121 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ITYPE_INL
+#define CWRAPPER_ITYPE_INL
+
+#include "Smp-C/Publication/IType.h"
+#include <Smp/Publication/IType.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication ### */
+#define CW_SPACE CW_root_Smp_Publication
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication::IType ### */
+#define CW_SPACE CW_root_Smp_Publication_IType
+
+CW_THUNK void
+CW(_IType)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Publication::IType *>(self)->~IType(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
+CW(GetPrimitiveTypeKind)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(
+        static_cast<Smp::Publication::IType *>(self)->GetPrimitiveTypeKind(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(GetUuid)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid
+) {
+    try {
+        *reinterpret_cast<Smp::Uuid*>(uuid) =
+        static_cast<Smp::Publication::IType *>(self)->GetUuid(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, IField) *
+CW(Publish)
+(
+    CW() * self,
+    CW(CW_root_Smp_Publication, IPublishField) * receiver,
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, Void) * address,
+    CW(CW_root_Smp, ViewKind) view,
+    CW(CW_root_Smp, Bool) state,
+    CW(CW_root_Smp, Bool) input,
+    CW(CW_root_Smp, Bool) output
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IField) *>(
+        static_cast<Smp::Publication::IType *>(self)->Publish(
+            static_cast<Smp::Publication::IPublishField *>(receiver),
+            static_cast<Smp::String8>(name),
+            static_cast<Smp::String8>(description),
+            static_cast<Smp::Void *>(address),
+            static_cast<Smp::ViewKind>(view),
+            static_cast<Smp::Bool>(state),
+            static_cast<Smp::Bool>(input),
+            static_cast<Smp::Bool>(output)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IType" at Smp/Publication/IType.h:52:15 (exported to Smp-C/Publication/IType.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/Publication/IType.h:52:15 (exported to Smp-C/Publication/IType.h) : Reference type is not supported: IType & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ITYPE_INL */
@@ -64,27 +64,27 @@ typedef void CW(ITypeRegistry);
 #endif /* CW_root_Smp_Publication_ITypeRegistry */
 #define CW_SPACE CW_root_Smp_Publication_ITypeRegistry
 
-void
+CW_THUNK void
 CW(_ITypeRegistry)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Publication, IType) *
+CW_THUNK CW(CW_root_Smp_Publication, IType) *
 CW(GetTypePrimitiveTypeKind)
 (
     CW() * self,
     CW(CW_root_Smp, PrimitiveTypeKind) type
 );
 
-CW(CW_root_Smp_Publication, IType) *
+CW_THUNK CW(CW_root_Smp_Publication, IType) *
 CW(GetTypeUuid)
 (
     CW() * self,
     CW(CW_root_Smp, Uuid) * typeUuid
 );
 
-CW(CW_root_Smp_Publication, IType) *
+CW_THUNK CW(CW_root_Smp_Publication, IType) *
 CW(AddFloatType)
 (
     CW() * self,
@@ -99,7 +99,7 @@ CW(AddFloatType)
     CW(CW_root_Smp, PrimitiveTypeKind) type
 );
 
-CW(CW_root_Smp_Publication, IType) *
+CW_THUNK CW(CW_root_Smp_Publication, IType) *
 CW(AddIntegerType)
 (
     CW() * self,
@@ -112,7 +112,7 @@ CW(AddIntegerType)
     CW(CW_root_Smp, PrimitiveTypeKind) type
 );
 
-CW(CW_root_Smp_Publication, IEnumerationType) *
+CW_THUNK CW(CW_root_Smp_Publication, IEnumerationType) *
 CW(AddEnumerationType)
 (
     CW() * self,
@@ -121,7 +121,7 @@ CW(AddEnumerationType)
     CW(CW_root_Smp, Uuid) * typeUuid
 );
 
-CW(CW_root_Smp_Publication, IArrayType) *
+CW_THUNK CW(CW_root_Smp_Publication, IArrayType) *
 CW(AddArrayType)
 (
     CW() * self,
@@ -134,7 +134,7 @@ CW(AddArrayType)
     CW(CW_root_Smp, Bool) simpleArray
 );
 
-CW(CW_root_Smp_Publication, IStringType) *
+CW_THUNK CW(CW_root_Smp_Publication, IStringType) *
 CW(AddStringType)
 (
     CW() * self,
@@ -144,7 +144,7 @@ CW(AddStringType)
     CW(CW_root_Smp, UInt64) length
 );
 
-CW(CW_root_Smp_Publication, IStructureType) *
+CW_THUNK CW(CW_root_Smp_Publication, IStructureType) *
 CW(AddStructureType)
 (
     CW() * self,
@@ -153,7 +153,7 @@ CW(AddStructureType)
     CW(CW_root_Smp, Uuid) * typeUuid
 );
 
-CW(CW_root_Smp_Publication, IClassType) *
+CW_THUNK CW(CW_root_Smp_Publication, IClassType) *
 CW(AddClassType)
 (
     CW() * self,
@@ -47,19 +47,19 @@ typedef void CW(InvalidArrayItemType);
 #endif /* CW_root_Smp_Publication_InvalidArrayItemType */
 #define CW_SPACE CW_root_Smp_Publication_InvalidArrayItemType
 
-void
+CW_THUNK void
 CW(_InvalidArrayItemType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetTypeName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetType)
 (
     CW() * self
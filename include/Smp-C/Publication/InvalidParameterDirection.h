@@ -47,13 +47,13 @@ typedef void CW(InvalidParameterDirection);
 #endif /* CW_root_Smp_Publication_InvalidParameterDirection */
 #define CW_SPACE CW_root_Smp_Publication_InvalidParameterDirection
 
-void
+CW_THUNK void
 CW(_InvalidParameterDirection)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetParameterName)
 (
     CW() * self
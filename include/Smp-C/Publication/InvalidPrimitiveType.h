@@ -47,19 +47,19 @@ typedef void CW(InvalidPrimitiveType);
 #endif /* CW_root_Smp_Publication_InvalidPrimitiveType */
 #define CW_SPACE CW_root_Smp_Publication_InvalidPrimitiveType
 
-void
+CW_THUNK void
 CW(_InvalidPrimitiveType)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetTypeName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, PrimitiveTypeKind)
+CW_THUNK CW(CW_root_Smp, PrimitiveTypeKind)
 CW(GetType)
 (
     CW() * self
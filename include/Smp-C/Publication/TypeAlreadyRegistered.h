@@ -49,19 +49,19 @@ typedef void CW(TypeAlreadyRegistered);
 #endif /* CW_root_Smp_Publication_TypeAlreadyRegistered */
 #define CW_SPACE CW_root_Smp_Publication_TypeAlreadyRegistered
 
-void
+CW_THUNK void
 CW(_TypeAlreadyRegistered)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetTypeName)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp_Publication, IType) *
+CW_THUNK const CW(CW_root_Smp_Publication, IType) *
 CW(GetType)
 (
     CW() * self
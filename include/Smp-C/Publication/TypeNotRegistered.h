@@ -47,13 +47,18 @@ typedef void CW(TypeNotRegistered);
 #endif /* CW_root_Smp_Publication_TypeNotRegistered */
 #define CW_SPACE CW_root_Smp_Publication_TypeNotRegistered
 
-void
+CW_THUNK void
 CW(_TypeNotRegistered)
 (
     CW() * self
 );
 
-/* Error while processing function "GetUuid" at Smp/Publication/TypeNotRegistered.h:41:31 (exported to Smp-C/Publication/TypeNotRegistered.h) : Skipping function that returns a class/struct */
+CW_THUNK void
+CW(GetUuid)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid
+);
 
 /* Error while processing function "TypeNotRegistered" at Smp/Publication/TypeNotRegistered.h:32:15 (exported to Smp-C/Publication/TypeNotRegistered.h) : Skipping constructor */
 
@@ -0,0 +1,75 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_TYPENOTREGISTERED_INL
+#define CWRAPPER_TYPENOTREGISTERED_INL
+
+#include "Smp-C/Publication/TypeNotRegistered.h"
+#include <Smp/Publication/TypeNotRegistered.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication ### */
+#define CW_SPACE CW_root_Smp_Publication
+
+#undef CW_SPACE
+
+
+/* ### Smp::Publication::TypeNotRegistered ### */
+#define CW_SPACE CW_root_Smp_Publication_TypeNotRegistered
+
+CW_THUNK void
+CW(_TypeNotRegistered)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Publication::TypeNotRegistered *>(self)->~TypeNotRegistered(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(GetUuid)
+(
+    CW() * self,
+    CW(CW_root_Smp, Uuid) * uuid
+) {
+    try {
+        *reinterpret_cast<Smp::Uuid*>(uuid) =
+        static_cast<Smp::Publication::TypeNotRegistered *>(self)->GetUuid(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "TypeNotRegistered" at Smp/Publication/TypeNotRegistered.h:32:15 (exported to Smp-C/Publication/TypeNotRegistered.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/Publication/TypeNotRegistered.h:32:15 (exported to Smp-C/Publication/TypeNotRegistered.h) : Reference type is not supported: TypeNotRegistered & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_TYPENOTREGISTERED_INL */
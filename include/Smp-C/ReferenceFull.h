@@ -38,19 +38,19 @@ typedef void CW(ReferenceFull);
 #endif /* CW_root_Smp_ReferenceFull */
 #define CW_SPACE CW_root_Smp_ReferenceFull
 
-void
+CW_THUNK void
 CW(_ReferenceFull)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetReferenceName)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Int64)
+CW_THUNK CW(CW_root_Smp, Int64)
 CW(GetReferenceSize)
 (
     CW() * self
@@ -0,0 +1,84 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_REFERENCEFULL_INL
+#define CWRAPPER_REFERENCEFULL_INL
+
+#include "Smp-C/ReferenceFull.h"
+#include <Smp/ReferenceFull.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ReferenceFull ### */
+#define CW_SPACE CW_root_Smp_ReferenceFull
+
+CW_THUNK void
+CW(_ReferenceFull)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::ReferenceFull *>(self)->~ReferenceFull(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetReferenceName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::ReferenceFull *>(self)->GetReferenceName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Int64)
+CW(GetReferenceSize)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int64)>(
+        static_cast<Smp::ReferenceFull *>(self)->GetReferenceSize(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "ReferenceFull" at Smp/ReferenceFull.h:29:11 (exported to Smp-C/ReferenceFull.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/ReferenceFull.h:29:11 (exported to Smp-C/ReferenceFull.h) : Reference type is not supported: ReferenceFull & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_REFERENCEFULL_INL */
@@ -0,0 +1,34 @@
+/**
+ * Opt-in interface of an event manager that emits a whole IEventManager
+ * EmitMany batch at once. Empty in C.
+ */
+#ifndef CWRAPPER_BATCHEVENTMANAGER_H
+#define CWRAPPER_BATCHEVENTMANAGER_H
+
+#include "Smp-C/Services/IEventManager.h"
+
+#ifdef __cplusplus
+
+#include <Smp/PrimitiveTypes.h>
+
+namespace CWraPPer {
+
+class BatchEventManager {
+public:
+    /* emitted counts the events emitted so far, also when one of them throws */
+    virtual void EmitMany(
+        Smp::UInt64 count,
+        const CW(CW_root_Smp_Services, EventId) * events,
+        Smp::Bool synchronous,
+        Smp::UInt64 &emitted
+    ) = 0;
+
+protected:
+    ~BatchEventManager() = default;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_BATCHEVENTMANAGER_H */
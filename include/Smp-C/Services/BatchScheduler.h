@@ -0,0 +1,34 @@
+/**
+ * Opt-in interface of a scheduler that adds a whole IScheduler
+ * AddSimulationTimeEvents batch at once. Empty in C.
+ */
+#ifndef CWRAPPER_BATCHSCHEDULER_H
+#define CWRAPPER_BATCHSCHEDULER_H
+
+#include "Smp-C/Services/IScheduler.h"
+
+#ifdef __cplusplus
+
+#include <Smp/PrimitiveTypes.h>
+
+namespace CWraPPer {
+
+class BatchScheduler {
+public:
+    /* added counts the events scheduled so far, also when one of them throws */
+    virtual void AddSimulationTimeEvents(
+        Smp::UInt64 count,
+        const CW(CW_root_Smp_Services, SimulationTimeEvent) * events,
+        CW(CW_root_Smp_Services, EventId) * eventIds,
+        Smp::UInt64 &added
+    ) = 0;
+
+protected:
+    ~BatchScheduler() = default;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_BATCHSCHEDULER_H */
@@ -49,19 +49,19 @@ typedef void CW(EntryPointAlreadySubscribed);
 #endif /* CW_root_Smp_Services_EntryPointAlreadySubscribed */
 #define CW_SPACE CW_root_Smp_Services_EntryPointAlreadySubscribed
 
-void
+CW_THUNK void
 CW(_EntryPointAlreadySubscribed)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEntryPoint) *
+CW_THUNK const CW(CW_root_Smp, IEntryPoint) *
 CW(GetEntryPoint)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetEventName)
 (
     CW() * self
@@ -49,19 +49,19 @@ typedef void CW(EntryPointNotSubscribed);
 #endif /* CW_root_Smp_Services_EntryPointNotSubscribed */
 #define CW_SPACE CW_root_Smp_Services_EntryPointNotSubscribed
 
-void
+CW_THUNK void
 CW(_EntryPointNotSubscribed)
 (
     CW() * self
 );
 
-const CW(CW_root_Smp, IEntryPoint) *
+CW_THUNK const CW(CW_root_Smp, IEntryPoint) *
 CW(GetEntryPoint)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetEventName)
 (
     CW() * self
@@ -54,20 +54,20 @@ typedef void CW(IEventManager);
 #endif /* CW_root_Smp_Services_IEventManager */
 #define CW_SPACE CW_root_Smp_Services_IEventManager
 
-void
+CW_THUNK void
 CW(_IEventManager)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(QueryEventId)
 (
     CW() * self,
     CW(CW_root_Smp, String8) eventName
 );
 
-void
+CW_THUNK void
 CW(Subscribe)
 (
     CW() * self,
@@ -75,7 +75,7 @@ CW(Subscribe)
     const CW(CW_root_Smp, IEntryPoint) * entryPoint
 );
 
-void
+CW_THUNK void
 CW(Unsubscribe)
 (
     CW() * self,
@@ -83,7 +83,7 @@ CW(Unsubscribe)
     const CW(CW_root_Smp, IEntryPoint) * entryPoint
 );
 
-void
+CW_THUNK void
 CW(Emit)
 (
     CW() * self,
@@ -91,6 +91,16 @@ CW(Emit)
     CW(CW_root_Smp, Bool) synchronous
 );
 
+/* Emits the events in order, returns the number emitted */
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(EmitMany)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp_Services, EventId) * events,
+    CW(CW_root_Smp, Bool) synchronous
+);
+
 /* Error while processing function "IEventManager" at Smp/./Services/IEventManager.h:47:15 (exported to Smp-C/Services/IEventManager.h) : Skipping constructor */
 
 /* Error while processing function "operator=" at Smp/./Services/IEventManager.h:47:15 (exported to Smp-C/Services/IEventManager.h) : Reference type is not supported: IEventManager & */
@@ -0,0 +1,157 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_IEVENTMANAGER_INL
+#define CWRAPPER_IEVENTMANAGER_INL
+
+#include "Smp-C/Services/BatchEventManager.h"
+#include "Smp-C/Services/IEventManager.h"
+#include <Smp/Services/IEventManager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::IEventManager ### */
+#define CW_SPACE CW_root_Smp_Services_IEventManager
+
+CW_THUNK void
+CW(_IEventManager)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Services::IEventManager *>(self)->~IEventManager(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(QueryEventId)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) eventName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IEventManager *>(self)->QueryEventId(
+            static_cast<Smp::String8>(eventName)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(Subscribe)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint
+) {
+    try {
+        static_cast<Smp::Services::IEventManager *>(self)->Subscribe(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<const Smp::IEntryPoint *>(entryPoint)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Unsubscribe)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint
+) {
+    try {
+        static_cast<Smp::Services::IEventManager *>(self)->Unsubscribe(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<const Smp::IEntryPoint *>(entryPoint)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(Emit)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, Bool) synchronous
+) {
+    try {
+        static_cast<Smp::Services::IEventManager *>(self)->Emit(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::Bool>(synchronous)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(EmitMany)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp_Services, EventId) * events,
+    CW(CW_root_Smp, Bool) synchronous
+) {
+    Smp::UInt64 emitted = 0u;
+    try {
+        Smp::Services::IEventManager *eventManager = static_cast<Smp::Services::IEventManager *>(self);
+        CWraPPer::BatchEventManager *batch = dynamic_cast<CWraPPer::BatchEventManager *>(eventManager);
+        if (batch != nullptr) {
+            batch->EmitMany(count, events, static_cast<Smp::Bool>(synchronous), emitted);
+            return static_cast<CW(CW_root_Smp, UInt64)>(emitted);
+        }
+        for (; emitted < count; ++emitted) {
+            eventManager->Emit(
+                static_cast<Smp::Services::EventId>(events[emitted]),
+                static_cast<Smp::Bool>(synchronous)
+            );
+        }
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return static_cast<CW(CW_root_Smp, UInt64)>(emitted);
+}
+
+/* Error while processing function "IEventManager" at Smp/./Services/IEventManager.h:47:15 (exported to Smp-C/Services/IEventManager.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./Services/IEventManager.h:47:15 (exported to Smp-C/Services/IEventManager.h) : Reference type is not supported: IEventManager & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_IEVENTMANAGER_INL */
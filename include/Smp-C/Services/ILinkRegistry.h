@@ -50,13 +50,13 @@ typedef void CW(ILinkRegistry);
 #endif /* CW_root_Smp_Services_ILinkRegistry */
 #define CW_SPACE CW_root_Smp_Services_ILinkRegistry
 
-void
+CW_THUNK void
 CW(_ILinkRegistry)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(AddLink)
 (
     CW() * self,
@@ -64,7 +64,7 @@ CW(AddLink)
     const CW(CW_root_Smp, IComponent) * target
 );
 
-CW(CW_root_Smp, UInt32)
+CW_THUNK CW(CW_root_Smp, UInt32)
 CW(GetLinkCount)
 (
     CW() * self,
@@ -72,7 +72,7 @@ CW(GetLinkCount)
     const CW(CW_root_Smp, IComponent) * target
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(RemoveLink)
 (
     CW() * self,
@@ -80,21 +80,21 @@ CW(RemoveLink)
     const CW(CW_root_Smp, IComponent) * target
 );
 
-const CW(CW_root_Smp, ComponentCollection) *
+CW_THUNK const CW(CW_root_Smp, ComponentCollection) *
 CW(GetLinkSources)
 (
     CW() * self,
     const CW(CW_root_Smp, IComponent) * target
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(CanRemove)
 (
     CW() * self,
     const CW(CW_root_Smp, IComponent) * target
 );
 
-void
+CW_THUNK void
 CW(RemoveLinks)
 (
     CW() * self,
@@ -50,20 +50,20 @@ typedef void CW(ILogger);
 #endif /* CW_root_Smp_Services_ILogger */
 #define CW_SPACE CW_root_Smp_Services_ILogger
 
-void
+CW_THUNK void
 CW(_ILogger)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, LogMessageKind)
+CW_THUNK CW(CW_root_Smp_Services, LogMessageKind)
 CW(QueryLogMessageKind)
 (
     CW() * self,
     CW(CW_root_Smp, String8) messageKindName
 );
 
-void
+CW_THUNK void
 CW(Log)
 (
     CW() * self,
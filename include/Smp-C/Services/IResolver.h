@@ -49,20 +49,20 @@ typedef void CW(IResolver);
 #endif /* CW_root_Smp_Services_IResolver */
 #define CW_SPACE CW_root_Smp_Services_IResolver
 
-void
+CW_THUNK void
 CW(_IResolver)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, IObject) *
+CW_THUNK CW(CW_root_Smp, IObject) *
 CW(ResolveAbsolute)
 (
     CW() * self,
     CW(CW_root_Smp, String8) absolutePath
 );
 
-CW(CW_root_Smp, IObject) *
+CW_THUNK CW(CW_root_Smp, IObject) *
 CW(ResolveRelative)
 (
     CW() * self,
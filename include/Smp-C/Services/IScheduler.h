@@ -44,6 +44,14 @@ typedef void CW(IEntryPoint);
 
 typedef void CW(IScheduler);
 
+/* One event of IScheduler AddSimulationTimeEvents */
+typedef struct {
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint;
+    CW(CW_root_Smp, Duration) simulationTime;
+    CW(CW_root_Smp, Duration) cycleTime;
+    CW(CW_root_Smp, Int64) repeat;
+} CW(SimulationTimeEvent);
+
 #undef CW_SPACE
 
 
@@ -53,20 +61,20 @@ typedef void CW(IScheduler);
 #endif /* CW_root_Smp_Services_IScheduler */
 #define CW_SPACE CW_root_Smp_Services_IScheduler
 
-void
+CW_THUNK void
 CW(_IScheduler)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(AddImmediateEvent)
 (
     CW() * self,
     const CW(CW_root_Smp, IEntryPoint) * entryPoint
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(AddSimulationTimeEvent)
 (
     CW() * self,
@@ -76,7 +84,22 @@ CW(AddSimulationTimeEvent)
     CW(CW_root_Smp, Int64) repeat
 );
 
-CW(CW_root_Smp_Services, EventId)
+/*
+ * Adds count events as AddSimulationTimeEvent would and returns how many
+ * were added, eventIds receiving their ids; the first failure stops the
+ * batch (see ExceptionRecord). Schedulers of this library, such as
+ * TimingWheelScheduler, add the whole batch under a single lock.
+ */
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(AddSimulationTimeEvents)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp_Services, SimulationTimeEvent) * events,
+    CW(CW_root_Smp_Services, EventId) * eventIds
+);
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(AddMissionTimeEvent)
 (
     CW() * self,
@@ -86,7 +109,7 @@ CW(AddMissionTimeEvent)
     CW(CW_root_Smp, Int64) repeat
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(AddEpochTimeEvent)
 (
     CW() * self,
@@ -96,7 +119,7 @@ CW(AddEpochTimeEvent)
     CW(CW_root_Smp, Int64) repeat
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(AddZuluTimeEvent)
 (
     CW() * self,
@@ -106,7 +129,7 @@ CW(AddZuluTimeEvent)
     CW(CW_root_Smp, Int64) repeat
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(AddRelativeZuluTimeEvent)
 (
     CW() * self,
@@ -116,7 +139,7 @@ CW(AddRelativeZuluTimeEvent)
     CW(CW_root_Smp, Int64) repeat
 );
 
-void
+CW_THUNK void
 CW(SetEventSimulationTime)
 (
     CW() * self,
@@ -124,7 +147,7 @@ CW(SetEventSimulationTime)
     CW(CW_root_Smp, Duration) simulationTime
 );
 
-void
+CW_THUNK void
 CW(SetEventMissionTime)
 (
     CW() * self,
@@ -132,7 +155,7 @@ CW(SetEventMissionTime)
     CW(CW_root_Smp, Duration) missionTime
 );
 
-void
+CW_THUNK void
 CW(SetEventEpochTime)
 (
     CW() * self,
@@ -140,7 +163,7 @@ CW(SetEventEpochTime)
     CW(CW_root_Smp, DateTime) epochTime
 );
 
-void
+CW_THUNK void
 CW(SetEventZuluTime)
 (
     CW() * self,
@@ -148,7 +171,7 @@ CW(SetEventZuluTime)
     CW(CW_root_Smp, DateTime) zuluTime
 );
 
-void
+CW_THUNK void
 CW(SetEventCycleTime)
 (
     CW() * self,
@@ -156,7 +179,7 @@ CW(SetEventCycleTime)
     CW(CW_root_Smp, Duration) cycleTime
 );
 
-void
+CW_THUNK void
 CW(SetEventRepeat)
 (
     CW() * self,
@@ -164,26 +187,26 @@ CW(SetEventRepeat)
     CW(CW_root_Smp, Int64) repeat
 );
 
-void
+CW_THUNK void
 CW(RemoveEvent)
 (
     CW() * self,
     CW(CW_root_Smp_Services, EventId) event
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(GetCurrentEventId)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Duration)
+CW_THUNK CW(CW_root_Smp, Duration)
 CW(GetNextScheduledEventTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Bool)
+CW_THUNK CW(CW_root_Smp, Bool)
 CW(IsEventScheduled)
 (
     CW() * self,
@@ -0,0 +1,389 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ISCHEDULER_INL
+#define CWRAPPER_ISCHEDULER_INL
+
+#include "Smp-C/Services/BatchScheduler.h"
+#include "Smp-C/Services/IScheduler.h"
+#include <Smp/Services/IScheduler.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::IScheduler ### */
+#define CW_SPACE CW_root_Smp_Services_IScheduler
+
+CW_THUNK void
+CW(_IScheduler)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->~IScheduler(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(AddImmediateEvent)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IScheduler *>(self)->AddImmediateEvent(
+            static_cast<const Smp::IEntryPoint *>(entryPoint)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(AddSimulationTimeEvent)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint,
+    CW(CW_root_Smp, Duration) simulationTime,
+    CW(CW_root_Smp, Duration) cycleTime,
+    CW(CW_root_Smp, Int64) repeat
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IScheduler *>(self)->AddSimulationTimeEvent(
+            static_cast<const Smp::IEntryPoint *>(entryPoint),
+            static_cast<Smp::Duration>(simulationTime),
+            static_cast<Smp::Duration>(cycleTime),
+            static_cast<Smp::Int64>(repeat)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, UInt64)
+CW(AddSimulationTimeEvents)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp_Services, SimulationTimeEvent) * events,
+    CW(CW_root_Smp_Services, EventId) * eventIds
+) {
+    Smp::UInt64 added = 0u;
+    try {
+        Smp::Services::IScheduler *scheduler = static_cast<Smp::Services::IScheduler *>(self);
+        CWraPPer::BatchScheduler *batch = dynamic_cast<CWraPPer::BatchScheduler *>(scheduler);
+        if (batch != nullptr) {
+            batch->AddSimulationTimeEvents(count, events, eventIds, added);
+            return static_cast<CW(CW_root_Smp, UInt64)>(added);
+        }
+        for (; added < count; ++added) {
+            const CW(CW_root_Smp_Services, SimulationTimeEvent) &event = events[added];
+            eventIds[added] = static_cast<CW(CW_root_Smp_Services, EventId)>(
+            scheduler->AddSimulationTimeEvent(
+                static_cast<const Smp::IEntryPoint *>(event.entryPoint),
+                static_cast<Smp::Duration>(event.simulationTime),
+                static_cast<Smp::Duration>(event.cycleTime),
+                static_cast<Smp::Int64>(event.repeat)
+            ));
+        }
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return static_cast<CW(CW_root_Smp, UInt64)>(added);
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(AddMissionTimeEvent)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint,
+    CW(CW_root_Smp, Duration) missionTime,
+    CW(CW_root_Smp, Duration) cycleTime,
+    CW(CW_root_Smp, Int64) repeat
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IScheduler *>(self)->AddMissionTimeEvent(
+            static_cast<const Smp::IEntryPoint *>(entryPoint),
+            static_cast<Smp::Duration>(missionTime),
+            static_cast<Smp::Duration>(cycleTime),
+            static_cast<Smp::Int64>(repeat)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(AddEpochTimeEvent)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint,
+    CW(CW_root_Smp, DateTime) epochTime,
+    CW(CW_root_Smp, Duration) cycleTime,
+    CW(CW_root_Smp, Int64) repeat
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IScheduler *>(self)->AddEpochTimeEvent(
+            static_cast<const Smp::IEntryPoint *>(entryPoint),
+            static_cast<Smp::DateTime>(epochTime),
+            static_cast<Smp::Duration>(cycleTime),
+            static_cast<Smp::Int64>(repeat)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(AddZuluTimeEvent)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint,
+    CW(CW_root_Smp, DateTime) zuluTime,
+    CW(CW_root_Smp, Duration) cycleTime,
+    CW(CW_root_Smp, Int64) repeat
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IScheduler *>(self)->AddZuluTimeEvent(
+            static_cast<const Smp::IEntryPoint *>(entryPoint),
+            static_cast<Smp::DateTime>(zuluTime),
+            static_cast<Smp::Duration>(cycleTime),
+            static_cast<Smp::Int64>(repeat)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(AddRelativeZuluTimeEvent)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IEntryPoint) * entryPoint,
+    CW(CW_root_Smp, Duration) zuluTimeDelay,
+    CW(CW_root_Smp, Duration) cycleTime,
+    CW(CW_root_Smp, Int64) repeat
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IScheduler *>(self)->AddRelativeZuluTimeEvent(
+            static_cast<const Smp::IEntryPoint *>(entryPoint),
+            static_cast<Smp::Duration>(zuluTimeDelay),
+            static_cast<Smp::Duration>(cycleTime),
+            static_cast<Smp::Int64>(repeat)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(SetEventSimulationTime)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, Duration) simulationTime
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->SetEventSimulationTime(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::Duration>(simulationTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetEventMissionTime)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, Duration) missionTime
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->SetEventMissionTime(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::Duration>(missionTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetEventEpochTime)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, DateTime) epochTime
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->SetEventEpochTime(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::DateTime>(epochTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetEventZuluTime)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, DateTime) zuluTime
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->SetEventZuluTime(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::DateTime>(zuluTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetEventCycleTime)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, Duration) cycleTime
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->SetEventCycleTime(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::Duration>(cycleTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetEventRepeat)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, Int64) repeat
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->SetEventRepeat(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::Int64>(repeat)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(RemoveEvent)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event
+) {
+    try {
+        static_cast<Smp::Services::IScheduler *>(self)->RemoveEvent(
+            static_cast<Smp::Services::EventId>(event)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp_Services, EventId)
+CW(GetCurrentEventId)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        static_cast<Smp::Services::IScheduler *>(self)->GetCurrentEventId(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Duration)
+CW(GetNextScheduledEventTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Duration)>(
+        static_cast<Smp::Services::IScheduler *>(self)->GetNextScheduledEventTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(IsEventScheduled)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) eventId
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<Smp::Services::IScheduler *>(self)->IsEventScheduled(
+            static_cast<Smp::Services::EventId>(eventId)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "IScheduler" at Smp/./Services/IScheduler.h:49:15 (exported to Smp-C/Services/IScheduler.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./Services/IScheduler.h:49:15 (exported to Smp-C/Services/IScheduler.h) : Reference type is not supported: IScheduler & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ISCHEDULER_INL */
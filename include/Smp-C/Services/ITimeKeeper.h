@@ -48,64 +48,64 @@ typedef void CW(ITimeKeeper);
 #endif /* CW_root_Smp_Services_ITimeKeeper */
 #define CW_SPACE CW_root_Smp_Services_ITimeKeeper
 
-void
+CW_THUNK void
 CW(_ITimeKeeper)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Duration)
+CW_THUNK CW(CW_root_Smp, Duration)
 CW(GetSimulationTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, DateTime)
+CW_THUNK CW(CW_root_Smp, DateTime)
 CW(GetEpochTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, DateTime)
+CW_THUNK CW(CW_root_Smp, DateTime)
 CW(GetMissionStartTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Duration)
+CW_THUNK CW(CW_root_Smp, Duration)
 CW(GetMissionTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, DateTime)
+CW_THUNK CW(CW_root_Smp, DateTime)
 CW(GetZuluTime)
 (
     CW() * self
 );
 
-void
+CW_THUNK void
 CW(SetSimulationTime)
 (
     CW() * self,
     CW(CW_root_Smp, Duration) simulationTime
 );
 
-void
+CW_THUNK void
 CW(SetEpochTime)
 (
     CW() * self,
     CW(CW_root_Smp, DateTime) epochTime
 );
 
-void
+CW_THUNK void
 CW(SetMissionStartTime)
 (
     CW() * self,
     CW(CW_root_Smp, DateTime) missionStart
 );
 
-void
+CW_THUNK void
 CW(SetMissionTime)
 (
     CW() * self,
@@ -0,0 +1,195 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_ITIMEKEEPER_INL
+#define CWRAPPER_ITIMEKEEPER_INL
+
+#include "Smp-C/Services/ITimeKeeper.h"
+#include <Smp/Services/ITimeKeeper.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::ITimeKeeper ### */
+#define CW_SPACE CW_root_Smp_Services_ITimeKeeper
+
+CW_THUNK void
+CW(_ITimeKeeper)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Services::ITimeKeeper *>(self)->~ITimeKeeper(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Duration)
+CW(GetSimulationTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Duration)>(
+        static_cast<Smp::Services::ITimeKeeper *>(self)->GetSimulationTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, DateTime)
+CW(GetEpochTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, DateTime)>(
+        static_cast<Smp::Services::ITimeKeeper *>(self)->GetEpochTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, DateTime)
+CW(GetMissionStartTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, DateTime)>(
+        static_cast<Smp::Services::ITimeKeeper *>(self)->GetMissionStartTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Duration)
+CW(GetMissionTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Duration)>(
+        static_cast<Smp::Services::ITimeKeeper *>(self)->GetMissionTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, DateTime)
+CW(GetZuluTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, DateTime)>(
+        static_cast<Smp::Services::ITimeKeeper *>(self)->GetZuluTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK void
+CW(SetSimulationTime)
+(
+    CW() * self,
+    CW(CW_root_Smp, Duration) simulationTime
+) {
+    try {
+        static_cast<Smp::Services::ITimeKeeper *>(self)->SetSimulationTime(
+            static_cast<Smp::Duration>(simulationTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetEpochTime)
+(
+    CW() * self,
+    CW(CW_root_Smp, DateTime) epochTime
+) {
+    try {
+        static_cast<Smp::Services::ITimeKeeper *>(self)->SetEpochTime(
+            static_cast<Smp::DateTime>(epochTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetMissionStartTime)
+(
+    CW() * self,
+    CW(CW_root_Smp, DateTime) missionStart
+) {
+    try {
+        static_cast<Smp::Services::ITimeKeeper *>(self)->SetMissionStartTime(
+            static_cast<Smp::DateTime>(missionStart)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK void
+CW(SetMissionTime)
+(
+    CW() * self,
+    CW(CW_root_Smp, Duration) missionTime
+) {
+    try {
+        static_cast<Smp::Services::ITimeKeeper *>(self)->SetMissionTime(
+            static_cast<Smp::Duration>(missionTime)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "ITimeKeeper" at Smp/./Services/ITimeKeeper.h:34:15 (exported to Smp-C/Services/ITimeKeeper.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/./Services/ITimeKeeper.h:34:15 (exported to Smp-C/Services/ITimeKeeper.h) : Reference type is not supported: ITimeKeeper & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_ITIMEKEEPER_INL */
@@ -46,7 +46,7 @@ typedef void CW(InvalidCycleTime);
 #endif /* CW_root_Smp_Services_InvalidCycleTime */
 #define CW_SPACE CW_root_Smp_Services_InvalidCycleTime
 
-void
+CW_THUNK void
 CW(_InvalidCycleTime)
 (
     CW() * self
@@ -0,0 +1,60 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDCYCLETIME_INL
+#define CWRAPPER_INVALIDCYCLETIME_INL
+
+#include "Smp-C/Services/InvalidCycleTime.h"
+#include <Smp/Services/InvalidCycleTime.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::InvalidCycleTime ### */
+#define CW_SPACE CW_root_Smp_Services_InvalidCycleTime
+
+CW_THUNK void
+CW(_InvalidCycleTime)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Services::InvalidCycleTime *>(self)->~InvalidCycleTime(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "InvalidCycleTime" at Smp/Services/InvalidCycleTime.h:32:15 (exported to Smp-C/Services/InvalidCycleTime.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/Services/InvalidCycleTime.h:32:15 (exported to Smp-C/Services/InvalidCycleTime.h) : Reference type is not supported: InvalidCycleTime & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDCYCLETIME_INL */
@@ -47,13 +47,13 @@ typedef void CW(InvalidEventId);
 #endif /* CW_root_Smp_Services_InvalidEventId */
 #define CW_SPACE CW_root_Smp_Services_InvalidEventId
 
-void
+CW_THUNK void
 CW(_InvalidEventId)
 (
     CW() * self
 );
 
-CW(CW_root_Smp_Services, EventId)
+CW_THUNK CW(CW_root_Smp_Services, EventId)
 CW(GetInvalidEventId)
 (
     CW() * self
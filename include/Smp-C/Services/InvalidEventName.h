@@ -46,7 +46,7 @@ typedef void CW(InvalidEventName);
 #endif /* CW_root_Smp_Services_InvalidEventName */
 #define CW_SPACE CW_root_Smp_Services_InvalidEventName
 
-void
+CW_THUNK void
 CW(_InvalidEventName)
 (
     CW() * self
@@ -46,7 +46,7 @@ typedef void CW(InvalidEventTime);
 #endif /* CW_root_Smp_Services_InvalidEventTime */
 #define CW_SPACE CW_root_Smp_Services_InvalidEventTime
 
-void
+CW_THUNK void
 CW(_InvalidEventTime)
 (
     CW() * self
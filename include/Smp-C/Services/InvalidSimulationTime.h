@@ -47,25 +47,25 @@ typedef void CW(InvalidSimulationTime);
 #endif /* CW_root_Smp_Services_InvalidSimulationTime */
 #define CW_SPACE CW_root_Smp_Services_InvalidSimulationTime
 
-void
+CW_THUNK void
 CW(_InvalidSimulationTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Duration)
+CW_THUNK CW(CW_root_Smp, Duration)
 CW(GetCurrentTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Duration)
+CW_THUNK CW(CW_root_Smp, Duration)
 CW(GetProvidedTime)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, Duration)
+CW_THUNK CW(CW_root_Smp, Duration)
 CW(GetMaximumTime)
 (
     CW() * self
@@ -0,0 +1,105 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_INVALIDSIMULATIONTIME_INL
+#define CWRAPPER_INVALIDSIMULATIONTIME_INL
+
+#include "Smp-C/Services/InvalidSimulationTime.h"
+#include <Smp/Services/InvalidSimulationTime.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::InvalidSimulationTime ### */
+#define CW_SPACE CW_root_Smp_Services_InvalidSimulationTime
+
+CW_THUNK void
+CW(_InvalidSimulationTime)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::Services::InvalidSimulationTime *>(self)->~InvalidSimulationTime(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, Duration)
+CW(GetCurrentTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Duration)>(
+        static_cast<Smp::Services::InvalidSimulationTime *>(self)->GetCurrentTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Duration)
+CW(GetProvidedTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Duration)>(
+        static_cast<Smp::Services::InvalidSimulationTime *>(self)->GetProvidedTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW_THUNK CW(CW_root_Smp, Duration)
+CW(GetMaximumTime)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Duration)>(
+        static_cast<Smp::Services::InvalidSimulationTime *>(self)->GetMaximumTime(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "InvalidSimulationTime" at Smp/Services/InvalidSimulationTime.h:33:15 (exported to Smp-C/Services/InvalidSimulationTime.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/Services/InvalidSimulationTime.h:33:15 (exported to Smp-C/Services/InvalidSimulationTime.h) : Reference type is not supported: InvalidSimulationTime & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_INVALIDSIMULATIONTIME_INL */
@@ -0,0 +1,87 @@
+/**
+ * Cached QueryLogMessageKind and QueryEventId.
+ *
+ * The first query of a name on a logger or an event manager goes to the
+ * service; later queries of the same name return the interned id without
+ * calling it. Each thread first looks the name up in its own small table
+ * keyed by the string pointer and checked with the content hash, then in
+ * a table shared by all threads keyed by the content, so a name built in
+ * a reused buffer is still found. Ids are cached per service pointer:
+ * call Clear when a logger or an event manager is destroyed.
+ */
+#ifndef CWRAPPER_QUERYCACHE_H
+#define CWRAPPER_QUERYCACHE_H
+
+#include "../CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/PrimitiveTypes.h"
+#include "Smp-C/Services/EventId.h"
+#include "Smp-C/Services/IEventManager.h"
+#include "Smp-C/Services/ILogger.h"
+#include "Smp-C/Services/LogMessageKind.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#ifndef CW_root_Smp_Services
+#define CW_root_Smp_Services CW_BUILD_SPACE(CW_root_Smp, Services)
+#endif /* CW_root_Smp_Services */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::QueryCache ### */
+#ifndef CW_root_Smp_Services_QueryCache
+#define CW_root_Smp_Services_QueryCache CW_BUILD_SPACE(CW_root_Smp_Services, QueryCache)
+#endif /* CW_root_Smp_Services_QueryCache */
+#define CW_SPACE CW_root_Smp_Services_QueryCache
+
+CW(CW_root_Smp_Services, LogMessageKind)
+CW(QueryLogMessageKind)
+(
+    CW(CW_root_Smp_Services, ILogger) * logger,
+    CW(CW_root_Smp, String8) messageKindName
+);
+
+CW(CW_root_Smp_Services, EventId)
+CW(QueryEventId)
+(
+    CW(CW_root_Smp_Services, IEventManager) * eventManager,
+    CW(CW_root_Smp, String8) eventName
+);
+
+/* Forgets every cached id, of every thread */
+void
+CW(Clear)
+(
+    void
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_QUERYCACHE_H */
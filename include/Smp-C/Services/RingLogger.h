@@ -0,0 +1,165 @@
+/**
+ * Logger service writing to a file from a background thread.
+ *
+ * Implements ILogger, so once created it is added to a simulator with
+ * ISimulator AddService (through GetService) and used with the ILogger
+ * functions (through GetLogger). Log copies the record into a lock-free
+ * ring owned by the calling thread and returns; it never waits on the
+ * file; when the ring of the thread is full, the record is dropped and
+ * counted in GetDroppedCount. A drain thread empties the rings into the
+ * file every few milliseconds. Records of one thread keep their order;
+ * records of different threads may interleave.
+ *
+ * Each record holds the simulation time of the time keeper of the
+ * connected simulator, the kind, the sender path and the message. With
+ * RegisterFormat and LogFormat, the message is a printf-like format id
+ * plus the raw arguments, formatted by the drain thread instead of the
+ * model thread (conversions d i u o x X c f F e E g G a A s p, without
+ * '*' width nor precision).
+ *
+ * A text log has one line per record. A binary log keeps the records as
+ * they were logged and defines each kind, format and sender once; Decode
+ * turns it into the same text on a machine of the same byte order.
+ *
+ * QueryLogMessageKind knows the standard kinds (Information 0, Event 1,
+ * Warning 2, Error 3, Debug 4) and gives the next free kind to any other
+ * name.
+ */
+#ifndef CWRAPPER_RINGLOGGER_H
+#define CWRAPPER_RINGLOGGER_H
+
+#include "../CWraPPer.h"
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IObject.h"
+#include "Smp-C/IService.h"
+#include "Smp-C/PrimitiveTypes.h"
+#include "Smp-C/Services/ILogger.h"
+#include "Smp-C/Services/LogMessageKind.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#ifndef CW_root_Smp_Services
+#define CW_root_Smp_Services CW_BUILD_SPACE(CW_root_Smp, Services)
+#endif /* CW_root_Smp_Services */
+#define CW_SPACE CW_root_Smp_Services
+
+typedef void CW(RingLogger);
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::RingLogger ### */
+#ifndef CW_root_Smp_Services_RingLogger
+#define CW_root_Smp_Services_RingLogger CW_BUILD_SPACE(CW_root_Smp_Services, RingLogger)
+#endif /* CW_root_Smp_Services_RingLogger */
+#define CW_SPACE CW_root_Smp_Services_RingLogger
+
+/* ringCapacity is the size in bytes of the ring of each thread (0 for 64 KiB) */
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, IObject) * parent,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) ringCapacity,
+    CW(CW_root_Smp, Bool) binary
+);
+
+/* Writes the pending records, then closes the file */
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp_Services, ILogger) *
+CW(GetLogger)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IService) *
+CW(GetService)
+(
+    CW() * self
+);
+
+/* Returns the id to give to LogFormat, 0 for an invalid format */
+CW(CW_root_Smp, UInt32)
+CW(RegisterFormat)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) format
+);
+
+void
+CW(LogFormat)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IObject) * sender,
+    CW(CW_root_Smp_Services, LogMessageKind) kind,
+    CW(CW_root_Smp, UInt32) format,
+    ...
+);
+
+void
+CW(LogFormatList)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IObject) * sender,
+    CW(CW_root_Smp_Services, LogMessageKind) kind,
+    CW(CW_root_Smp, UInt32) format,
+    va_list arguments
+);
+
+/* Returns once every record logged before the call is in the file */
+void
+CW(Flush)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, UInt64)
+CW(GetDroppedCount)
+(
+    const CW() * self
+);
+
+/* Writes the text of a binary log, returns the number of records */
+CW(CW_root_Smp, UInt64)
+CW(Decode)
+(
+    CW(CW_root_Smp, String8) logFileName,
+    CW(CW_root_Smp, String8) textFileName
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_RINGLOGGER_H */
@@ -0,0 +1,39 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_TIMEKIND_INL
+#define CWRAPPER_TIMEKIND_INL
+
+#include "Smp-C/Services/TimeKind.h"
+#include <Smp/Services/TimeKind.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+/* Error while processing function "operator<<" at Smp/./Services/TimeKind.h:172:23 (exported to Smp-C/Services/TimeKind.h) : Reference type is not supported: std::ostream & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_TIMEKIND_INL */
@@ -0,0 +1,138 @@
+/**
+ * Scheduler service built on a hierarchical timing wheel.
+ *
+ * Implements IScheduler, so once created it is added to a simulator with
+ * ISimulator AddService (through GetService) and used with the IScheduler
+ * functions (through GetScheduler). Events live in slab storage indexed
+ * by their EventId; adding, moving and removing an event is O(1).
+ *
+ * Time is split in ticks of the given resolution (0 for 1 ms); events in
+ * the same tick still run in simulation time order, then in the order
+ * they were added. Advance executes every event due up to the given
+ * simulation time and forwards that time to the time keeper of the
+ * connected simulator. Mission, epoch and Zulu times are converted to
+ * simulation time with that time keeper when the event is (re)scheduled.
+ * GetNextScheduledEventTime returns an absolute simulation time, or -1
+ * when nothing is scheduled.
+ *
+ * With SetWorkerCount, events flagged with SetEventIndependent that are
+ * due at the same simulation time run concurrently on a work-stealing
+ * pool (the thread calling Advance takes part), GetCurrentEventId giving
+ * each thread the event it runs. Other events keep running one by one
+ * and act as barriers between such groups. SetWorkerCount fails (see
+ * ExceptionRecord) while such a group runs, e.g. from one of its entry
+ * points or from another thread.
+ */
+#ifndef CWRAPPER_TIMINGWHEELSCHEDULER_H
+#define CWRAPPER_TIMINGWHEELSCHEDULER_H
+
+#include "../CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/IObject.h"
+#include "Smp-C/IService.h"
+#include "Smp-C/PrimitiveTypes.h"
+#include "Smp-C/Services/IScheduler.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#ifndef CW_root_Smp_Services
+#define CW_root_Smp_Services CW_BUILD_SPACE(CW_root_Smp, Services)
+#endif /* CW_root_Smp_Services */
+#define CW_SPACE CW_root_Smp_Services
+
+typedef void CW(TimingWheelScheduler);
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::TimingWheelScheduler ### */
+#ifndef CW_root_Smp_Services_TimingWheelScheduler
+#define CW_root_Smp_Services_TimingWheelScheduler CW_BUILD_SPACE(CW_root_Smp_Services, TimingWheelScheduler)
+#endif /* CW_root_Smp_Services_TimingWheelScheduler */
+#define CW_SPACE CW_root_Smp_Services_TimingWheelScheduler
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, IObject) * parent,
+    CW(CW_root_Smp, Duration) resolution
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp_Services, IScheduler) *
+CW(GetScheduler)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, IService) *
+CW(GetService)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, Duration)
+CW(GetSimulationTime)
+(
+    const CW() * self
+);
+
+/* 0 runs every event on the thread calling Advance */
+void
+CW(SetWorkerCount)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) workerCount
+);
+
+void
+CW(SetEventIndependent)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, Bool) independent
+);
+
+/* Returns the number of events executed */
+CW(CW_root_Smp, UInt64)
+CW(Advance)
+(
+    CW() * self,
+    CW(CW_root_Smp, Duration) simulationTime
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_TIMINGWHEELSCHEDULER_H */
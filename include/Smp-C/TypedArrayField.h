@@ -0,0 +1,34 @@
+/**
+ * Opt-in interface of a simple array field that hands out its items as
+ * native values of its primitive type, for the typed ISimpleArrayField
+ * GetValues and SetValues thunks. Empty in C.
+ */
+#ifndef CWRAPPER_TYPEDARRAYFIELD_H
+#define CWRAPPER_TYPEDARRAYFIELD_H
+
+#include "Smp-C/ISimpleArrayField.h"
+
+#ifdef __cplusplus
+
+#include <Smp/PrimitiveTypeKind.h>
+#include <Smp/PrimitiveTypes.h>
+
+namespace CWraPPer {
+
+class TypedArrayField {
+public:
+    virtual Smp::PrimitiveTypeKind GetItemKind() const = 0;
+
+    /* values holds length items of GetItemKind, with the same range checks as GetValues and SetValues */
+    virtual void GetItems(Smp::UInt64 length, void *values, Smp::UInt64 startIndex) const = 0;
+    virtual void SetItems(Smp::UInt64 length, const void *values, Smp::UInt64 startIndex) = 0;
+
+protected:
+    ~TypedArrayField() = default;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_TYPEDARRAYFIELD_H */
@@ -11,6 +11,11 @@ extern "C" {
 #endif /* __cplusplus */
 
 
+#include "Smp-C/Bool.h"
+#include "Smp-C/Char8.h"
+#include "Smp-C/Int32.h"
+#include "Smp-C/String8.h"
+#include "Smp-C/UInt64.h"
 /* #include <array> */
 #include <stdint.h>
 /* #include <iosfwd> */
@@ -39,7 +44,12 @@ typedef void CW(hash);
 #endif /* CW_root_Smp */
 #define CW_SPACE CW_root_Smp
 
-typedef void CW(Uuid);
+/* Same layout as Smp::Uuid, usable by value */
+typedef struct {
+    uint32_t Data1;
+    uint16_t Data2[3];
+    uint8_t Data3[6];
+} CW(Uuid);
 
 #undef CW_SPACE
 
@@ -50,6 +60,10 @@ typedef void CW(Uuid);
 #endif /* CW_root_Smp_Uuid */
 #define CW_SPACE CW_root_Smp_Uuid
 
+enum {
+    CW(StringLength) = 37
+};
+
 /* Error while processing function "Uuid" at Smp/Uuid.h:57:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
 
 /* Error while processing function "Uuid" at Smp/Uuid.h:71:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
@@ -60,7 +74,7 @@ typedef void CW(Uuid);
 
 /* Error while processing function "Uuid" at Smp/Uuid.h:127:18 (exported to Smp-C/Uuid.h) : Skipping constructor */
 
-void
+CW_THUNK void
 CW(_Uuid)
 (
     CW() * self
@@ -74,11 +88,87 @@ CW(_Uuid)
 
 /* Error while processing function "operator=" at Smp/Uuid.h:143:15 (exported to Smp-C/Uuid.h) : Reference type is not supported: Uuid & */
 
-/* Error while processing function "operator==" at Smp/Uuid.h:148:14 (exported to Smp-C/Uuid.h) : Reference type is not supported: const Smp::Uuid & */
+/* Comparison and hashing only read the fields: defined here to be inlined */
+
+static inline CW(CW_root_Smp, Bool)
+CW(Equals)
+(
+    const CW() * self,
+    const CW() * other
+) {
+    int i;
+    if (self->Data1 != other->Data1) {
+        return false;
+    }
+    for (i = 0; i < 3; ++i) {
+        if (self->Data2[i] != other->Data2[i]) {
+            return false;
+        }
+    }
+    for (i = 0; i < 6; ++i) {
+        if (self->Data3[i] != other->Data3[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static inline CW(CW_root_Smp, Int32)
+CW(Compare)
+(
+    const CW() * self,
+    const CW() * other
+) {
+    int i;
+    if (self->Data1 != other->Data1) {
+        return self->Data1 < other->Data1 ? -1 : 1;
+    }
+    for (i = 0; i < 3; ++i) {
+        if (self->Data2[i] != other->Data2[i]) {
+            return self->Data2[i] < other->Data2[i] ? -1 : 1;
+        }
+    }
+    for (i = 0; i < 6; ++i) {
+        if (self->Data3[i] != other->Data3[i]) {
+            return self->Data3[i] < other->Data3[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+static inline CW(CW_root_Smp, UInt64)
+CW(Hash)
+(
+    const CW() * self
+) {
+    uint64_t high = ((uint64_t)self->Data1 << 32) | ((uint64_t)self->Data2[0] << 16) | self->Data2[1];
+    uint64_t low = (uint64_t)self->Data2[2] << 48;
+    int i;
+    for (i = 0; i < 6; ++i) {
+        low |= (uint64_t)self->Data3[i] << (40 - 8 * i);
+    }
+    high ^= low * UINT64_C(0x9E3779B97F4A7C15);
+    high ^= high >> 33;
+    high *= UINT64_C(0xFF51AFD7ED558CCD);
+    high ^= high >> 33;
+    high *= UINT64_C(0xC4CEB9FE1A85EC53);
+    high ^= high >> 33;
+    return high;
+}
 
-/* Error while processing function "operator!=" at Smp/Uuid.h:154:14 (exported to Smp-C/Uuid.h) : Reference type is not supported: const Smp::Uuid & */
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(Parse)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) text
+);
 
-/* Error while processing function "operator<" at Smp/Uuid.h:160:14 (exported to Smp-C/Uuid.h) : Reference type is not supported: const Uuid & */
+CW_THUNK void
+CW(Format)
+(
+    const CW() * self,
+    CW(CW_root_Smp, Char8) * text
+);
 
 #undef CW_SPACE
 
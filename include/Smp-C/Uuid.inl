@@ -0,0 +1,173 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_UUID_INL
+#define CWRAPPER_UUID_INL
+
+#include "Smp-C/Uuid.h"
+#include <Smp/Uuid.h>
+#include <cstdint>
+
+static_assert(sizeof(CW(CW_root_Smp, Uuid)) == sizeof(Smp::Uuid), "Smp-C Uuid must match Smp::Uuid");
+static_assert(alignof(CW(CW_root_Smp, Uuid)) == alignof(Smp::Uuid), "Smp-C Uuid must match Smp::Uuid");
+
+namespace {
+
+/* Reads count hexadecimal digits, returns false on any other character */
+template <typename T>
+bool UuidReadHex(const char *&text, int count, T &value) {
+    std::uint64_t result = 0u;
+    for (int i = 0; i < count; ++i, ++text) {
+        const char c = *text;
+        std::uint64_t digit;
+        if (c >= '0' && c <= '9') {
+            digit = static_cast<std::uint64_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            digit = static_cast<std::uint64_t>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            digit = static_cast<std::uint64_t>(c - 'A' + 10);
+        } else {
+            return false;
+        }
+        result = (result << 4) | digit;
+    }
+    value = static_cast<T>(result);
+    return true;
+}
+
+bool UuidReadDash(const char *&text) {
+    return *text++ == '-';
+}
+
+void UuidWriteHex(char *&text, int count, std::uint64_t value) {
+    static const char digits[] = "0123456789abcdef";
+    for (int i = count - 1; i >= 0; --i) {
+        text[i] = digits[value & 0xFu];
+        value >>= 4;
+    }
+    text += count;
+}
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### std ### */
+#define CW_SPACE CW_root_std
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Uuid ### */
+#define CW_SPACE CW_root_Smp_Uuid
+
+/* Error while processing function "Uuid" at Smp/Uuid.h:57:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
+
+/* Error while processing function "Uuid" at Smp/Uuid.h:71:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
+
+/* Error while processing function "Uuid" at Smp/Uuid.h:100:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
+
+/* Error while processing function "Uuid" at Smp/Uuid.h:117:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
+
+/* Error while processing function "Uuid" at Smp/Uuid.h:127:18 (exported to Smp-C/Uuid.h) : Skipping constructor */
+
+CW_THUNK void
+CW(_Uuid)
+(
+    CW() * self
+) {
+    try {
+        reinterpret_cast<Smp::Uuid *>(self)->~Uuid(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+/* Error while processing function "Uuid" at Smp/Uuid.h:134:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
+
+/* Error while processing function "Uuid" at Smp/Uuid.h:137:19 (exported to Smp-C/Uuid.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/Uuid.h:140:15 (exported to Smp-C/Uuid.h) : Reference type is not supported: Uuid & */
+
+/* Error while processing function "operator=" at Smp/Uuid.h:143:15 (exported to Smp-C/Uuid.h) : Reference type is not supported: Uuid & */
+
+CW_THUNK CW(CW_root_Smp, Bool)
+CW(Parse)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) text
+) {
+    CW() uuid;
+    const char *cursor = text;
+    if (cursor == nullptr
+        || !UuidReadHex(cursor, 8, uuid.Data1) || !UuidReadDash(cursor)
+        || !UuidReadHex(cursor, 4, uuid.Data2[0]) || !UuidReadDash(cursor)
+        || !UuidReadHex(cursor, 4, uuid.Data2[1]) || !UuidReadDash(cursor)
+        || !UuidReadHex(cursor, 4, uuid.Data2[2]) || !UuidReadDash(cursor)) {
+        return false;
+    }
+    for (int i = 0; i < 6; ++i) {
+        if (!UuidReadHex(cursor, 2, uuid.Data3[i])) {
+            return false;
+        }
+    }
+    if (*cursor != '\0') {
+        return false;
+    }
+    *self = uuid;
+    return true;
+}
+
+CW_THUNK void
+CW(Format)
+(
+    const CW() * self,
+    CW(CW_root_Smp, Char8) * text
+) {
+    char *cursor = text;
+    UuidWriteHex(cursor, 8, self->Data1);
+    *cursor++ = '-';
+    UuidWriteHex(cursor, 4, self->Data2[0]);
+    *cursor++ = '-';
+    UuidWriteHex(cursor, 4, self->Data2[1]);
+    *cursor++ = '-';
+    UuidWriteHex(cursor, 4, self->Data2[2]);
+    *cursor++ = '-';
+    for (int i = 0; i < 6; ++i) {
+        UuidWriteHex(cursor, 2, self->Data3[i]);
+    }
+    *cursor = '\0';
+}
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+/* Error while processing function "operator<<" at Smp/Uuid.h:165:19 (exported to Smp-C/Uuid.h) : Reference type is not supported: std::ostream & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_UUID_INL */
@@ -0,0 +1,105 @@
+/**
+ * Open-addressing hash map keyed by Uuid.
+ *
+ * Maps a Uuid to an opaque pointer, typically an IFactory or an IType, so
+ * that resolving one of many objects by Uuid is a constant-time lookup.
+ * Keys are stored by value; values are neither owned nor dereferenced.
+ * Concurrent Find calls are safe, any modification needs exclusive
+ * access.
+ */
+#ifndef CWRAPPER_UUIDMAP_H
+#define CWRAPPER_UUIDMAP_H
+
+#include "./CWraPPer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+#include "Smp-C/FactoryCollection.h"
+#include "Smp-C/PrimitiveTypes.h"
+#include "Smp-C/Uuid.h"
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#ifndef CW_root_Smp
+#define CW_root_Smp CW_BUILD_SPACE(CW_root, Smp)
+#endif /* CW_root_Smp */
+#define CW_SPACE CW_root_Smp
+
+typedef void CW(UuidMap);
+
+#undef CW_SPACE
+
+
+/* ### Smp::UuidMap ### */
+#ifndef CW_root_Smp_UuidMap
+#define CW_root_Smp_UuidMap CW_BUILD_SPACE(CW_root_Smp, UuidMap)
+#endif /* CW_root_Smp_UuidMap */
+#define CW_SPACE CW_root_Smp_UuidMap
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) capacity
+);
+
+void
+CW(Destroy)
+(
+    CW() * self
+);
+
+CW(CW_root_Smp, UInt64)
+CW(GetCount)
+(
+    const CW() * self
+);
+
+/* Returns false, after replacing the value, if the key was already present */
+CW(CW_root_Smp, Bool)
+CW(Insert)
+(
+    CW() * self,
+    const CW(CW_root_Smp, Uuid) * key,
+    void * value
+);
+
+/* Returns NULL if the key is not present */
+void *
+CW(Find)
+(
+    const CW() * self,
+    const CW(CW_root_Smp, Uuid) * key
+);
+
+CW(CW_root_Smp, Bool)
+CW(Remove)
+(
+    CW() * self,
+    const CW(CW_root_Smp, Uuid) * key
+);
+
+/* Maps the Uuid of every factory of the collection to the factory */
+CW(CW_root_Smp, UInt64)
+CW(InsertFactories)
+(
+    CW() * self,
+    const CW(CW_root_Smp, FactoryCollection) * factories
+);
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_UUIDMAP_H */
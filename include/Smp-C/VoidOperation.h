@@ -38,13 +38,13 @@ typedef void CW(VoidOperation);
 #endif /* CW_root_Smp_VoidOperation */
 #define CW_SPACE CW_root_Smp_VoidOperation
 
-void
+CW_THUNK void
 CW(_VoidOperation)
 (
     CW() * self
 );
 
-CW(CW_root_Smp, String8)
+CW_THUNK CW(CW_root_Smp, String8)
 CW(GetOperationName)
 (
     CW() * self
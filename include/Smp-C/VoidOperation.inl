@@ -0,0 +1,69 @@
+/**
+ * This file was auto-generated by https://github.com/abadiet/CWraPPer/
+ */
+#ifndef CWRAPPER_VOIDOPERATION_INL
+#define CWRAPPER_VOIDOPERATION_INL
+
+#include "Smp-C/VoidOperation.h"
+#include <Smp/VoidOperation.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::VoidOperation ### */
+#define CW_SPACE CW_root_Smp_VoidOperation
+
+CW_THUNK void
+CW(_VoidOperation)
+(
+    CW() * self
+) {
+    try {
+        static_cast<Smp::VoidOperation *>(self)->~VoidOperation(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW_THUNK CW(CW_root_Smp, String8)
+CW(GetOperationName)
+(
+    CW() * self
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, String8)>(
+        static_cast<Smp::VoidOperation *>(self)->GetOperationName(
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+/* Error while processing function "VoidOperation" at Smp/VoidOperation.h:29:11 (exported to Smp-C/VoidOperation.h) : Skipping constructor */
+
+/* Error while processing function "operator=" at Smp/VoidOperation.h:29:11 (exported to Smp-C/VoidOperation.h) : Reference type is not supported: VoidOperation & */
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CWRAPPER_VOIDOPERATION_INL */
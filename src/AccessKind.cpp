@@ -1,28 +1,5 @@
 /**
  * This file was auto-generated by https://github.com/abadiet/CWraPPer/
  */
-#include "Smp-C/AccessKind.h"
-#include <Smp/AccessKind.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif /* __cplusplus */
-
-
-/* ### root ### */
-#define CW_SPACE CW_root
-
-#undef CW_SPACE
-
-
-/* ### Smp ### */
-#define CW_SPACE CW_root_Smp
-
-/* Error while processing function "operator<<" at Smp/./AccessKind.h:43:19 (exported to Smp-C/AccessKind.h) : Reference type is not supported: std::ostream & */
-
-#undef CW_SPACE
-
-
-#ifdef __cplusplus
-}
-#endif /* __cplusplus */
+#include "ExceptionCatch.h"
+#include "Smp-C/AccessKind.inl"
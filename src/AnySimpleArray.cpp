@@ -1,26 +1,5 @@
 /**
  * This file was auto-generated by https://github.com/abadiet/CWraPPer/
  */
-#include "Smp-C/AnySimpleArray.h"
-#include <Smp/AnySimpleArray.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif /* __cplusplus */
-
-
-/* ### root ### */
-#define CW_SPACE CW_root
-
-#undef CW_SPACE
-
-
-/* ### Smp ### */
-#define CW_SPACE CW_root_Smp
-
-#undef CW_SPACE
-
-
-#ifdef __cplusplus
-}
-#endif /* __cplusplus */
+#include "ExceptionCatch.h"
+#include "Smp-C/AnySimpleArray.inl"
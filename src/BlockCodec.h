@@ -0,0 +1,189 @@
+/**
+ * LZ77 block codec in the LZ4 block format, for the compressed storage.
+ *
+ * Each block is compressed on its own, as a list of sequences: a token
+ * (literal length, match length - 4), the extra length bytes, the
+ * literals, then the 2-byte little-endian offset of the match, except
+ * for the last sequence which only has literals. Matches are found with
+ * a single-entry hash table of 4-byte sequences, skipping faster over
+ * data that does not compress.
+ */
+#ifndef CWRAPPER_BLOCKCODEC_H
+#define CWRAPPER_BLOCKCODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace CWraPPer {
+
+/* Largest compressed size of size bytes */
+inline std::size_t BlockCompressBound(std::size_t size) {
+    return size + size / 255u + 16u;
+}
+
+namespace BlockCodec {
+
+const unsigned hashLog = 14u;
+const std::size_t maxOffset = 65535u;
+/* The last bytes of a block are always literals */
+const std::size_t lastLiterals = 5u;
+const std::size_t matchSearchEnd = 12u;
+
+inline std::uint32_t Read32(const unsigned char *bytes) {
+    std::uint32_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline std::uint64_t Read64(const unsigned char *bytes) {
+    std::uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline std::uint32_t Hash(std::uint32_t sequence) {
+    return (sequence * UINT32_C(2654435761)) >> (32u - hashLog);
+}
+
+inline unsigned char *WriteLength(unsigned char *out, std::size_t length) {
+    for (; length >= 255u; length -= 255u) {
+        *out++ = 255u;
+    }
+    *out++ = static_cast<unsigned char>(length);
+    return out;
+}
+
+inline unsigned char *WriteSequence(
+    unsigned char *out,
+    const unsigned char *literals,
+    std::size_t literalLength,
+    std::size_t offset,
+    std::size_t matchLength
+) {
+    unsigned char *token = out++;
+    *token = static_cast<unsigned char>((literalLength < 15u ? literalLength : 15u) << 4u);
+    if (literalLength >= 15u) {
+        out = WriteLength(out, literalLength - 15u);
+    }
+    if (literalLength != 0u) {
+        std::memcpy(out, literals, literalLength);
+        out += literalLength;
+    }
+    if (matchLength == 0u) {
+        return out;
+    }
+    *out++ = static_cast<unsigned char>(offset & 0xFFu);
+    *out++ = static_cast<unsigned char>(offset >> 8u);
+    matchLength -= 4u;
+    *token |= static_cast<unsigned char>(matchLength < 15u ? matchLength : 15u);
+    if (matchLength >= 15u) {
+        out = WriteLength(out, matchLength - 15u);
+    }
+    return out;
+}
+
+} /* namespace BlockCodec */
+
+/* Returns the compressed size; output holds at least BlockCompressBound(size) bytes */
+inline std::size_t BlockCompress(const void *input, std::size_t size, void *output) {
+    using namespace BlockCodec;
+    const unsigned char *in = static_cast<const unsigned char *>(input);
+    unsigned char *out = static_cast<unsigned char *>(output);
+    std::size_t anchor = 0u;
+    if (size > matchSearchEnd) {
+        std::uint32_t table[1u << hashLog] = {};
+        std::size_t position = 1u;
+        std::size_t misses = 0u;
+        table[Hash(Read32(in))] = 0u;
+        while (position < size - matchSearchEnd) {
+            const std::uint32_t sequence = Read32(in + position);
+            const std::uint32_t hash = Hash(sequence);
+            const std::size_t candidate = table[hash];
+            table[hash] = static_cast<std::uint32_t>(position);
+            if (position - candidate > maxOffset || Read32(in + candidate) != sequence) {
+                position += 1u + (misses++ >> 6u);
+                continue;
+            }
+            misses = 0u;
+            std::size_t length = 4u;
+            /* Eight bytes at a time, then the last differing word byte by byte */
+            while (position + length + 8u <= size - lastLiterals
+                && Read64(in + candidate + length) == Read64(in + position + length)) {
+                length += 8u;
+            }
+            while (position + length < size - lastLiterals && in[candidate + length] == in[position + length]) {
+                ++length;
+            }
+            out = WriteSequence(out, in + anchor, position - anchor, position - candidate, length);
+            position += length;
+            anchor = position;
+            if (position < size - matchSearchEnd) {
+                table[Hash(Read32(in + position - 2u))] = static_cast<std::uint32_t>(position - 2u);
+            }
+        }
+    }
+    out = WriteSequence(out, in + anchor, size - anchor, 0u, 0u);
+    return static_cast<std::size_t>(out - static_cast<unsigned char *>(output));
+}
+
+/* Returns false unless the input decompresses to exactly size bytes */
+inline bool BlockDecompress(const void *input, std::size_t inputSize, void *output, std::size_t size) {
+    const unsigned char *in = static_cast<const unsigned char *>(input);
+    const unsigned char *end = in + inputSize;
+    unsigned char *out = static_cast<unsigned char *>(output);
+    std::size_t written = 0u;
+    const auto readLength = [&](std::size_t &length) {
+        unsigned char byte;
+        do {
+            if (in == end) {
+                return false;
+            }
+            byte = *in++;
+            length += byte;
+        } while (byte == 255u);
+        return true;
+    };
+    while (in < end) {
+        const unsigned char token = *in++;
+        std::size_t literalLength = token >> 4u;
+        if (literalLength == 15u && !readLength(literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<std::size_t>(end - in) || literalLength > size - written) {
+            return false;
+        }
+        if (literalLength != 0u) {
+            std::memcpy(out + written, in, literalLength);
+        }
+        in += literalLength;
+        written += literalLength;
+        if (in == end) {
+            break;
+        }
+        if (end - in < 2) {
+            return false;
+        }
+        const std::size_t offset = in[0] | (static_cast<std::size_t>(in[1]) << 8u);
+        in += 2;
+        std::size_t matchLength = token & 15u;
+        if (matchLength == 15u && !readLength(matchLength)) {
+            return false;
+        }
+        matchLength += 4u;
+        if (offset == 0u || offset > written || matchLength > size - written) {
+            return false;
+        }
+        /* Byte by byte, as the match may overlap the bytes it produces */
+        const unsigned char *match = out + written - offset;
+        for (std::size_t i = 0u; i < matchLength; ++i) {
+            out[written + i] = match[i];
+        }
+        written += matchLength;
+    }
+    return written == size;
+}
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_BLOCKCODEC_H */
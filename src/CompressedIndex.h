@@ -0,0 +1,95 @@
+/**
+ * Layout of the compressed state vector files, shared by their writer
+ * and reader.
+ *
+ * A compressed file starts with a magic and the offset of its index,
+ * then holds the blocks, each compressed on its own (see BlockCodec.h)
+ * or kept raw when it does not shrink, then the index: the block size,
+ * the size of the state vector, and the offset, stored size and kind of
+ * each block. Every block but the last holds blockSize bytes of state.
+ */
+#ifndef CWRAPPER_COMPRESSEDINDEX_H
+#define CWRAPPER_COMPRESSEDINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace CWraPPer {
+
+const char compressedMagic[8] = {'S', 'M', 'P', 'C', 'L', 'Z', 'B', '1'};
+
+/* Magic, then the offset of the index */
+const std::size_t compressedHeaderSize = 16u;
+
+struct CompressedBlock {
+    std::uint64_t offset;
+    std::uint32_t size;
+    bool raw;
+};
+
+struct CompressedIndex {
+    std::uint64_t blockSize = 0u;
+    std::uint64_t totalSize = 0u;
+    std::vector<CompressedBlock> blocks;
+};
+
+inline void AppendCompressedIndex(std::string &buffer, const CompressedIndex &index) {
+    const auto append = [&buffer](const void *value, std::size_t size) {
+        buffer.append(static_cast<const char *>(value), size);
+    };
+    const std::uint64_t count = index.blocks.size();
+    append(&index.blockSize, sizeof(index.blockSize));
+    append(&index.totalSize, sizeof(index.totalSize));
+    append(&count, sizeof(count));
+    for (const CompressedBlock &block : index.blocks) {
+        const std::uint8_t raw = block.raw ? 1u : 0u;
+        append(&block.offset, sizeof(block.offset));
+        append(&block.size, sizeof(block.size));
+        append(&raw, sizeof(raw));
+    }
+}
+
+/* Throws std::runtime_error when the data is not a complete compressed file */
+inline CompressedIndex ReadCompressedIndex(const char *data, std::uint64_t size) {
+    if (size < compressedHeaderSize || std::memcmp(data, compressedMagic, sizeof(compressedMagic)) != 0) {
+        throw std::runtime_error("Not a compressed state vector file");
+    }
+    std::uint64_t offset;
+    std::memcpy(&offset, data + sizeof(compressedMagic), sizeof(offset));
+    const auto take = [&](void *value, std::size_t length) {
+        if (offset > size || length > size - offset) {
+            throw std::runtime_error("Truncated compressed state vector file");
+        }
+        std::memcpy(value, data + offset, length);
+        offset += length;
+    };
+    CompressedIndex index;
+    std::uint64_t count;
+    take(&index.blockSize, sizeof(index.blockSize));
+    take(&index.totalSize, sizeof(index.totalSize));
+    take(&count, sizeof(count));
+    if (index.blockSize == 0u || count != (index.totalSize + index.blockSize - 1u) / index.blockSize) {
+        throw std::runtime_error("Invalid compressed state vector file");
+    }
+    for (std::uint64_t i = 0u; i < count; ++i) {
+        CompressedBlock block;
+        std::uint8_t raw;
+        take(&block.offset, sizeof(block.offset));
+        take(&block.size, sizeof(block.size));
+        take(&raw, sizeof(raw));
+        block.raw = raw != 0u;
+        if (block.offset > size || block.size > size - block.offset) {
+            throw std::runtime_error("Block out of the compressed state vector file");
+        }
+        index.blocks.push_back(block);
+    }
+    return index;
+}
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_COMPRESSEDINDEX_H */
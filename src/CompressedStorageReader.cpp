@@ -0,0 +1,254 @@
+/**
+ * Storage reader restoring a state vector compressed in independent
+ * blocks.
+ */
+#include "Smp-C/CompressedStorageReader.h"
+#include "ExceptionCatch.h"
+#include "BlockCodec.h"
+#include "CompressedIndex.h"
+#include "MappedFile.h"
+#include "StorageBase.h"
+#include "WorkStealingPool.h"
+#include <Smp/IStorageReader.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+class CompressedStorageReader final : public CWraPPer::StorageBase<Smp::IStorageReader> {
+public:
+    CompressedStorageReader(Smp::String8 path, Smp::String8 fileName, std::size_t workerCount) :
+        StorageBase(path, fileName),
+        file(FullName(), CWraPPer::MappedFile::Read),
+        pool(workerCount) {
+        try {
+            index = CWraPPer::ReadCompressedIndex(file.GetData(), file.GetSize());
+        } catch (const std::runtime_error &error) {
+            throw std::runtime_error(std::string(error.what()) + ": " + FullName());
+        }
+    }
+
+    void Restore(void *address, Smp::UInt64 size) override {
+        if (size > index.totalSize - position) {
+            throw CWraPPer::StorageCannotRestore(
+                "Compressed state vector " + FullName() + " ends before " + std::to_string(position + size)
+                    + " bytes");
+        }
+        char *destination = static_cast<char *>(address);
+        while (size > 0u) {
+            const std::uint64_t block = position / index.blockSize;
+            const std::uint64_t offset = position % index.blockSize;
+            if (offset == 0u && size >= BlockLength(block)) {
+                /* Whole blocks go straight to the destination, decompressed in parallel */
+                std::uint64_t count = 0u;
+                std::uint64_t length = 0u;
+                while (block + count < index.blocks.size() && size - length >= BlockLength(block + count)) {
+                    length += BlockLength(block + count);
+                    ++count;
+                }
+                std::atomic<bool> corrupt{false};
+                pool.Run(static_cast<std::size_t>(count), [&](std::size_t i) {
+                    if (!Decode(block + i, destination + i * index.blockSize)) {
+                        corrupt.store(true);
+                    }
+                });
+                if (corrupt.load()) {
+                    throw CWraPPer::StorageCannotRestore("Corrupt block in the compressed state vector " + FullName());
+                }
+                destination += length;
+                size -= length;
+                position += length;
+                continue;
+            }
+            if (cached != block) {
+                cache.resize(static_cast<std::size_t>(index.blockSize));
+                cached = index.blocks.size();
+                if (!Decode(block, cache.data())) {
+                    throw CWraPPer::StorageCannotRestore("Corrupt block in the compressed state vector " + FullName());
+                }
+                cached = block;
+            }
+            const std::uint64_t length = std::min(size, BlockLength(block) - offset);
+            std::memcpy(destination, cache.data() + offset, static_cast<std::size_t>(length));
+            destination += length;
+            size -= length;
+            position += length;
+        }
+    }
+
+    void Seek(std::uint64_t block) {
+        if (block > index.blocks.size()) {
+            throw CWraPPer::StorageCannotRestore(
+                "Compressed state vector " + FullName() + " has only " + std::to_string(index.blocks.size())
+                    + " blocks");
+        }
+        position = std::min(block * index.blockSize, index.totalSize);
+    }
+
+    std::uint64_t GetSize() const {
+        return index.totalSize;
+    }
+
+    std::uint64_t GetPosition() const {
+        return position;
+    }
+
+    std::uint64_t GetBlockSize() const {
+        return index.blockSize;
+    }
+
+    std::uint64_t GetBlockCount() const {
+        return index.blocks.size();
+    }
+
+private:
+    std::uint64_t BlockLength(std::uint64_t block) const {
+        return std::min(index.blockSize, index.totalSize - block * index.blockSize);
+    }
+
+    bool Decode(std::uint64_t block, char *destination) const {
+        const CWraPPer::CompressedBlock &entry = index.blocks[static_cast<std::size_t>(block)];
+        const std::size_t length = static_cast<std::size_t>(BlockLength(block));
+        if (entry.raw) {
+            if (entry.size != length) {
+                return false;
+            }
+            std::memcpy(destination, file.GetData() + entry.offset, length);
+            return true;
+        }
+        return CWraPPer::BlockDecompress(file.GetData() + entry.offset, entry.size, destination, length);
+    }
+
+    CWraPPer::MappedFile file;
+    CWraPPer::WorkStealingPool pool;
+    CWraPPer::CompressedIndex index;
+    std::uint64_t position = 0u;
+    /* Last block decompressed for a partial read */
+    std::vector<char> cache;
+    std::uint64_t cached = UINT64_MAX;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::CompressedStorageReader ### */
+#define CW_SPACE CW_root_Smp_CompressedStorageReader
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) workerCount
+) {
+    try {
+        return new CompressedStorageReader(
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName),
+            static_cast<std::size_t>(workerCount)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<CompressedStorageReader *>(self);
+}
+
+CW(CW_root_Smp, IStorageReader) *
+CW(GetStorageReader)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IStorageReader) *>(
+    static_cast<Smp::IStorageReader *>(static_cast<CompressedStorageReader *>(self)));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const CompressedStorageReader *>(self)->GetSize(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetPosition)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const CompressedStorageReader *>(self)->GetPosition(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetBlockSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const CompressedStorageReader *>(self)->GetBlockSize(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetBlockCount)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const CompressedStorageReader *>(self)->GetBlockCount(
+    ));
+}
+
+void
+CW(Seek)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) block
+) {
+    try {
+        static_cast<CompressedStorageReader *>(self)->Seek(
+            static_cast<std::uint64_t>(block)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
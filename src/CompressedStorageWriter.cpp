@@ -0,0 +1,351 @@
+/**
+ * Storage writer compressing the state vector in independent blocks.
+ */
+#include "Smp-C/CompressedStorageWriter.h"
+#include "ExceptionCatch.h"
+#include "BlockCodec.h"
+#include "CompressedIndex.h"
+#include "StorageBase.h"
+#include "WorkStealingPool.h"
+#include <Smp/IStorageWriter.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const std::uint64_t defaultBlockSize = 1u << 20u;
+
+struct Block {
+    std::vector<char> raw;
+    std::size_t used = 0u;
+    std::vector<char> compressed;
+    std::size_t compressedSize = 0u;
+    std::exception_ptr failure;
+};
+
+/*
+ * Store fills a batch of blocks while the previous batch is compressed
+ * on the pool and written, in order, by the background thread.
+ */
+class CompressedStorageWriter final : public CWraPPer::StorageBase<Smp::IStorageWriter> {
+public:
+    CompressedStorageWriter(
+        Smp::String8 path,
+        Smp::String8 fileName,
+        std::uint64_t blockSize,
+        std::size_t workerCount
+    ) :
+        StorageBase(path, fileName),
+        blockSize(CheckedBlockSize(blockSize != 0u ? blockSize : defaultBlockSize)),
+        pool(workerCount),
+        batchSize(2u * (workerCount + 1u)) {
+        index.blockSize = this->blockSize;
+        file = std::fopen(FullName().c_str(), "wb");
+        if (file == nullptr) {
+            throw CWraPPer::StorageCannotStore("Cannot open the state vector file " + FullName());
+        }
+        try {
+            filling.resize(batchSize);
+            pending.resize(batchSize);
+            const char header[CWraPPer::compressedHeaderSize] = {};
+            Write(header, sizeof(header));
+            background = std::thread(&CompressedStorageWriter::Compress, this);
+        } catch (...) {
+            std::fclose(file);
+            throw;
+        }
+    }
+
+    ~CompressedStorageWriter() override {
+        Stop();
+        if (file != nullptr) {
+            std::fclose(file);
+        }
+    }
+
+    void Store(const void *address, Smp::UInt64 size) override {
+        Rethrow();
+        const char *data = static_cast<const char *>(address);
+        while (size > 0u) {
+            Block &block = filling[filled];
+            if (block.raw.size() != blockSize) {
+                block.raw.resize(blockSize);
+            }
+            const std::size_t length = static_cast<std::size_t>(std::min<Smp::UInt64>(size, blockSize - block.used));
+            std::memcpy(block.raw.data() + block.used, data, length);
+            block.used += length;
+            data += length;
+            size -= length;
+            stored += length;
+            if (block.used == blockSize && ++filled == batchSize) {
+                Submit();
+            }
+        }
+    }
+
+    /* Compresses and writes the last blocks, then the index */
+    void Finish() {
+        if (finished) {
+            return;
+        }
+        finished = true;
+        if (filled < batchSize && filling[filled].used != 0u) {
+            ++filled;
+        }
+        Submit();
+        Stop();
+        Rethrow();
+        index.totalSize = stored;
+        std::string buffer;
+        CWraPPer::AppendCompressedIndex(buffer, index);
+        const std::uint64_t indexOffset = written;
+        Write(buffer.data(), buffer.size());
+        char header[CWraPPer::compressedHeaderSize];
+        std::memcpy(header, CWraPPer::compressedMagic, sizeof(CWraPPer::compressedMagic));
+        std::memcpy(header + sizeof(CWraPPer::compressedMagic), &indexOffset, sizeof(indexOffset));
+        if (std::fseek(file, 0, SEEK_SET) != 0) {
+            throw CWraPPer::StorageCannotStore("Cannot seek in the state vector file " + FullName());
+        }
+        Write(header, sizeof(header));
+        if (std::fclose(file) != 0) {
+            file = nullptr;
+            throw CWraPPer::StorageCannotStore("Cannot close the state vector file " + FullName());
+        }
+        file = nullptr;
+    }
+
+    std::uint64_t GetStoredSize() const {
+        return stored;
+    }
+
+    std::uint64_t GetWrittenSize() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return written;
+    }
+
+private:
+    /* Block sizes and positions in a block are 32 bits in the index and the codec */
+    static std::size_t CheckedBlockSize(std::uint64_t blockSize) {
+        if (blockSize > std::numeric_limits<std::uint32_t>::max()) {
+            throw CWraPPer::StorageCannotStore(
+                "Block size " + std::to_string(blockSize) + " is not below 4 GiB");
+        }
+        return static_cast<std::size_t>(blockSize);
+    }
+
+    /* Hands the filled blocks to the background thread, once it is done with the previous ones */
+    void Submit() {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] { return pendingCount == 0u; });
+        std::swap(filling, pending);
+        pendingCount = filled;
+        filled = 0u;
+        for (Block &block : filling) {
+            block.used = 0u;
+        }
+        work.notify_one();
+    }
+
+    void Stop() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            idle.wait(lock, [this] { return pendingCount == 0u; });
+            stopping = true;
+        }
+        work.notify_one();
+        if (background.joinable()) {
+            background.join();
+        }
+    }
+
+    /* The failure stays: once a block is lost, no later Store nor Finish may succeed */
+    void Rethrow() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    void Compress() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            work.wait(lock, [this] { return stopping || pendingCount != 0u; });
+            if (pendingCount == 0u) {
+                return;
+            }
+            const std::size_t count = pendingCount;
+            lock.unlock();
+            /* Pool jobs must not throw: a failed block keeps its exception, rethrown in block order */
+            pool.Run(count, [this](std::size_t i) {
+                Block &block = pending[i];
+                try {
+                    block.failure = nullptr;
+                    block.compressed.resize(CWraPPer::BlockCompressBound(block.used));
+                    block.compressedSize =
+                        CWraPPer::BlockCompress(block.raw.data(), block.used, block.compressed.data());
+                } catch (...) {
+                    block.failure = std::current_exception();
+                }
+            });
+            try {
+                for (std::size_t i = 0u; i < count; ++i) {
+                    if (pending[i].failure) {
+                        std::rethrow_exception(pending[i].failure);
+                    }
+                    WriteBlock(pending[i]);
+                }
+            } catch (...) {
+                lock.lock();
+                failure = std::current_exception();
+                lock.unlock();
+            }
+            lock.lock();
+            pendingCount = 0u;
+            idle.notify_all();
+        }
+    }
+
+    /* A block that does not shrink is kept raw */
+    void WriteBlock(const Block &block) {
+        CWraPPer::CompressedBlock entry;
+        entry.offset = written;
+        entry.raw = block.compressedSize >= block.used;
+        entry.size = static_cast<std::uint32_t>(entry.raw ? block.used : block.compressedSize);
+        Write(entry.raw ? block.raw.data() : block.compressed.data(), entry.size);
+        index.blocks.push_back(entry);
+    }
+
+    /* Called by a single thread at a time: the constructor, then the background thread, then Finish */
+    void Write(const void *data, std::size_t size) {
+        if (std::fwrite(data, 1u, size, file) != size) {
+            throw CWraPPer::StorageCannotStore("Cannot write the state vector file " + FullName());
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        written += size;
+    }
+
+    const std::size_t blockSize;
+    CWraPPer::WorkStealingPool pool;
+    const std::size_t batchSize;
+    std::FILE *file = nullptr;
+    CWraPPer::CompressedIndex index;
+    std::uint64_t stored = 0u;
+    bool finished = false;
+
+    /* Owned by Store */
+    std::vector<Block> filling;
+    std::size_t filled = 0u;
+
+    mutable std::mutex mutex;
+    std::condition_variable work;
+    std::condition_variable idle;
+    std::vector<Block> pending;
+    std::size_t pendingCount = 0u;
+    std::uint64_t written = 0u;
+    std::exception_ptr failure;
+    bool stopping = false;
+    std::thread background;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::CompressedStorageWriter ### */
+#define CW_SPACE CW_root_Smp_CompressedStorageWriter
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) blockSize,
+    CW(CW_root_Smp, UInt64) workerCount
+) {
+    try {
+        return new CompressedStorageWriter(
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName),
+            static_cast<std::uint64_t>(blockSize),
+            static_cast<std::size_t>(workerCount)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    CompressedStorageWriter *writer = static_cast<CompressedStorageWriter *>(self);
+    try {
+        writer->Finish();
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    delete writer;
+}
+
+CW(CW_root_Smp, IStorageWriter) *
+CW(GetStorageWriter)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IStorageWriter) *>(
+    static_cast<Smp::IStorageWriter *>(static_cast<CompressedStorageWriter *>(self)));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetStoredSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const CompressedStorageWriter *>(self)->GetStoredSize(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetWrittenSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const CompressedStorageWriter *>(self)->GetWrittenSize(
+    ));
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
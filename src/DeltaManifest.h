@@ -0,0 +1,177 @@
+/**
+ * Layout of the delta state vector files, shared by their writer and
+ * reader.
+ *
+ * A delta file starts with a magic and the offset of its manifest, then
+ * holds the chunks stored in it, then the manifest. The manifest lists
+ * the chain of files holding chunks (the file itself first, then older
+ * breakpoints in the same directory) and, for each Store block, its size
+ * and the hash, file and offset of each of its chunks.
+ */
+#ifndef CWRAPPER_DELTAMANIFEST_H
+#define CWRAPPER_DELTAMANIFEST_H
+
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CWraPPer {
+
+const char deltaMagic[8] = {'S', 'M', 'P', 'C', 'D', 'L', 'T', '1'};
+
+/* Magic, then the offset of the manifest */
+const std::uint64_t deltaHeaderSize = 16u;
+
+struct DeltaChunk {
+    std::uint64_t hash;
+    /* Index in the chain, 0 for the file holding the manifest */
+    std::uint32_t file;
+    std::uint64_t offset;
+};
+
+struct DeltaBlock {
+    std::uint64_t size;
+    std::vector<DeltaChunk> chunks;
+};
+
+struct DeltaManifest {
+    std::uint64_t chunkSize = 0u;
+    std::vector<std::string> chain;
+    std::vector<DeltaBlock> blocks;
+};
+
+/* 64-bit hash of the content of a chunk (xxHash64 construction) */
+inline std::uint64_t DeltaHash(const void *data, std::size_t size) {
+    const std::uint64_t prime1 = UINT64_C(0x9E3779B185EBCA87);
+    const std::uint64_t prime2 = UINT64_C(0xC2B2AE3D27D4EB4F);
+    const std::uint64_t prime3 = UINT64_C(0x165667B19E3779F9);
+    const std::uint64_t prime4 = UINT64_C(0x85EBCA77C2B2AE63);
+    const std::uint64_t prime5 = UINT64_C(0x27D4EB2F165667C5);
+    const auto rotate = [](std::uint64_t value, unsigned bits) {
+        return (value << bits) | (value >> (64u - bits));
+    };
+    const auto round = [&](std::uint64_t accumulator, std::uint64_t input) {
+        return rotate(accumulator + input * prime2, 31u) * prime1;
+    };
+    const auto read64 = [](const unsigned char *bytes) {
+        std::uint64_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    };
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    const unsigned char *end = bytes + size;
+    std::uint64_t hash;
+    if (size >= 32u) {
+        std::uint64_t lanes[4] = {prime1 + prime2, prime2, 0u, 0u - prime1};
+        for (; end - bytes >= 32; bytes += 32) {
+            for (unsigned lane = 0u; lane < 4u; ++lane) {
+                lanes[lane] = round(lanes[lane], read64(bytes + 8u * lane));
+            }
+        }
+        hash = rotate(lanes[0], 1u) + rotate(lanes[1], 7u) + rotate(lanes[2], 12u) + rotate(lanes[3], 18u);
+        for (std::uint64_t lane : lanes) {
+            hash = (hash ^ round(0u, lane)) * prime1 + prime4;
+        }
+    } else {
+        hash = prime5;
+    }
+    hash += static_cast<std::uint64_t>(size);
+    for (; end - bytes >= 8; bytes += 8) {
+        hash = rotate(hash ^ round(0u, read64(bytes)), 27u) * prime1 + prime4;
+    }
+    if (end - bytes >= 4) {
+        std::uint32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        hash = rotate(hash ^ (value * prime1), 23u) * prime2 + prime3;
+        bytes += 4;
+    }
+    for (; bytes < end; ++bytes) {
+        hash = rotate(hash ^ (*bytes * prime5), 11u) * prime1;
+    }
+    hash = (hash ^ (hash >> 33u)) * prime2;
+    hash = (hash ^ (hash >> 29u)) * prime3;
+    return hash ^ (hash >> 32u);
+}
+
+template <typename T>
+void AppendDeltaValue(std::string &buffer, T value) {
+    buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+inline void AppendDeltaManifest(std::string &buffer, const DeltaManifest &manifest) {
+    AppendDeltaValue(buffer, manifest.chunkSize);
+    AppendDeltaValue(buffer, static_cast<std::uint32_t>(manifest.chain.size()));
+    for (const std::string &fileName : manifest.chain) {
+        AppendDeltaValue(buffer, static_cast<std::uint32_t>(fileName.size()));
+        buffer += fileName;
+    }
+    AppendDeltaValue(buffer, static_cast<std::uint64_t>(manifest.blocks.size()));
+    for (const DeltaBlock &block : manifest.blocks) {
+        AppendDeltaValue(buffer, block.size);
+        for (const DeltaChunk &chunk : block.chunks) {
+            AppendDeltaValue(buffer, chunk.hash);
+            AppendDeltaValue(buffer, chunk.file);
+            AppendDeltaValue(buffer, chunk.offset);
+        }
+    }
+}
+
+/* Throws std::runtime_error when the file is not a complete delta file */
+inline DeltaManifest ReadDeltaManifest(const MappedFile &file) {
+    const char *data = file.GetData();
+    const std::uint64_t size = file.GetSize();
+    if (size < deltaHeaderSize || std::memcmp(data, deltaMagic, sizeof(deltaMagic)) != 0) {
+        throw std::runtime_error("Not a delta state vector file: " + file.GetFileName());
+    }
+    std::uint64_t offset;
+    std::memcpy(&offset, data + sizeof(deltaMagic), sizeof(offset));
+    const auto take = [&](void *value, std::uint64_t length) {
+        if (offset > size || length > size - offset) {
+            throw std::runtime_error("Truncated delta state vector file: " + file.GetFileName());
+        }
+        std::memcpy(value, data + offset, static_cast<std::size_t>(length));
+        offset += length;
+    };
+    DeltaManifest manifest;
+    take(&manifest.chunkSize, sizeof(manifest.chunkSize));
+    std::uint32_t chainSize;
+    take(&chainSize, sizeof(chainSize));
+    for (std::uint32_t i = 0u; i < chainSize; ++i) {
+        std::uint32_t length;
+        take(&length, sizeof(length));
+        std::string fileName(length, '\0');
+        take(&fileName[0], length);
+        manifest.chain.push_back(fileName);
+    }
+    std::uint64_t blockCount;
+    take(&blockCount, sizeof(blockCount));
+    if (manifest.chunkSize == 0u || chainSize == 0u) {
+        throw std::runtime_error("Invalid delta state vector file: " + file.GetFileName());
+    }
+    for (std::uint64_t i = 0u; i < blockCount; ++i) {
+        DeltaBlock block;
+        take(&block.size, sizeof(block.size));
+        const std::uint64_t chunkCount = (block.size + manifest.chunkSize - 1u) / manifest.chunkSize;
+        for (std::uint64_t c = 0u; c < chunkCount; ++c) {
+            DeltaChunk chunk;
+            take(&chunk.hash, sizeof(chunk.hash));
+            take(&chunk.file, sizeof(chunk.file));
+            take(&chunk.offset, sizeof(chunk.offset));
+            if (chunk.file >= chainSize) {
+                throw std::runtime_error("Invalid delta state vector file: " + file.GetFileName());
+            }
+            block.chunks.push_back(chunk);
+        }
+        manifest.blocks.push_back(std::move(block));
+    }
+    return manifest;
+}
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_DELTAMANIFEST_H */
@@ -0,0 +1,173 @@
+/**
+ * Storage reader restoring a delta breakpoint.
+ */
+#include "Smp-C/DeltaStorageReader.h"
+#include "ExceptionCatch.h"
+#include "DeltaManifest.h"
+#include "MappedFile.h"
+#include "StorageBase.h"
+#include <Smp/IStorageReader.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+class DeltaStorageReader final : public CWraPPer::StorageBase<Smp::IStorageReader> {
+public:
+    DeltaStorageReader(Smp::String8 path, Smp::String8 fileName) :
+        StorageBase(path, fileName) {
+        files.emplace_back(new CWraPPer::MappedFile(FullName(), CWraPPer::MappedFile::Read));
+        const CWraPPer::DeltaManifest manifest = CWraPPer::ReadDeltaManifest(*files[0]);
+        for (std::size_t i = 1u; i < manifest.chain.size(); ++i) {
+            files.emplace_back(new CWraPPer::MappedFile(
+                CWraPPer::StorageFileName(path, manifest.chain[i].c_str()), CWraPPer::MappedFile::Read));
+            if (files[i]->GetSize() < CWraPPer::deltaHeaderSize
+                || std::memcmp(files[i]->GetData(), CWraPPer::deltaMagic, sizeof(CWraPPer::deltaMagic)) != 0) {
+                throw std::runtime_error("Not a delta state vector file: " + files[i]->GetFileName());
+            }
+        }
+        /* The chunks, in the order Restore reads them */
+        for (const CWraPPer::DeltaBlock &block : manifest.blocks) {
+            for (std::size_t c = 0u; c < block.chunks.size(); ++c) {
+                const CWraPPer::DeltaChunk &chunk = block.chunks[c];
+                const std::uint64_t length = std::min(manifest.chunkSize, block.size - c * manifest.chunkSize);
+                const CWraPPer::MappedFile &holder = *files[chunk.file];
+                if (chunk.offset > holder.GetSize() || length > holder.GetSize() - chunk.offset) {
+                    throw std::runtime_error("Chunk out of the delta state vector file: " + holder.GetFileName());
+                }
+                pieces.push_back({holder.GetData() + chunk.offset, length});
+                totalSize += length;
+            }
+        }
+    }
+
+    void Restore(void *address, Smp::UInt64 size) override {
+        if (size > totalSize - position) {
+            throw CWraPPer::StorageCannotRestore(
+                "Delta state vector " + FullName() + " ends before " + std::to_string(position + size) + " bytes");
+        }
+        char *destination = static_cast<char *>(address);
+        while (size > 0u) {
+            const Piece &piece = pieces[current];
+            const std::uint64_t length = std::min(size, piece.size - pieceOffset);
+            std::memcpy(destination, piece.data + pieceOffset, static_cast<std::size_t>(length));
+            destination += length;
+            size -= length;
+            position += length;
+            pieceOffset += length;
+            if (pieceOffset == piece.size) {
+                ++current;
+                pieceOffset = 0u;
+            }
+        }
+    }
+
+    std::uint64_t GetSize() const {
+        return totalSize;
+    }
+
+    std::uint64_t GetPosition() const {
+        return position;
+    }
+
+private:
+    struct Piece {
+        const char *data;
+        std::uint64_t size;
+    };
+
+    std::vector<std::unique_ptr<CWraPPer::MappedFile>> files;
+    std::vector<Piece> pieces;
+    std::uint64_t totalSize = 0u;
+    std::uint64_t position = 0u;
+    std::size_t current = 0u;
+    std::uint64_t pieceOffset = 0u;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::DeltaStorageReader ### */
+#define CW_SPACE CW_root_Smp_DeltaStorageReader
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+) {
+    try {
+        return new DeltaStorageReader(
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<DeltaStorageReader *>(self);
+}
+
+CW(CW_root_Smp, IStorageReader) *
+CW(GetStorageReader)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IStorageReader) *>(
+    static_cast<Smp::IStorageReader *>(static_cast<DeltaStorageReader *>(self)));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const DeltaStorageReader *>(self)->GetSize(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetPosition)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const DeltaStorageReader *>(self)->GetPosition(
+    ));
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,273 @@
+/**
+ * Storage writer keeping only the blocks changed since a previous
+ * breakpoint.
+ */
+#include "Smp-C/DeltaStorageWriter.h"
+#include "ExceptionCatch.h"
+#include "DeltaManifest.h"
+#include "MappedFile.h"
+#include "StorageBase.h"
+#include <Smp/IStorageWriter.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+namespace {
+
+const std::uint64_t defaultChunkSize = 16u * 1024u;
+const std::uint64_t minimumGrowth = 1u << 20u;
+
+class DeltaStorageWriter final : public CWraPPer::StorageBase<Smp::IStorageWriter> {
+public:
+    DeltaStorageWriter(
+        Smp::String8 path,
+        Smp::String8 fileName,
+        Smp::String8 previousFileName,
+        std::uint64_t chunkSize
+    ) :
+        StorageBase(path, fileName),
+        previous(ReadPrevious(path, fileName, previousFileName)),
+        file(FullName(), CWraPPer::MappedFile::Write, minimumGrowth) {
+        if (!previous.chain.empty()) {
+            manifest.chunkSize = previous.chunkSize;
+        } else {
+            manifest.chunkSize = chunkSize != 0u ? chunkSize : defaultChunkSize;
+        }
+        manifest.chain.push_back(fileName != nullptr ? fileName : "");
+        std::memcpy(file.GetData(), CWraPPer::deltaMagic, sizeof(CWraPPer::deltaMagic));
+        position = CWraPPer::deltaHeaderSize;
+    }
+
+    void Store(const void *address, Smp::UInt64 size) override {
+        if (failed) {
+            throw CWraPPer::StorageCannotStore("An earlier Store to " + FullName() + " failed");
+        }
+        try {
+            StoreBlock(static_cast<const char *>(address), size);
+        } catch (...) {
+            failed = true;
+            throw;
+        }
+    }
+
+    /* Writes the manifest and cuts the file to its size; after a failed Store, leaves the file invalid instead */
+    void Finish() {
+        if (finished) {
+            return;
+        }
+        finished = true;
+        if (failed) {
+            Invalidate();
+            throw CWraPPer::StorageCannotStore("A Store to " + FullName() + " failed, the file is left invalid");
+        }
+        try {
+            std::string buffer;
+            CWraPPer::AppendDeltaManifest(buffer, manifest);
+            const std::uint64_t manifestOffset = Append(buffer.data(), buffer.size());
+            std::memcpy(file.GetData() + sizeof(CWraPPer::deltaMagic), &manifestOffset, sizeof(manifestOffset));
+        } catch (...) {
+            Invalidate();
+            throw;
+        }
+        file.Close(position);
+    }
+
+    std::uint64_t GetStoredSize() const {
+        return stored;
+    }
+
+    std::uint64_t GetWrittenSize() const {
+        return written;
+    }
+
+private:
+    /*
+     * Reads the manifest of the previous breakpoint before the new file is
+     * opened, which truncates it: the new file may not be one the chain
+     * still reads chunks from
+     */
+    static CWraPPer::DeltaManifest ReadPrevious(
+        Smp::String8 path,
+        Smp::String8 fileName,
+        Smp::String8 previousFileName
+    ) {
+        CWraPPer::DeltaManifest previous;
+        if (previousFileName == nullptr || previousFileName[0] == '\0') {
+            return previous;
+        }
+        const CWraPPer::MappedFile previousFile(
+            CWraPPer::StorageFileName(path, previousFileName), CWraPPer::MappedFile::Read);
+        previous = CWraPPer::ReadDeltaManifest(previousFile);
+        /* Chunks of the previous file are named by the name it was written with */
+        previous.chain[0] = previousFileName;
+        const std::string name(fileName != nullptr ? fileName : "");
+        if (std::find(previous.chain.begin(), previous.chain.end(), name) != previous.chain.end()) {
+            throw CWraPPer::StorageCannotStore(
+                "Cannot write " + CWraPPer::StorageFileName(path, fileName)
+                    + " over a breakpoint of the chain it is based on");
+        }
+        return previous;
+    }
+
+    void StoreBlock(const char *data, std::uint64_t size) {
+        const std::size_t index = manifest.blocks.size();
+        const CWraPPer::DeltaBlock *old = index < previous.blocks.size() && previous.blocks[index].size == size
+            ? &previous.blocks[index]
+            : nullptr;
+        CWraPPer::DeltaBlock block;
+        block.size = size;
+        for (std::uint64_t offset = 0u; offset < size; offset += manifest.chunkSize) {
+            const std::uint64_t length = std::min(manifest.chunkSize, size - offset);
+            CWraPPer::DeltaChunk chunk;
+            chunk.hash = CWraPPer::DeltaHash(data + offset, static_cast<std::size_t>(length));
+            const std::size_t c = block.chunks.size();
+            if (old != nullptr && old->chunks[c].hash == chunk.hash) {
+                chunk.file = ChainIndex(previous.chain[old->chunks[c].file]);
+                chunk.offset = old->chunks[c].offset;
+            } else {
+                chunk.file = 0u;
+                chunk.offset = Append(data + offset, length);
+                written += length;
+            }
+            block.chunks.push_back(chunk);
+        }
+        manifest.blocks.push_back(std::move(block));
+        stored += size;
+    }
+
+    /* Clears the magic, so that no reader takes the file for a breakpoint */
+    void Invalidate() {
+        std::memset(file.GetData(), 0, sizeof(CWraPPer::deltaMagic));
+        file.Close(position);
+    }
+
+    std::uint32_t ChainIndex(const std::string &fileName) {
+        const auto found = std::find(manifest.chain.begin(), manifest.chain.end(), fileName);
+        if (found != manifest.chain.end()) {
+            return static_cast<std::uint32_t>(found - manifest.chain.begin());
+        }
+        manifest.chain.push_back(fileName);
+        return static_cast<std::uint32_t>(manifest.chain.size() - 1u);
+    }
+
+    /* Returns the offset of the bytes in the file */
+    std::uint64_t Append(const void *data, std::uint64_t size) {
+        if (size > file.GetSize() - position) {
+            try {
+                file.Resize(std::max({position + size, file.GetSize() * 2u, minimumGrowth}));
+            } catch (const std::system_error &error) {
+                throw CWraPPer::StorageCannotStore(
+                    "Cannot grow the state vector file to " + std::to_string(position + size) + " bytes: "
+                        + error.what());
+            }
+        }
+        std::memcpy(file.GetData() + position, data, static_cast<std::size_t>(size));
+        const std::uint64_t offset = position;
+        position += size;
+        return offset;
+    }
+
+    CWraPPer::DeltaManifest previous;
+    CWraPPer::MappedFile file;
+    CWraPPer::DeltaManifest manifest;
+    std::uint64_t position = 0u;
+    std::uint64_t stored = 0u;
+    std::uint64_t written = 0u;
+    bool finished = false;
+    bool failed = false;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::DeltaStorageWriter ### */
+#define CW_SPACE CW_root_Smp_DeltaStorageWriter
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, String8) previousFileName,
+    CW(CW_root_Smp, UInt64) chunkSize
+) {
+    try {
+        return new DeltaStorageWriter(
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName),
+            static_cast<Smp::String8>(previousFileName),
+            static_cast<std::uint64_t>(chunkSize)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    DeltaStorageWriter *writer = static_cast<DeltaStorageWriter *>(self);
+    try {
+        writer->Finish();
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    delete writer;
+}
+
+CW(CW_root_Smp, IStorageWriter) *
+CW(GetStorageWriter)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IStorageWriter) *>(
+    static_cast<Smp::IStorageWriter *>(static_cast<DeltaStorageWriter *>(self)));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetStoredSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const DeltaStorageWriter *>(self)->GetStoredSize(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetWrittenSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const DeltaStorageWriter *>(self)->GetWrittenSize(
+    ));
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -1,71 +1,5 @@
 /**
  * This file was auto-generated by https://github.com/abadiet/CWraPPer/
  */
-#include "Smp-C/Services/EntryPointAlreadySubscribed.h"
-#include <Smp/Services/EntryPointAlreadySubscribed.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif /* __cplusplus */
-
-
-/* ### root ### */
-#define CW_SPACE CW_root
-
-#undef CW_SPACE
-
-
-/* ### Smp ### */
-#define CW_SPACE CW_root_Smp
-
-#undef CW_SPACE
-
-
-/* ### Smp::Services ### */
-#define CW_SPACE CW_root_Smp_Services
-
-#undef CW_SPACE
-
-
-/* ### Smp::Services::EntryPointAlreadySubscribed ### */
-#define CW_SPACE CW_root_Smp_Services_EntryPointAlreadySubscribed
-
-void
-CW(_EntryPointAlreadySubscribed)
-(
-    CW() * self
-) {
-    static_cast<Smp::Services::EntryPointAlreadySubscribed *>(self)->~EntryPointAlreadySubscribed(
-    );
-}
-
-const CW(CW_root_Smp, IEntryPoint) *
-CW(GetEntryPoint)
-(
-    CW() * self
-) {
-    return static_cast<const CW(CW_root_Smp, IEntryPoint) *>(
-    static_cast<Smp::Services::EntryPointAlreadySubscribed *>(self)->GetEntryPoint(
-    ));
-}
-
-CW(CW_root_Smp, String8)
-CW(GetEventName)
-(
-    CW() * self
-) {
-    return static_cast<CW(CW_root_Smp, String8)>(
-    static_cast<Smp::Services::EntryPointAlreadySubscribed *>(self)->GetEventName(
-    ));
-}
-
-/* Error while processing function "EntryPointAlreadySubscribed" at Smp/./Services/EntryPointAlreadySubscribed.h:41:15 (exported to Smp-C/Services/EntryPointAlreadySubscribed.h) : Skipping constructor */
-
-/* Error while processing function "operator=" at Smp/./Services/EntryPointAlreadySubscribed.h:41:15 (exported to Smp-C/Services/EntryPointAlreadySubscribed.h) : Reference type is not supported: EntryPointAlreadySubscribed & */
-
-#undef CW_SPACE
-
-
-#ifdef __cplusplus
-}
-#endif /* __cplusplus */
+#include "ExceptionCatch.h"
+#include "Smp-C/Services/EntryPointAlreadySubscribed.inl"
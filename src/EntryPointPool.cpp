@@ -0,0 +1,334 @@
+/**
+ * Entry points implemented in C.
+ */
+#include "Smp-C/EntryPointPool.h"
+#include "ExceptionCatch.h"
+#include <Smp/IEntryPoint.h>
+#include <Smp/Services/IEventManager.h>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace {
+
+class FunctionEntryPoint final : public Smp::IEntryPoint {
+public:
+    FunctionEntryPoint(const CW(CW_root_Smp, EntryPointDefinition) &definition, Smp::IObject *parent) :
+        function(definition.function),
+        userData(definition.userData),
+        name(definition.name),
+        description(definition.description != nullptr ? definition.description : ""),
+        parent(parent) {
+    }
+
+    Smp::String8 GetName() const override {
+        return name;
+    }
+
+    Smp::String8 GetDescription() const override {
+        return description;
+    }
+
+    Smp::IObject *GetParent() const override {
+        return parent;
+    }
+
+    Smp::IObject *GetChild(Smp::String8) const override {
+        return nullptr;
+    }
+
+    void Execute() const override {
+        function(userData);
+    }
+
+private:
+    CW(CW_root_Smp, EntryPointFunction) function;
+    void *userData;
+    Smp::String8 name;
+    Smp::String8 description;
+    Smp::IObject *parent;
+};
+
+union EntryPointSlot {
+    EntryPointSlot *next;
+    alignas(FunctionEntryPoint) unsigned char storage[sizeof(FunctionEntryPoint)];
+};
+
+class EntryPointPool {
+public:
+    explicit EntryPointPool(std::size_t slabSize) : slabSize(slabSize > 0u ? slabSize : 256u) {
+    }
+
+    FunctionEntryPoint *Acquire(const CW(CW_root_Smp, EntryPointDefinition) &definition, Smp::IObject *parent) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return Construct(definition, parent);
+    }
+
+    std::size_t AcquireBatch(
+        std::size_t count,
+        const CW(CW_root_Smp, EntryPointDefinition) *definitions,
+        Smp::IObject *parent,
+        Smp::IEntryPoint **entryPoints
+    ) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::size_t created = 0u;
+        try {
+            for (; created < count; ++created) {
+                entryPoints[created] = Construct(definitions[created], parent);
+            }
+        } catch (...) {
+            CWraPPer::CatchException();
+        }
+        return created;
+    }
+
+    /* Like free, ignores NULL */
+    void Release(Smp::IEntryPoint *entryPoint) {
+        if (entryPoint == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        Destruct(entryPoint);
+    }
+
+    void ReleaseBatch(std::size_t count, Smp::IEntryPoint *const *entryPoints) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::size_t i = 0u; i < count; ++i) {
+            if (entryPoints[i] != nullptr) {
+                Destruct(entryPoints[i]);
+            }
+        }
+    }
+
+    /* The pool is not locked while the event manager runs */
+    FunctionEntryPoint *Subscribe(
+        Smp::Services::IEventManager *eventManager,
+        Smp::Services::EventId event,
+        const CW(CW_root_Smp, EntryPointDefinition) &definition,
+        Smp::IObject *parent
+    ) {
+        FunctionEntryPoint *entryPoint = Acquire(definition, parent);
+        try {
+            eventManager->Subscribe(event, entryPoint);
+        } catch (...) {
+            Release(entryPoint);
+            throw;
+        }
+        return entryPoint;
+    }
+
+    void Unsubscribe(
+        Smp::Services::IEventManager *eventManager,
+        Smp::Services::EventId event,
+        Smp::IEntryPoint *entryPoint
+    ) {
+        eventManager->Unsubscribe(event, entryPoint);
+        Release(entryPoint);
+    }
+
+private:
+    FunctionEntryPoint *Construct(const CW(CW_root_Smp, EntryPointDefinition) &definition, Smp::IObject *parent) {
+        if (freeList == nullptr) {
+            Grow();
+        }
+        EntryPointSlot *slot = freeList;
+        freeList = slot->next;
+        return new (slot->storage) FunctionEntryPoint(definition, parent);
+    }
+
+    void Destruct(Smp::IEntryPoint *entryPoint) {
+        FunctionEntryPoint *object = static_cast<FunctionEntryPoint *>(entryPoint);
+        object->~FunctionEntryPoint();
+        EntryPointSlot *slot = reinterpret_cast<EntryPointSlot *>(object);
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+    void Grow() {
+        std::unique_ptr<EntryPointSlot[]> storage(new EntryPointSlot[slabSize]);
+        slabs.push_back(std::move(storage));
+        EntryPointSlot *slab = slabs.back().get();
+        for (std::size_t i = slabSize; i > 0u; --i) {
+            slab[i - 1u].next = freeList;
+            freeList = &slab[i - 1u];
+        }
+    }
+
+    const std::size_t slabSize;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<EntryPointSlot[]>> slabs;
+    EntryPointSlot *freeList = nullptr;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::EntryPointPool ### */
+#define CW_SPACE CW_root_Smp_EntryPointPool
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) slabSize
+) {
+    try {
+        return new EntryPointPool(
+            static_cast<std::size_t>(slabSize)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    try {
+        delete static_cast<EntryPointPool *>(self);
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW(CW_root_Smp, IEntryPoint) *
+CW(Acquire)
+(
+    CW() * self,
+    const CW(CW_root_Smp, EntryPointDefinition) * definition,
+    CW(CW_root_Smp, IObject) * parent
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IEntryPoint) *>(
+        static_cast<Smp::IEntryPoint *>(static_cast<EntryPointPool *>(self)->Acquire(
+            *definition,
+            static_cast<Smp::IObject *>(parent)
+        )));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW(CW_root_Smp, UInt64)
+CW(AcquireBatch)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp, EntryPointDefinition) * definitions,
+    CW(CW_root_Smp, IObject) * parent,
+    CW(CW_root_Smp, IEntryPoint) ** entryPoints
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<EntryPointPool *>(self)->AcquireBatch(
+            static_cast<std::size_t>(count),
+            definitions,
+            static_cast<Smp::IObject *>(parent),
+            reinterpret_cast<Smp::IEntryPoint **>(entryPoints)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Release)
+(
+    CW() * self,
+    CW(CW_root_Smp, IEntryPoint) * entryPoint
+) {
+    try {
+        static_cast<EntryPointPool *>(self)->Release(
+            static_cast<Smp::IEntryPoint *>(entryPoint)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+void
+CW(ReleaseBatch)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count,
+    CW(CW_root_Smp, IEntryPoint) * const * entryPoints
+) {
+    try {
+        static_cast<EntryPointPool *>(self)->ReleaseBatch(
+            static_cast<std::size_t>(count),
+            reinterpret_cast<Smp::IEntryPoint *const *>(entryPoints)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW(CW_root_Smp, IEntryPoint) *
+CW(Subscribe)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, IEventManager) * eventManager,
+    CW(CW_root_Smp_Services, EventId) event,
+    const CW(CW_root_Smp, EntryPointDefinition) * definition,
+    CW(CW_root_Smp, IObject) * parent
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, IEntryPoint) *>(
+        static_cast<Smp::IEntryPoint *>(static_cast<EntryPointPool *>(self)->Subscribe(
+            static_cast<Smp::Services::IEventManager *>(eventManager),
+            static_cast<Smp::Services::EventId>(event),
+            *definition,
+            static_cast<Smp::IObject *>(parent)
+        )));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Unsubscribe)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, IEventManager) * eventManager,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, IEntryPoint) * entryPoint
+) {
+    try {
+        static_cast<EntryPointPool *>(self)->Unsubscribe(
+            static_cast<Smp::Services::IEventManager *>(eventManager),
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<Smp::IEntryPoint *>(entryPoint)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,54 @@
+/**
+ * Concrete base for the SMP exception interfaces thrown by the services
+ * implemented in this library.
+ */
+#ifndef CWRAPPER_EXCEPTIONBASE_H
+#define CWRAPPER_EXCEPTIONBASE_H
+
+#include <Smp/Exception.h>
+#include <Smp/IObject.h>
+#include <string>
+#include <utility>
+
+namespace CWraPPer {
+
+template <typename Interface>
+class ExceptionBase : public Interface {
+public:
+    ExceptionBase(Smp::String8 name, Smp::String8 description, std::string message, const Smp::IObject *sender) :
+        name(name),
+        description(description),
+        message(std::move(message)),
+        sender(sender) {
+    }
+
+    const char *what() const noexcept override {
+        return message.c_str();
+    }
+
+    Smp::String8 GetName() const noexcept override {
+        return name;
+    }
+
+    Smp::String8 GetDescription() const noexcept override {
+        return description;
+    }
+
+    Smp::String8 GetMessage() const noexcept override {
+        return message.c_str();
+    }
+
+    const Smp::IObject *GetSender() const noexcept override {
+        return sender;
+    }
+
+private:
+    Smp::String8 name;
+    Smp::String8 description;
+    std::string message;
+    const Smp::IObject *sender;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_EXCEPTIONBASE_H */
@@ -0,0 +1,21 @@
+/**
+ * Fills the calling thread's ExceptionRecord from the exception being
+ * handled.
+ *
+ * C++ only, and only from inside a catch block: it rethrows the current
+ * exception to classify it, so a call with no exception in flight ends
+ * in std::terminate. The wrappers call it from their catch (...) block;
+ * Smp-C/Inline.h repeats the declaration for the inline thunks.
+ */
+#ifndef CWRAPPER_EXCEPTIONCATCH_H
+#define CWRAPPER_EXCEPTIONCATCH_H
+
+#include "Smp-C/ExceptionRecord.h"
+
+namespace CWraPPer {
+
+void CatchException() noexcept;
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_EXCEPTIONCATCH_H */
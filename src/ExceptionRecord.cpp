@@ -0,0 +1,219 @@
+/**
+ * Per-thread record of the last C++ exception caught by a wrapper.
+ */
+#include "ExceptionCatch.h"
+#include <Smp/Exception.h>
+#include <Smp/CannotDelete.h>
+#include <Smp/CannotRemove.h>
+#include <Smp/CannotRestore.h>
+#include <Smp/CannotStore.h>
+#include <Smp/ContainerFull.h>
+#include <Smp/DuplicateName.h>
+#include <Smp/DuplicateUuid.h>
+#include <Smp/EventSinkAlreadySubscribed.h>
+#include <Smp/EventSinkNotSubscribed.h>
+#include <Smp/FieldAlreadyConnected.h>
+#include <Smp/FieldNotConnected.h>
+#include <Smp/FileNotFound.h>
+#include <Smp/InvalidAccess.h>
+#include <Smp/InvalidAnyType.h>
+#include <Smp/InvalidArrayIndex.h>
+#include <Smp/InvalidArraySize.h>
+#include <Smp/InvalidArrayValue.h>
+#include <Smp/InvalidComponentState.h>
+#include <Smp/InvalidEventSink.h>
+#include <Smp/InvalidFieldName.h>
+#include <Smp/InvalidFieldValue.h>
+#include <Smp/InvalidFile.h>
+#include <Smp/InvalidObjectName.h>
+#include <Smp/InvalidObjectType.h>
+#include <Smp/InvalidOperationName.h>
+#include <Smp/InvalidParameterCount.h>
+#include <Smp/InvalidParameterIndex.h>
+#include <Smp/InvalidParameterValue.h>
+#include <Smp/InvalidParent.h>
+#include <Smp/InvalidPropertyValue.h>
+#include <Smp/InvalidSimulatorState.h>
+#include <Smp/InvalidSmpVersion.h>
+#include <Smp/InvalidTarget.h>
+#include <Smp/InvalidType.h>
+#include <Smp/NoDynamicInvocation.h>
+#include <Smp/NotContained.h>
+#include <Smp/NotReferenced.h>
+#include <Smp/ReferenceFull.h>
+#include <Smp/VoidOperation.h>
+#include <Smp/Publication/DuplicateLiteral.h>
+#include <Smp/Publication/InvalidArrayItemType.h>
+#include <Smp/Publication/InvalidParameterDirection.h>
+#include <Smp/Publication/InvalidPrimitiveType.h>
+#include <Smp/Publication/TypeAlreadyRegistered.h>
+#include <Smp/Publication/TypeNotRegistered.h>
+#include <Smp/Services/EntryPointAlreadySubscribed.h>
+#include <Smp/Services/EntryPointNotSubscribed.h>
+#include <Smp/Services/InvalidCycleTime.h>
+#include <Smp/Services/InvalidEventId.h>
+#include <Smp/Services/InvalidEventName.h>
+#include <Smp/Services/InvalidEventTime.h>
+#include <Smp/Services/InvalidSimulationTime.h>
+#include <exception>
+
+namespace {
+
+thread_local CW(CW_root_Smp, ExceptionRecord) lastException;
+
+template <typename T>
+bool IsA(const Smp::Exception &exception) {
+    return dynamic_cast<const T *>(&exception) != nullptr;
+}
+
+/* Most derived kinds first (e.g. InvalidArrayValue before InvalidFieldValue) */
+const struct {
+    CW(CW_root_Smp, ExceptionKind) kind;
+    bool (*matches)(const Smp::Exception &);
+} exceptionKinds[] = {
+    { CW(CW_root_Smp_ExceptionKind, CannotDelete), &IsA<Smp::CannotDelete> },
+    { CW(CW_root_Smp_ExceptionKind, CannotRemove), &IsA<Smp::CannotRemove> },
+    { CW(CW_root_Smp_ExceptionKind, CannotRestore), &IsA<Smp::CannotRestore> },
+    { CW(CW_root_Smp_ExceptionKind, CannotStore), &IsA<Smp::CannotStore> },
+    { CW(CW_root_Smp_ExceptionKind, ContainerFull), &IsA<Smp::ContainerFull> },
+    { CW(CW_root_Smp_ExceptionKind, DuplicateName), &IsA<Smp::DuplicateName> },
+    { CW(CW_root_Smp_ExceptionKind, DuplicateUuid), &IsA<Smp::DuplicateUuid> },
+    { CW(CW_root_Smp_ExceptionKind, EventSinkAlreadySubscribed), &IsA<Smp::EventSinkAlreadySubscribed> },
+    { CW(CW_root_Smp_ExceptionKind, EventSinkNotSubscribed), &IsA<Smp::EventSinkNotSubscribed> },
+    { CW(CW_root_Smp_ExceptionKind, FieldAlreadyConnected), &IsA<Smp::FieldAlreadyConnected> },
+    { CW(CW_root_Smp_ExceptionKind, FieldNotConnected), &IsA<Smp::FieldNotConnected> },
+    { CW(CW_root_Smp_ExceptionKind, FileNotFound), &IsA<Smp::FileNotFound> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidAccess), &IsA<Smp::InvalidAccess> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidArrayIndex), &IsA<Smp::InvalidArrayIndex> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidArraySize), &IsA<Smp::InvalidArraySize> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidArrayValue), &IsA<Smp::InvalidArrayValue> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidFieldValue), &IsA<Smp::InvalidFieldValue> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidComponentState), &IsA<Smp::InvalidComponentState> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidEventSink), &IsA<Smp::InvalidEventSink> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidFieldName), &IsA<Smp::InvalidFieldName> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidFile), &IsA<Smp::InvalidFile> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidObjectName), &IsA<Smp::InvalidObjectName> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidObjectType), &IsA<Smp::InvalidObjectType> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidOperationName), &IsA<Smp::InvalidOperationName> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidParameterCount), &IsA<Smp::InvalidParameterCount> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidParameterIndex), &IsA<Smp::InvalidParameterIndex> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidParameterValue), &IsA<Smp::InvalidParameterValue> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidParent), &IsA<Smp::InvalidParent> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidPropertyValue), &IsA<Smp::InvalidPropertyValue> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidAnyType), &IsA<Smp::InvalidAnyType> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidSimulatorState), &IsA<Smp::InvalidSimulatorState> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidSmpVersion), &IsA<Smp::InvalidSmpVersion> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidTarget), &IsA<Smp::InvalidTarget> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidType), &IsA<Smp::InvalidType> },
+    { CW(CW_root_Smp_ExceptionKind, NoDynamicInvocation), &IsA<Smp::NoDynamicInvocation> },
+    { CW(CW_root_Smp_ExceptionKind, NotContained), &IsA<Smp::NotContained> },
+    { CW(CW_root_Smp_ExceptionKind, NotReferenced), &IsA<Smp::NotReferenced> },
+    { CW(CW_root_Smp_ExceptionKind, ReferenceFull), &IsA<Smp::ReferenceFull> },
+    { CW(CW_root_Smp_ExceptionKind, VoidOperation), &IsA<Smp::VoidOperation> },
+    { CW(CW_root_Smp_ExceptionKind, DuplicateLiteral), &IsA<Smp::Publication::DuplicateLiteral> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidArrayItemType), &IsA<Smp::Publication::InvalidArrayItemType> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidParameterDirection), &IsA<Smp::Publication::InvalidParameterDirection> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidPrimitiveType), &IsA<Smp::Publication::InvalidPrimitiveType> },
+    { CW(CW_root_Smp_ExceptionKind, TypeAlreadyRegistered), &IsA<Smp::Publication::TypeAlreadyRegistered> },
+    { CW(CW_root_Smp_ExceptionKind, TypeNotRegistered), &IsA<Smp::Publication::TypeNotRegistered> },
+    { CW(CW_root_Smp_ExceptionKind, EntryPointAlreadySubscribed), &IsA<Smp::Services::EntryPointAlreadySubscribed> },
+    { CW(CW_root_Smp_ExceptionKind, EntryPointNotSubscribed), &IsA<Smp::Services::EntryPointNotSubscribed> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidCycleTime), &IsA<Smp::Services::InvalidCycleTime> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidEventId), &IsA<Smp::Services::InvalidEventId> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidEventName), &IsA<Smp::Services::InvalidEventName> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidEventTime), &IsA<Smp::Services::InvalidEventTime> },
+    { CW(CW_root_Smp_ExceptionKind, InvalidSimulationTime), &IsA<Smp::Services::InvalidSimulationTime> }
+};
+
+CW(CW_root_Smp, ExceptionKind) KindOf(const Smp::Exception &exception) {
+    for (const auto &entry : exceptionKinds) {
+        if (entry.matches(exception)) {
+            return entry.kind;
+        }
+    }
+    return CW(CW_root_Smp_ExceptionKind, Exception);
+}
+
+template <std::size_t N>
+void CopyTruncated(CW(CW_root_Smp, Char8) (&destination)[N], const char *source) {
+    std::size_t i = 0u;
+    if (source != nullptr) {
+        for (; i + 1u < N && source[i] != '\0'; ++i) {
+            destination[i] = source[i];
+        }
+    }
+    destination[i] = '\0';
+}
+
+} /* namespace */
+
+void CWraPPer::CatchException() noexcept {
+    CW(CW_root_Smp, ExceptionRecord) &record = lastException;
+    try {
+        throw;
+    } catch (const Smp::Exception &exception) {
+        record.kind = KindOf(exception);
+        record.sender = static_cast<const CW(CW_root_Smp, IObject) *>(exception.GetSender());
+        CopyTruncated(record.name, exception.GetName());
+        CopyTruncated(record.message, exception.GetMessage());
+    } catch (const std::exception &exception) {
+        record.kind = CW(CW_root_Smp_ExceptionKind, Unknown);
+        record.sender = nullptr;
+        CopyTruncated(record.name, "std::exception");
+        CopyTruncated(record.message, exception.what());
+    } catch (...) {
+        record.kind = CW(CW_root_Smp_ExceptionKind, Unknown);
+        record.sender = nullptr;
+        CopyTruncated(record.name, "unknown");
+        CopyTruncated(record.message, "");
+    }
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ExceptionKind ### */
+#define CW_SPACE CW_root_Smp_ExceptionKind
+
+#undef CW_SPACE
+
+
+/* ### Smp::ExceptionRecord ### */
+#define CW_SPACE CW_root_Smp_ExceptionRecord
+
+const CW(CW_root_Smp, ExceptionRecord) *
+CW(GetLast)
+(
+    void
+) {
+    return lastException.kind != CW(CW_root_Smp_ExceptionKind, None) ? &lastException : nullptr;
+}
+
+void
+CW(Clear)
+(
+    void
+) {
+    lastException.kind = CW(CW_root_Smp_ExceptionKind, None);
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,5 @@
+/**
+ * Field handles: a simple field resolved once from its path.
+ */
+#include "ExceptionCatch.h"
+#include "Smp-C/FieldHandle.inl"
@@ -0,0 +1,304 @@
+/**
+ * Read and write plans over a fixed set of simple fields.
+ */
+#include "Smp-C/FieldPlan.h"
+#include "ExceptionCatch.h"
+#include <Smp/IComponent.h>
+#include <Smp/ISimpleField.h>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+struct FieldPlanEntry {
+    Smp::ISimpleField *field;
+    Smp::PrimitiveTypeKind kind;
+    std::size_t offset;
+};
+
+std::size_t FieldPlanSize(Smp::PrimitiveTypeKind kind) {
+    switch (kind) {
+        case Smp::PrimitiveTypeKind::PTK_Bool: return sizeof(Smp::Bool);
+        case Smp::PrimitiveTypeKind::PTK_Char8: return sizeof(Smp::Char8);
+        case Smp::PrimitiveTypeKind::PTK_UInt8: return sizeof(Smp::UInt8);
+        case Smp::PrimitiveTypeKind::PTK_UInt16: return sizeof(Smp::UInt16);
+        case Smp::PrimitiveTypeKind::PTK_UInt32: return sizeof(Smp::UInt32);
+        case Smp::PrimitiveTypeKind::PTK_UInt64: return sizeof(Smp::UInt64);
+        case Smp::PrimitiveTypeKind::PTK_Int8: return sizeof(Smp::Int8);
+        case Smp::PrimitiveTypeKind::PTK_Int16: return sizeof(Smp::Int16);
+        case Smp::PrimitiveTypeKind::PTK_Int32: return sizeof(Smp::Int32);
+        case Smp::PrimitiveTypeKind::PTK_Int64: return sizeof(Smp::Int64);
+        case Smp::PrimitiveTypeKind::PTK_Float32: return sizeof(Smp::Float32);
+        case Smp::PrimitiveTypeKind::PTK_Float64: return sizeof(Smp::Float64);
+        case Smp::PrimitiveTypeKind::PTK_Duration: return sizeof(Smp::Duration);
+        case Smp::PrimitiveTypeKind::PTK_DateTime: return sizeof(Smp::DateTime);
+        default: return 0u;
+    }
+}
+
+template <typename T, T Smp::AnySimple::PrimitiveTypeValue::*Member>
+void FieldPlanLoad(const Smp::AnySimple &value, Smp::PrimitiveTypeKind kind, unsigned char *destination) {
+    const T native = value.type == kind ? value.value.*Member : static_cast<T>(value);
+    std::memcpy(destination, &native, sizeof(T));
+}
+
+template <typename T>
+void FieldPlanStore(Smp::AnySimple &value, Smp::PrimitiveTypeKind kind, const unsigned char *source) {
+    T native;
+    std::memcpy(&native, source, sizeof(T));
+    value.SetValue(kind, native);
+}
+
+class FieldPlan {
+public:
+    /* Returns false if the field is missing or has no fixed size. */
+    bool Add(Smp::ISimpleField *field) {
+        if (field == nullptr) {
+            return false;
+        }
+        const Smp::PrimitiveTypeKind kind = field->GetPrimitiveTypeKind();
+        const std::size_t fieldSize = FieldPlanSize(kind);
+        if (fieldSize == 0u) {
+            return false;
+        }
+        const std::size_t offset = (size + fieldSize - 1u) / fieldSize * fieldSize;
+        entries.push_back({field, kind, offset});
+        size = offset + fieldSize;
+        return true;
+    }
+
+    void Reserve(std::size_t count) {
+        entries.reserve(count);
+    }
+
+    std::size_t GetCount() const {
+        return entries.size();
+    }
+
+    std::size_t GetSize() const {
+        return size;
+    }
+
+    std::size_t GetOffset(std::size_t index) const {
+        return index < entries.size() ? entries[index].offset : size;
+    }
+
+    std::size_t Read(unsigned char *buffer) const {
+        std::size_t done = 0u;
+        try {
+            for (; done < entries.size(); ++done) {
+                const FieldPlanEntry &entry = entries[done];
+                Load(entry.field->GetValue(), entry.kind, buffer + entry.offset);
+            }
+        } catch (...) {
+            CWraPPer::CatchException();
+        }
+        return done;
+    }
+
+    std::size_t Write(const unsigned char *buffer) const {
+        std::size_t done = 0u;
+        try {
+            Smp::AnySimple value;
+            for (; done < entries.size(); ++done) {
+                const FieldPlanEntry &entry = entries[done];
+                Store(value, entry.kind, buffer + entry.offset);
+                entry.field->SetValue(value);
+            }
+        } catch (...) {
+            CWraPPer::CatchException();
+        }
+        return done;
+    }
+
+private:
+    static void Load(const Smp::AnySimple &value, Smp::PrimitiveTypeKind kind, unsigned char *destination) {
+        using Value = Smp::AnySimple::PrimitiveTypeValue;
+        switch (kind) {
+            case Smp::PrimitiveTypeKind::PTK_Bool: FieldPlanLoad<Smp::Bool, &Value::boolValue>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Char8: FieldPlanLoad<Smp::Char8, &Value::char8Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt8: FieldPlanLoad<Smp::UInt8, &Value::uInt8Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt16: FieldPlanLoad<Smp::UInt16, &Value::uInt16Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt32: FieldPlanLoad<Smp::UInt32, &Value::uInt32Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt64: FieldPlanLoad<Smp::UInt64, &Value::uInt64Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Int8: FieldPlanLoad<Smp::Int8, &Value::int8Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Int16: FieldPlanLoad<Smp::Int16, &Value::int16Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Int32: FieldPlanLoad<Smp::Int32, &Value::int32Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Int64: FieldPlanLoad<Smp::Int64, &Value::int64Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Float32: FieldPlanLoad<Smp::Float32, &Value::float32Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Float64: FieldPlanLoad<Smp::Float64, &Value::float64Value>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_Duration: FieldPlanLoad<Smp::Duration, &Value::durationValue>(value, kind, destination); break;
+            case Smp::PrimitiveTypeKind::PTK_DateTime: FieldPlanLoad<Smp::DateTime, &Value::dateTimeValue>(value, kind, destination); break;
+            default: break;
+        }
+    }
+
+    static void Store(Smp::AnySimple &value, Smp::PrimitiveTypeKind kind, const unsigned char *source) {
+        switch (kind) {
+            case Smp::PrimitiveTypeKind::PTK_Bool: FieldPlanStore<Smp::Bool>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Char8: FieldPlanStore<Smp::Char8>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt8: FieldPlanStore<Smp::UInt8>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt16: FieldPlanStore<Smp::UInt16>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt32: FieldPlanStore<Smp::UInt32>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_UInt64: FieldPlanStore<Smp::UInt64>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Int8: FieldPlanStore<Smp::Int8>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Int16: FieldPlanStore<Smp::Int16>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Int32: FieldPlanStore<Smp::Int32>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Int64: FieldPlanStore<Smp::Int64>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Float32: FieldPlanStore<Smp::Float32>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Float64: FieldPlanStore<Smp::Float64>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_Duration: FieldPlanStore<Smp::Duration>(value, kind, source); break;
+            case Smp::PrimitiveTypeKind::PTK_DateTime: FieldPlanStore<Smp::DateTime>(value, kind, source); break;
+            default: break;
+        }
+    }
+
+    std::vector<FieldPlanEntry> entries;
+    std::size_t size = 0u;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::FieldPlan ### */
+#define CW_SPACE CW_root_Smp_FieldPlan
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp, FieldHandle) * handles
+) {
+    FieldPlan *plan = nullptr;
+    try {
+        plan = new FieldPlan();
+        plan->Reserve(static_cast<std::size_t>(count));
+        for (CW(CW_root_Smp, UInt64) i = 0u; i < count; ++i) {
+            if (!plan->Add(static_cast<Smp::ISimpleField *>(handles[i].field))) {
+                delete plan;
+                return nullptr;
+            }
+        }
+        return plan;
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    delete plan;
+    return {};
+}
+
+CW() *
+CW(CreateFromPaths)
+(
+    CW(CW_root_Smp, IComponent) * component,
+    CW(CW_root_Smp, UInt64) count,
+    const CW(CW_root_Smp, String8) * fullNames
+) {
+    FieldPlan *plan = nullptr;
+    try {
+        Smp::IComponent *owner = static_cast<Smp::IComponent *>(component);
+        plan = new FieldPlan();
+        plan->Reserve(static_cast<std::size_t>(count));
+        for (CW(CW_root_Smp, UInt64) i = 0u; i < count; ++i) {
+            Smp::ISimpleField *field = dynamic_cast<Smp::ISimpleField *>(
+                owner->GetField(static_cast<Smp::String8>(fullNames[i]))
+            );
+            if (!plan->Add(field)) {
+                delete plan;
+                return nullptr;
+            }
+        }
+        return plan;
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    delete plan;
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<FieldPlan *>(self);
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetCount)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const FieldPlan *>(self)->GetCount(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const FieldPlan *>(self)->GetSize(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetOffset)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) index
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const FieldPlan *>(self)->GetOffset(
+        static_cast<std::size_t>(index)
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(Read)
+(
+    const CW() * self,
+    void * buffer
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const FieldPlan *>(self)->Read(
+        static_cast<unsigned char *>(buffer)
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(Write)
+(
+    const CW() * self,
+    const void * buffer
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const FieldPlan *>(self)->Write(
+        static_cast<const unsigned char *>(buffer)
+    ));
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,393 @@
+/**
+ * Branching of a simulation into forked processes, for Monte Carlo runs.
+ *
+ * Each child writes its results to its own pipe; the calling process
+ * polls the pipes of the running children, so that no child blocks on a
+ * full pipe, and reaps a child once its pipe is closed. POSIX only.
+ */
+#include "Smp-C/ForkSnapshot.h"
+#include "ExceptionCatch.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <csignal>
+#include <cstdio>
+#include <limits>
+#include <poll.h>
+#include <stdexcept>
+#include <string>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+const std::size_t readSize = 1u << 16u;
+
+struct Child {
+    pid_t pid;
+    int descriptor;
+    std::size_t branch;
+};
+
+[[noreturn]] void Fail(const char *operation) {
+    throw std::system_error(errno, std::generic_category(), operation);
+}
+
+class ForkSnapshot final {
+public:
+    explicit ForkSnapshot(std::size_t maxRunning) :
+        maxRunning(maxRunning != 0u ? maxRunning : ProcessorCount()) {
+    }
+
+    ~ForkSnapshot() {
+        if (output >= 0) {
+            ::close(output);
+        }
+    }
+
+    ForkSnapshot(const ForkSnapshot &) = delete;
+    ForkSnapshot &operator=(const ForkSnapshot &) = delete;
+
+    std::uint64_t Branch(std::uint64_t count) {
+        results.assign(static_cast<std::size_t>(count), std::string());
+        statuses.assign(static_cast<std::size_t>(count), 0);
+        std::vector<Child> running;
+        std::size_t next = 0u;
+        int error = 0;
+        const char *failed = nullptr;
+        while (next < results.size() || !running.empty()) {
+            while (next < results.size() && running.size() < maxRunning) {
+                int descriptors[2];
+                if (::pipe(descriptors) != 0) {
+                    error = errno;
+                    failed = "pipe";
+                    next = results.size();
+                    break;
+                }
+                /* Buffered output would otherwise be written again by every child */
+                std::fflush(nullptr);
+                const pid_t pid = ::fork();
+                if (pid == 0) {
+                    ::close(descriptors[0]);
+                    for (const Child &child : running) {
+                        ::close(child.descriptor);
+                    }
+                    if (output >= 0) {
+                        ::close(output);
+                    }
+                    output = descriptors[1];
+                    branch = next + 1u;
+                    results.clear();
+                    statuses.clear();
+                    return branch;
+                }
+                ::close(descriptors[1]);
+                if (pid < 0) {
+                    error = errno;
+                    failed = "fork";
+                    ::close(descriptors[0]);
+                    next = results.size();
+                    break;
+                }
+                running.push_back({pid, descriptors[0], next});
+                ++next;
+            }
+            if (!running.empty()) {
+                try {
+                    Collect(running);
+                } catch (...) {
+                    Abandon(running);
+                    throw;
+                }
+            }
+        }
+        if (failed != nullptr) {
+            errno = error;
+            Fail(failed);
+        }
+        return 0u;
+    }
+
+    std::uint64_t GetBranch() const {
+        return branch;
+    }
+
+    void Send(const void *data, std::uint64_t size) {
+        if (output < 0) {
+            throw std::logic_error("Send called outside of a branch");
+        }
+        const char *bytes = static_cast<const char *>(data);
+        while (size > 0u) {
+            const ssize_t written = ::write(output, bytes, static_cast<std::size_t>(size));
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                Fail("write");
+            }
+            bytes += written;
+            size -= static_cast<std::uint64_t>(written);
+        }
+    }
+
+    [[noreturn]] void Exit(std::int32_t status) {
+        if (output < 0) {
+            throw std::logic_error("Exit called outside of a branch");
+        }
+        std::fflush(nullptr);
+        ::_exit(status);
+    }
+
+    const std::string &GetResult(std::uint64_t branch) const {
+        return results[Index(branch)];
+    }
+
+    std::int32_t GetExitStatus(std::uint64_t branch) const {
+        return statuses[Index(branch)];
+    }
+
+private:
+    static std::size_t ProcessorCount() {
+        const long count = ::sysconf(_SC_NPROCESSORS_ONLN);
+        return count > 0 ? static_cast<std::size_t>(count) : 1u;
+    }
+
+    std::size_t Index(std::uint64_t branch) const {
+        if (branch == 0u || branch > results.size()) {
+            throw std::out_of_range("No branch " + std::to_string(branch));
+        }
+        return static_cast<std::size_t>(branch - 1u);
+    }
+
+    /* Reads whatever the running children have sent, reaps those that are done */
+    void Collect(std::vector<Child> &running) {
+        std::vector<pollfd> polled(running.size());
+        for (std::size_t i = 0u; i < running.size(); ++i) {
+            polled[i].fd = running[i].descriptor;
+            polled[i].events = POLLIN;
+            polled[i].revents = 0;
+        }
+        if (::poll(polled.data(), static_cast<nfds_t>(polled.size()), -1) < 0) {
+            if (errno == EINTR) {
+                return;
+            }
+            Fail("poll");
+        }
+        char buffer[readSize];
+        std::vector<Child> stillRunning;
+        stillRunning.reserve(running.size());
+        for (std::size_t i = 0u; i < running.size(); ++i) {
+            Child &child = running[i];
+            bool done = false;
+            if (polled[i].revents != 0) {
+                const ssize_t size = ::read(child.descriptor, buffer, sizeof(buffer));
+                if (size > 0) {
+                    results[child.branch].append(buffer, static_cast<std::size_t>(size));
+                } else if (size == 0 || errno != EINTR) {
+                    done = true;
+                }
+            }
+            if (done) {
+                ::close(child.descriptor);
+                statuses[child.branch] = Reap(child.pid);
+            } else {
+                stillRunning.push_back(child);
+            }
+        }
+        running.swap(stillRunning);
+    }
+
+    /* Kills and reaps the children that can no longer be watched */
+    void Abandon(std::vector<Child> &running) {
+        for (const Child &child : running) {
+            ::kill(child.pid, SIGKILL);
+            ::close(child.descriptor);
+            statuses[child.branch] = Reap(child.pid);
+        }
+        running.clear();
+    }
+
+    static std::int32_t Reap(pid_t pid) {
+        int status = 0;
+        while (::waitpid(pid, &status, 0) < 0) {
+            if (errno != EINTR) {
+                return -1;
+            }
+        }
+        if (WIFSIGNALED(status)) {
+            return -WTERMSIG(status);
+        }
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
+    const std::size_t maxRunning;
+    std::vector<std::string> results;
+    std::vector<std::int32_t> statuses;
+    std::uint64_t branch = 0u;
+    int output = -1;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ForkSnapshot ### */
+#define CW_SPACE CW_root_Smp_ForkSnapshot
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) maxRunning
+) {
+    try {
+        return new ForkSnapshot(
+            static_cast<std::size_t>(maxRunning)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<ForkSnapshot *>(self);
+}
+
+CW(CW_root_Smp, UInt64)
+CW(Branch)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) count
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<ForkSnapshot *>(self)->Branch(
+            static_cast<std::uint64_t>(count)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return std::numeric_limits<CW(CW_root_Smp, UInt64)>::max();
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetBranch)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const ForkSnapshot *>(self)->GetBranch(
+    ));
+}
+
+void
+CW(Send)
+(
+    CW() * self,
+    const void * data,
+    CW(CW_root_Smp, UInt64) size
+) {
+    try {
+        static_cast<ForkSnapshot *>(self)->Send(
+            data,
+            static_cast<std::uint64_t>(size)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+void
+CW(Exit)
+(
+    CW() * self,
+    CW(CW_root_Smp, Int32) status
+) {
+    try {
+        static_cast<ForkSnapshot *>(self)->Exit(
+            static_cast<std::int32_t>(status)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetResultSize)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) branch
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<const ForkSnapshot *>(self)->GetResult(
+            static_cast<std::uint64_t>(branch)
+        ).size());
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+const void *
+CW(GetResult)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) branch
+) {
+    try {
+        return static_cast<const void *>(
+        static_cast<const ForkSnapshot *>(self)->GetResult(
+            static_cast<std::uint64_t>(branch)
+        ).data());
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW(CW_root_Smp, Int32)
+CW(GetExitStatus)
+(
+    const CW() * self,
+    CW(CW_root_Smp, UInt64) branch
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Int32)>(
+        static_cast<const ForkSnapshot *>(self)->GetExitStatus(
+            static_cast<std::uint64_t>(branch)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -1,71 +1,5 @@
 /**
  * This file was auto-generated by https://github.com/abadiet/CWraPPer/
  */
-#include "Smp-C/Publication/InvalidArrayItemType.h"
-#include <Smp/Publication/InvalidArrayItemType.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif /* __cplusplus */
-
-
-/* ### root ### */
-#define CW_SPACE CW_root
-
-#undef CW_SPACE
-
-
-/* ### Smp ### */
-#define CW_SPACE CW_root_Smp
-
-#undef CW_SPACE
-
-
-/* ### Smp::Publication ### */
-#define CW_SPACE CW_root_Smp_Publication
-
-#undef CW_SPACE
-
-
-/* ### Smp::Publication::InvalidArrayItemType ### */
-#define CW_SPACE CW_root_Smp_Publication_InvalidArrayItemType
-
-void
-CW(_InvalidArrayItemType)
-(
-    CW() * self
-) {
-    static_cast<Smp::Publication::InvalidArrayItemType *>(self)->~InvalidArrayItemType(
-    );
-}
-
-CW(CW_root_Smp, String8)
-CW(GetTypeName)
-(
-    CW() * self
-) {
-    return static_cast<CW(CW_root_Smp, String8)>(
-    static_cast<Smp::Publication::InvalidArrayItemType *>(self)->GetTypeName(
-    ));
-}
-
-CW(CW_root_Smp, PrimitiveTypeKind)
-CW(GetType)
-(
-    CW() * self
-) {
-    return static_cast<CW(CW_root_Smp, PrimitiveTypeKind)>(
-    static_cast<Smp::Publication::InvalidArrayItemType *>(self)->GetType(
-    ));
-}
-
-/* Error while processing function "InvalidArrayItemType" at Smp/Publication/InvalidArrayItemType.h:32:15 (exported to Smp-C/Publication/InvalidArrayItemType.h) : Skipping constructor */
-
-/* Error while processing function "operator=" at Smp/Publication/InvalidArrayItemType.h:32:15 (exported to Smp-C/Publication/InvalidArrayItemType.h) : Reference type is not supported: InvalidArrayItemType & */
-
-#undef CW_SPACE
-
-
-#ifdef __cplusplus
-}
-#endif /* __cplusplus */
+#include "ExceptionCatch.h"
+#include "Smp-C/Publication/InvalidArrayItemType.inl"
@@ -0,0 +1,154 @@
+/**
+ * File mapped in memory, for the storage writers and readers.
+ *
+ * Read files are mapped privately and read only. Written files are
+ * mapped shared, and Resize grows both the file and the mapping; the
+ * mapping may move, so no pointer into it survives a Resize. Errors are
+ * thrown as std::system_error. POSIX only.
+ */
+#ifndef CWRAPPER_MAPPEDFILE_H
+#define CWRAPPER_MAPPEDFILE_H
+
+#include <cerrno>
+#include <cstdint>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace CWraPPer {
+
+class MappedFile {
+public:
+    enum Mode {
+        Read,
+        Write
+    };
+
+    /* Write truncates the file, then reserves size bytes for it */
+    MappedFile(const std::string &fileName, Mode mode, std::uint64_t size = 0u) :
+        fileName(fileName),
+        mode(mode) {
+        descriptor = ::open(fileName.c_str(), mode == Read ? O_RDONLY : (O_RDWR | O_CREAT | O_TRUNC), 0644);
+        if (descriptor < 0) {
+            Fail("open");
+        }
+        try {
+            if (mode == Read) {
+                struct stat status;
+                if (::fstat(descriptor, &status) != 0) {
+                    Fail("fstat");
+                }
+                data = Map(static_cast<std::uint64_t>(status.st_size));
+                this->size = static_cast<std::uint64_t>(status.st_size);
+                if (data != nullptr) {
+                    ::madvise(data, static_cast<std::size_t>(this->size), MADV_SEQUENTIAL);
+                }
+            } else {
+                Resize(size);
+            }
+        } catch (...) {
+            ::close(descriptor);
+            throw;
+        }
+    }
+
+    ~MappedFile() {
+        Unmap();
+        ::close(descriptor);
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    char *GetData() const {
+        return data;
+    }
+
+    std::uint64_t GetSize() const {
+        return size;
+    }
+
+    const std::string &GetFileName() const {
+        return fileName;
+    }
+
+    /*
+     * Write mode only, the new bytes read as zeros. The new mapping is made
+     * before the old one goes, so on failure the file keeps its previous
+     * size and mapping.
+     */
+    void Resize(std::uint64_t newSize) {
+        const std::uint64_t oldSize = size;
+        if (newSize > oldSize) {
+            if (::ftruncate(descriptor, static_cast<off_t>(newSize)) != 0) {
+                Fail("ftruncate");
+            }
+            /* Reserve the blocks now rather than on first touch; not every file system can */
+            const int result = ::posix_fallocate(descriptor, 0, static_cast<off_t>(newSize));
+            if (result != 0 && result != EOPNOTSUPP && result != EINVAL) {
+                errno = result;
+                Fail("posix_fallocate");
+            }
+        }
+        char *newData = Map(newSize);
+        Unmap();
+        data = newData;
+        size = newSize;
+        if (newSize < oldSize && ::ftruncate(descriptor, static_cast<off_t>(newSize)) != 0) {
+            Fail("ftruncate");
+        }
+    }
+
+    /* Unmaps the file and cuts it to size bytes; nothing may be accessed afterwards */
+    void Close(std::uint64_t newSize) {
+        Unmap();
+        if (mode == Write && ::ftruncate(descriptor, static_cast<off_t>(newSize)) != 0) {
+            Fail("ftruncate");
+        }
+    }
+
+private:
+    /* Maps the first length bytes of the file, nullptr for none; leaves the current mapping alone */
+    char *Map(std::uint64_t length) const {
+        if (length == 0u) {
+            return nullptr;
+        }
+        void *address = ::mmap(
+            nullptr,
+            static_cast<std::size_t>(length),
+            mode == Read ? PROT_READ : (PROT_READ | PROT_WRITE),
+            mode == Read ? MAP_PRIVATE : MAP_SHARED,
+            descriptor,
+            0
+        );
+        if (address == MAP_FAILED) {
+            Fail("mmap");
+        }
+        return static_cast<char *>(address);
+    }
+
+    void Unmap() {
+        if (data != nullptr) {
+            ::munmap(data, static_cast<std::size_t>(size));
+            data = nullptr;
+        }
+        size = 0u;
+    }
+
+    [[noreturn]] void Fail(const char *operation) const {
+        throw std::system_error(errno, std::generic_category(), std::string(operation) + " " + fileName);
+    }
+
+    std::string fileName;
+    Mode mode;
+    int descriptor = -1;
+    char *data = nullptr;
+    std::uint64_t size = 0u;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_MAPPEDFILE_H */
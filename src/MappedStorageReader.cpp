@@ -0,0 +1,128 @@
+/**
+ * Storage reader restoring from a memory-mapped state vector file.
+ */
+#include "Smp-C/MappedStorageReader.h"
+#include "ExceptionCatch.h"
+#include "MappedFile.h"
+#include "StorageBase.h"
+#include <Smp/IStorageReader.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace {
+
+class MappedStorageReader final : public CWraPPer::StorageBase<Smp::IStorageReader> {
+public:
+    MappedStorageReader(Smp::String8 path, Smp::String8 fileName) :
+        StorageBase(path, fileName),
+        file(FullName(), CWraPPer::MappedFile::Read) {
+    }
+
+    void Restore(void *address, Smp::UInt64 size) override {
+        if (size > file.GetSize() - position) {
+            throw CWraPPer::StorageCannotRestore(
+                "State vector file " + file.GetFileName() + " ends before " + std::to_string(position + size)
+                    + " bytes");
+        }
+        if (size != 0u) {
+            std::memcpy(address, file.GetData() + position, static_cast<std::size_t>(size));
+        }
+        position += size;
+    }
+
+    std::uint64_t GetSize() const {
+        return file.GetSize();
+    }
+
+    std::uint64_t GetPosition() const {
+        return position;
+    }
+
+private:
+    CWraPPer::MappedFile file;
+    std::uint64_t position = 0u;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::MappedStorageReader ### */
+#define CW_SPACE CW_root_Smp_MappedStorageReader
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+) {
+    try {
+        return new MappedStorageReader(
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<MappedStorageReader *>(self);
+}
+
+CW(CW_root_Smp, IStorageReader) *
+CW(GetStorageReader)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IStorageReader) *>(
+    static_cast<Smp::IStorageReader *>(static_cast<MappedStorageReader *>(self)));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const MappedStorageReader *>(self)->GetSize(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetPosition)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const MappedStorageReader *>(self)->GetPosition(
+    ));
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,140 @@
+/**
+ * Storage writer appending to a memory-mapped state vector file.
+ */
+#include "Smp-C/MappedStorageWriter.h"
+#include "ExceptionCatch.h"
+#include "MappedFile.h"
+#include "StorageBase.h"
+#include <Smp/IStorageWriter.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <system_error>
+
+namespace {
+
+const std::uint64_t minimumGrowth = 1u << 20u;
+
+class MappedStorageWriter final : public CWraPPer::StorageBase<Smp::IStorageWriter> {
+public:
+    MappedStorageWriter(Smp::String8 path, Smp::String8 fileName, std::uint64_t capacity) :
+        StorageBase(path, fileName),
+        file(FullName(), CWraPPer::MappedFile::Write, capacity) {
+    }
+
+    ~MappedStorageWriter() override {
+        try {
+            file.Close(position);
+        } catch (...) {
+        }
+    }
+
+    void Store(const void *address, Smp::UInt64 size) override {
+        if (size > file.GetSize() - position) {
+            Grow(size);
+        }
+        if (size != 0u) {
+            std::memcpy(file.GetData() + position, address, static_cast<std::size_t>(size));
+        }
+        position += size;
+    }
+
+    std::uint64_t GetSize() const {
+        return position;
+    }
+
+private:
+    /* Leaves the file as it was when it cannot make room for size more bytes */
+    void Grow(std::uint64_t size) {
+        if (size > std::numeric_limits<std::uint64_t>::max() - position) {
+            throw CWraPPer::StorageCannotStore("Cannot store " + std::to_string(size) + " more bytes");
+        }
+        const std::uint64_t required = position + size;
+        try {
+            file.Resize(std::max({required, file.GetSize() * 2u, minimumGrowth}));
+        } catch (const std::system_error &error) {
+            throw CWraPPer::StorageCannotStore(
+                "Cannot grow the state vector file to " + std::to_string(required) + " bytes: " + error.what());
+        }
+    }
+
+    CWraPPer::MappedFile file;
+    std::uint64_t position = 0u;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::MappedStorageWriter ### */
+#define CW_SPACE CW_root_Smp_MappedStorageWriter
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) capacity
+) {
+    try {
+        return new MappedStorageWriter(
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName),
+            static_cast<std::uint64_t>(capacity)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<MappedStorageWriter *>(self);
+}
+
+CW(CW_root_Smp, IStorageWriter) *
+CW(GetStorageWriter)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IStorageWriter) *>(
+    static_cast<Smp::IStorageWriter *>(static_cast<MappedStorageWriter *>(self)));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetSize)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const MappedStorageWriter *>(self)->GetSize(
+    ));
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
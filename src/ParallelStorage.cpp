@@ -0,0 +1,387 @@
+/**
+ * Breakpoint driver storing and restoring components in parallel.
+ *
+ * File layout: the magic "SMPCPAR1" and the offset of the index (8 bytes
+ * each), the segments one after the other, then the index: the segment
+ * count, and for each segment its offset, its size, the length of the
+ * component path and the path itself (integers are 8 bytes, host order).
+ *
+ * Store keeps every segment in memory until all are stored, as the file
+ * offsets depend on the sizes of the segments before: the state is
+ * copied twice, into the segments then into the mapped file, and peaks
+ * at the state size in memory on top of the file. Each segment is
+ * released as soon as it is copied.
+ */
+#include "Smp-C/ParallelStorage.h"
+#include "ExceptionCatch.h"
+#include "MappedFile.h"
+#include "StorageBase.h"
+#include "WorkStealingPool.h"
+#include <Smp/IComponent.h>
+#include <Smp/IComposite.h>
+#include <Smp/IContainer.h>
+#include <Smp/IPersist.h>
+#include <Smp/ISimulator.h>
+#include <Smp/IStorageReader.h>
+#include <Smp/IStorageWriter.h>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const char parallelMagic[8] = {'S', 'M', 'P', 'C', 'P', 'A', 'R', '1'};
+const std::size_t parallelHeaderSize = 16u;
+
+struct Segment {
+    std::string path;
+    Smp::IPersist *persist;
+    std::string data;
+    std::uint64_t offset = 0u;
+    std::exception_ptr failure;
+};
+
+/* Writer of a single segment, kept in memory */
+class SegmentWriter final : public CWraPPer::StorageBase<Smp::IStorageWriter> {
+public:
+    SegmentWriter(Smp::String8 path, Smp::String8 fileName, std::string &data) :
+        StorageBase(path, fileName),
+        data(data) {
+    }
+
+    void Store(const void *address, Smp::UInt64 size) override {
+        data.append(static_cast<const char *>(address), static_cast<std::size_t>(size));
+    }
+
+private:
+    std::string &data;
+};
+
+/* Reader of a single segment of the mapped file */
+class SegmentReader final : public CWraPPer::StorageBase<Smp::IStorageReader> {
+public:
+    SegmentReader(Smp::String8 path, Smp::String8 fileName, const char *data, std::uint64_t size) :
+        StorageBase(path, fileName),
+        data(data),
+        size(size) {
+    }
+
+    void Restore(void *address, Smp::UInt64 size) override {
+        if (size > this->size - position) {
+            throw CWraPPer::StorageCannotRestore(
+                "Segment of " + std::to_string(this->size) + " bytes ends before " + std::to_string(position + size)
+                    + " bytes");
+        }
+        if (size != 0u) {
+            std::memcpy(address, data + position, static_cast<std::size_t>(size));
+        }
+        position += size;
+    }
+
+private:
+    const char *data;
+    std::uint64_t size;
+    std::uint64_t position = 0u;
+};
+
+/* Appends the name of an object to its path, nothing for an object without a name */
+void AppendName(std::string &path, Smp::String8 name) {
+    if (name != nullptr) {
+        path += name;
+    }
+}
+
+/* Appends the IPersist components below composite, depth first, with their path from the simulator */
+void CollectSegments(const Smp::IComposite *composite, const std::string &prefix, std::vector<Segment> &segments) {
+    const Smp::ContainerCollection *containers = composite->GetContainers();
+    if (containers == nullptr) {
+        return;
+    }
+    for (Smp::IContainer *container : *containers) {
+        const Smp::ComponentCollection *components = container->GetComponents();
+        if (components == nullptr) {
+            continue;
+        }
+        std::string containerPath = prefix;
+        AppendName(containerPath, container->GetName());
+        containerPath += '/';
+        for (Smp::IComponent *component : *components) {
+            std::string componentPath = containerPath;
+            AppendName(componentPath, component->GetName());
+            if (Smp::IPersist *persist = dynamic_cast<Smp::IPersist *>(component)) {
+                segments.push_back({componentPath, persist, {}, 0u, nullptr});
+            }
+            if (const Smp::IComposite *child = dynamic_cast<const Smp::IComposite *>(component)) {
+                CollectSegments(child, componentPath + '/', segments);
+            }
+        }
+    }
+}
+
+void AppendInteger(std::string &buffer, std::uint64_t value) {
+    buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+/* Reads an integer of the index, false past its end */
+bool ReadInteger(const char *&cursor, const char *end, std::uint64_t &value) {
+    if (static_cast<std::size_t>(end - cursor) < sizeof(value)) {
+        return false;
+    }
+    std::memcpy(&value, cursor, sizeof(value));
+    cursor += sizeof(value);
+    return true;
+}
+
+/* Rethrows the failure of the first segment that has one */
+void RethrowFailure(const std::vector<Segment> &segments) {
+    for (const Segment &segment : segments) {
+        if (segment.failure) {
+            std::rethrow_exception(segment.failure);
+        }
+    }
+}
+
+class ParallelStorage final {
+public:
+    explicit ParallelStorage(std::size_t workerCount) :
+        pool(workerCount) {
+    }
+
+    std::uint64_t Store(Smp::ISimulator *simulator, Smp::String8 path, Smp::String8 fileName) {
+        std::vector<Segment> segments;
+        CollectSegments(simulator, "", segments);
+        /* The index is keyed by path: two components with one path could not be told apart on Restore */
+        std::unordered_set<std::string> paths;
+        for (const Segment &segment : segments) {
+            if (!paths.insert(segment.path).second) {
+                throw CWraPPer::StorageCannotStore("Several components have the path " + segment.path);
+            }
+        }
+        pool.Run(segments.size(), [&segments, path, fileName](std::size_t i) {
+            Segment &segment = segments[i];
+            try {
+                SegmentWriter writer(path, fileName, segment.data);
+                segment.persist->Store(&writer);
+            } catch (...) {
+                segment.failure = std::current_exception();
+            }
+        });
+        RethrowFailure(segments);
+
+        std::uint64_t offset = parallelHeaderSize;
+        std::string index;
+        AppendInteger(index, segments.size());
+        for (Segment &segment : segments) {
+            segment.offset = offset;
+            offset += segment.data.size();
+            AppendInteger(index, segment.offset);
+            AppendInteger(index, segment.data.size());
+            AppendInteger(index, segment.path.size());
+            index += segment.path;
+        }
+        const std::uint64_t indexOffset = offset;
+        const std::uint64_t fileSize = indexOffset + index.size();
+        const std::string fullName = CWraPPer::StorageFileName(path, fileName);
+        try {
+            CWraPPer::MappedFile file(fullName, CWraPPer::MappedFile::Write, fileSize);
+            char *data = file.GetData();
+            std::memcpy(data, parallelMagic, sizeof(parallelMagic));
+            std::memcpy(data + sizeof(parallelMagic), &indexOffset, sizeof(indexOffset));
+            pool.Run(segments.size(), [&segments, data](std::size_t i) {
+                Segment &segment = segments[i];
+                if (!segment.data.empty()) {
+                    std::memcpy(data + segment.offset, segment.data.data(), segment.data.size());
+                }
+                std::string().swap(segment.data);
+            });
+            std::memcpy(data + indexOffset, index.data(), index.size());
+            file.Close(fileSize);
+        } catch (const std::system_error &error) {
+            throw CWraPPer::StorageCannotStore("Cannot write the state vector file " + fullName + ": " + error.what());
+        }
+        return segments.size();
+    }
+
+    std::uint64_t Restore(Smp::ISimulator *simulator, Smp::String8 path, Smp::String8 fileName) {
+        const std::unique_ptr<CWraPPer::MappedFile> file = Open(CWraPPer::StorageFileName(path, fileName));
+        const char *data = file->GetData();
+        const std::unordered_map<std::string, std::pair<std::uint64_t, std::uint64_t>> index = ReadIndex(*file);
+        std::vector<Segment> segments;
+        CollectSegments(simulator, "", segments);
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> ranges;
+        ranges.reserve(segments.size());
+        for (const Segment &segment : segments) {
+            const auto entry = index.find(segment.path);
+            if (entry == index.end()) {
+                throw CWraPPer::StorageCannotRestore(
+                    "State vector file " + file->GetFileName() + " has no segment for " + segment.path);
+            }
+            ranges.push_back(entry->second);
+        }
+        pool.Run(segments.size(), [&segments, &ranges, data, path, fileName](std::size_t i) {
+            Segment &segment = segments[i];
+            try {
+                SegmentReader reader(path, fileName, data + ranges[i].first, ranges[i].second);
+                segment.persist->Restore(&reader);
+            } catch (...) {
+                segment.failure = std::current_exception();
+            }
+        });
+        RethrowFailure(segments);
+        return segments.size();
+    }
+
+private:
+    static std::unique_ptr<CWraPPer::MappedFile> Open(const std::string &fullName) {
+        try {
+            return std::unique_ptr<CWraPPer::MappedFile>(
+                new CWraPPer::MappedFile(fullName, CWraPPer::MappedFile::Read));
+        } catch (const std::system_error &error) {
+            throw CWraPPer::StorageCannotRestore("Cannot read the state vector file " + fullName + ": " + error.what());
+        }
+    }
+
+    /* Maps each component path to the offset and the size of its segment */
+    static std::unordered_map<std::string, std::pair<std::uint64_t, std::uint64_t>> ReadIndex(
+        const CWraPPer::MappedFile &file
+    ) {
+        const char *data = file.GetData();
+        const char *end = data + file.GetSize();
+        std::uint64_t indexOffset = 0u;
+        if (file.GetSize() < parallelHeaderSize
+            || std::memcmp(data, parallelMagic, sizeof(parallelMagic)) != 0) {
+            throw CWraPPer::StorageCannotRestore(file.GetFileName() + " is not a parallel state vector file");
+        }
+        std::memcpy(&indexOffset, data + sizeof(parallelMagic), sizeof(indexOffset));
+        const std::string corrupted = "Corrupted index in the state vector file " + file.GetFileName();
+        if (indexOffset < parallelHeaderSize || indexOffset > file.GetSize()) {
+            throw CWraPPer::StorageCannotRestore(corrupted);
+        }
+        const char *cursor = data + indexOffset;
+        std::uint64_t count = 0u;
+        if (!ReadInteger(cursor, end, count)) {
+            throw CWraPPer::StorageCannotRestore(corrupted);
+        }
+        std::unordered_map<std::string, std::pair<std::uint64_t, std::uint64_t>> index;
+        for (std::uint64_t i = 0u; i < count; ++i) {
+            std::uint64_t offset = 0u;
+            std::uint64_t size = 0u;
+            std::uint64_t pathLength = 0u;
+            if (!ReadInteger(cursor, end, offset) || !ReadInteger(cursor, end, size)
+                || !ReadInteger(cursor, end, pathLength) || pathLength > static_cast<std::uint64_t>(end - cursor)
+                || offset < parallelHeaderSize || offset > indexOffset || size > indexOffset - offset) {
+                throw CWraPPer::StorageCannotRestore(corrupted);
+            }
+            std::string componentPath(cursor, static_cast<std::size_t>(pathLength));
+            cursor += pathLength;
+            /* Store never writes a path twice */
+            if (!index.emplace(std::move(componentPath), std::make_pair(offset, size)).second) {
+                throw CWraPPer::StorageCannotRestore(corrupted);
+            }
+        }
+        return index;
+    }
+
+    CWraPPer::WorkStealingPool pool;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::ParallelStorage ### */
+#define CW_SPACE CW_root_Smp_ParallelStorage
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) workerCount
+) {
+    try {
+        return new ParallelStorage(
+            static_cast<std::size_t>(workerCount)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<ParallelStorage *>(self);
+}
+
+CW(CW_root_Smp, UInt64)
+CW(Store)
+(
+    CW() * self,
+    CW(CW_root_Smp, ISimulator) * simulator,
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<ParallelStorage *>(self)->Store(
+            static_cast<Smp::ISimulator *>(simulator),
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW(CW_root_Smp, UInt64)
+CW(Restore)
+(
+    CW() * self,
+    CW(CW_root_Smp, ISimulator) * simulator,
+    CW(CW_root_Smp, String8) path,
+    CW(CW_root_Smp, String8) fileName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<ParallelStorage *>(self)->Restore(
+            static_cast<Smp::ISimulator *>(simulator),
+            static_cast<Smp::String8>(path),
+            static_cast<Smp::String8>(fileName)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
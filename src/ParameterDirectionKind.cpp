@@ -1,34 +1,5 @@
 /**
  * This file was auto-generated by https://github.com/abadiet/CWraPPer/
  */
-#include "Smp-C/Publication/ParameterDirectionKind.h"
-#include <Smp/Publication/ParameterDirectionKind.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif /* __cplusplus */
-
-
-/* ### root ### */
-#define CW_SPACE CW_root
-
-#undef CW_SPACE
-
-
-/* ### Smp ### */
-#define CW_SPACE CW_root_Smp
-
-#undef CW_SPACE
-
-
-/* ### Smp::Publication ### */
-#define CW_SPACE CW_root_Smp_Publication
-
-/* Error while processing function "operator<<" at Smp/Publication/ParameterDirectionKind.h:54:23 (exported to Smp-C/Publication/ParameterDirectionKind.h) : Reference type is not supported: std::ostream & */
-
-#undef CW_SPACE
-
-
-#ifdef __cplusplus
-}
-#endif /* __cplusplus */
+#include "ExceptionCatch.h"
+#include "Smp-C/Publication/ParameterDirectionKind.inl"
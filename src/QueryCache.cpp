@@ -0,0 +1,191 @@
+/**
+ * Cached QueryLogMessageKind and QueryEventId.
+ */
+#include "Smp-C/Services/QueryCache.h"
+#include "ExceptionCatch.h"
+#include <Smp/Services/IEventManager.h>
+#include <Smp/Services/ILogger.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+const std::size_t threadSlots = 256u;
+
+/* FNV-1a over the content of the name */
+std::uint64_t HashName(const char *name) {
+    std::uint64_t hash = UINT64_C(0xCBF29CE484222325);
+    for (; *name != '\0'; ++name) {
+        hash = (hash ^ static_cast<unsigned char>(*name)) * UINT64_C(0x100000001B3);
+    }
+    return hash;
+}
+
+/* Interned ids of one kind of query; a single table per id type, as the thread slots are per type */
+template <typename Id>
+class InternTable {
+public:
+    /* Returns the cached id of the name on the service, calling query(name) the first time */
+    template <typename Query>
+    Id Find(const void *service, const char *name, Query query) {
+        if (name == nullptr) {
+            return query(name);
+        }
+        const std::uint64_t hash = HashName(name);
+        const std::uint64_t current = generation.load(std::memory_order_acquire);
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(name);
+        Slot &slot = slots[(address ^ (address >> 8u) ^ hash) & (threadSlots - 1u)];
+        if (slot.name == name && slot.service == service && slot.hash == hash && slot.generation == current) {
+            return slot.id;
+        }
+        const std::uint64_t key = Key(service, hash);
+        Id id;
+        if (!FindShared(service, key, name, id)) {
+            id = query(name);
+            std::lock_guard<std::shared_mutex> lock(mutex);
+            /* Ids queried before a Clear must not outlive it */
+            if (generation.load(std::memory_order_relaxed) == current && !FindLocked(service, key, name, id)) {
+                entries.emplace(key, Entry{service, name, id});
+            }
+        }
+        slot = Slot{name, service, hash, current, id};
+        return id;
+    }
+
+    void Clear() {
+        std::lock_guard<std::shared_mutex> lock(mutex);
+        entries.clear();
+        generation.fetch_add(1u, std::memory_order_release);
+    }
+
+private:
+    struct Entry {
+        const void *service;
+        std::string name;
+        Id id;
+    };
+
+    struct Slot {
+        const char *name;
+        const void *service;
+        std::uint64_t hash;
+        std::uint64_t generation;
+        Id id;
+    };
+
+    static std::uint64_t Key(const void *service, std::uint64_t hash) {
+        return hash ^ (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(service))
+            * UINT64_C(0x9E3779B97F4A7C15));
+    }
+
+    bool FindShared(const void *service, std::uint64_t key, const char *name, Id &id) {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        return FindLocked(service, key, name, id);
+    }
+
+    bool FindLocked(const void *service, std::uint64_t key, const char *name, Id &id) const {
+        const auto range = entries.equal_range(key);
+        for (auto entry = range.first; entry != range.second; ++entry) {
+            if (entry->second.service == service && entry->second.name == name) {
+                id = entry->second.id;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static thread_local Slot slots[threadSlots];
+
+    std::shared_mutex mutex;
+    std::unordered_multimap<std::uint64_t, Entry> entries;
+    std::atomic<std::uint64_t> generation{1u};
+};
+
+template <typename Id>
+thread_local typename InternTable<Id>::Slot InternTable<Id>::slots[threadSlots] = {};
+
+InternTable<Smp::Services::LogMessageKind> logMessageKinds;
+InternTable<Smp::Services::EventId> eventIds;
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::QueryCache ### */
+#define CW_SPACE CW_root_Smp_Services_QueryCache
+
+CW(CW_root_Smp_Services, LogMessageKind)
+CW(QueryLogMessageKind)
+(
+    CW(CW_root_Smp_Services, ILogger) * logger,
+    CW(CW_root_Smp, String8) messageKindName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, LogMessageKind)>(
+        logMessageKinds.Find(logger, static_cast<Smp::String8>(messageKindName), [logger](Smp::String8 name) {
+            return static_cast<Smp::Services::ILogger *>(logger)->QueryLogMessageKind(name);
+        }));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW(CW_root_Smp_Services, EventId)
+CW(QueryEventId)
+(
+    CW(CW_root_Smp_Services, IEventManager) * eventManager,
+    CW(CW_root_Smp, String8) eventName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp_Services, EventId)>(
+        eventIds.Find(eventManager, static_cast<Smp::String8>(eventName), [eventManager](Smp::String8 name) {
+            return static_cast<Smp::Services::IEventManager *>(eventManager)->QueryEventId(name);
+        }));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Clear)
+(
+    void
+) {
+    logMessageKinds.Clear();
+    eventIds.Clear();
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
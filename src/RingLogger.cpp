@@ -0,0 +1,1023 @@
+/**
+ * Logger service writing to a file from a background thread.
+ */
+#include "Smp-C/Services/RingLogger.h"
+#include "ExceptionCatch.h"
+#include "ServiceBase.h"
+#include <Smp/IObject.h>
+#include <Smp/ISimulator.h>
+#include <Smp/Services/ILogger.h>
+#include <Smp/Services/ITimeKeeper.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+/* Names of the standard kinds, in ILogger LMK_* order */
+const char *const standardKinds[] = {"Information", "Event", "Warning", "Error", "Debug"};
+
+const std::size_t defaultRingCapacity = 64u * 1024u;
+const std::size_t minimumRingCapacity = 256u;
+const std::chrono::milliseconds drainInterval(5);
+
+/* Binary log file: this magic, then tagged entries in native byte order */
+const char binaryMagic[8] = {'S', 'M', 'P', 'C', 'L', 'O', 'G', '1'};
+
+enum EntryTag : std::uint8_t {
+    KindEntry = 1u,   /* kind, name */
+    FormatEntry = 2u, /* format id, format */
+    SenderEntry = 3u, /* sender id, path */
+    RecordEntry = 4u  /* time, kind, sender id, format id, arguments */
+};
+
+/* Format of the records logged with Log, not available to LogFormat */
+const std::uint32_t messageFormat = 0u;
+
+enum class ArgumentKind : std::uint8_t {
+    Signed,
+    Unsigned,
+    Character,
+    Double,
+    String,
+    Pointer
+};
+
+enum class ArgumentLength : std::uint8_t {
+    Default,
+    Char,
+    Short,
+    Long,
+    LongLong,
+    Size,
+    IntMax,
+    PtrDiff
+};
+
+struct Argument {
+    ArgumentKind kind;
+    ArgumentLength length;
+    /* Conversion given to snprintf when decoding, integers widened to long long */
+    std::string conversion;
+};
+
+struct Format {
+    std::string text;
+    /* Text around the arguments, one more than the arguments */
+    std::vector<std::string> literals;
+    std::vector<Argument> arguments;
+};
+
+Format ParseFormat(const std::string &text) {
+    Format format;
+    format.text = text;
+    std::string literal;
+    std::size_t i = 0u;
+    while (i < text.size()) {
+        if (text[i] != '%') {
+            literal += text[i++];
+            continue;
+        }
+        if (i + 1u < text.size() && text[i + 1u] == '%') {
+            literal += '%';
+            i += 2u;
+            continue;
+        }
+        const std::size_t start = i++;
+        while (i < text.size() && std::strchr("-+ #0", text[i]) != nullptr) {
+            ++i;
+        }
+        while (i < text.size() && std::isdigit(static_cast<unsigned char>(text[i]))) {
+            ++i;
+        }
+        if (i < text.size() && text[i] == '.') {
+            ++i;
+            while (i < text.size() && std::isdigit(static_cast<unsigned char>(text[i]))) {
+                ++i;
+            }
+        }
+        Argument argument;
+        argument.conversion = text.substr(start, i - start);
+        argument.length = ArgumentLength::Default;
+        if (text.compare(i, 2u, "hh") == 0) {
+            argument.length = ArgumentLength::Char;
+            i += 2u;
+        } else if (text.compare(i, 2u, "ll") == 0) {
+            argument.length = ArgumentLength::LongLong;
+            i += 2u;
+        } else if (i < text.size()) {
+            switch (text[i]) {
+                case 'h': argument.length = ArgumentLength::Short; ++i; break;
+                case 'l': argument.length = ArgumentLength::Long; ++i; break;
+                case 'z': argument.length = ArgumentLength::Size; ++i; break;
+                case 'j': argument.length = ArgumentLength::IntMax; ++i; break;
+                case 't': argument.length = ArgumentLength::PtrDiff; ++i; break;
+                default: break;
+            }
+        }
+        if (i >= text.size()) {
+            throw std::invalid_argument("Incomplete conversion at the end of log format \"" + text + "\"");
+        }
+        const char conversion = text[i++];
+        switch (conversion) {
+            case 'd':
+            case 'i':
+                argument.kind = ArgumentKind::Signed;
+                argument.conversion += "ll";
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                argument.kind = ArgumentKind::Unsigned;
+                argument.conversion += "ll";
+                break;
+            case 'c':
+                argument.kind = ArgumentKind::Character;
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                argument.kind = ArgumentKind::Double;
+                break;
+            case 's':
+                argument.kind = ArgumentKind::String;
+                break;
+            case 'p':
+                argument.kind = ArgumentKind::Pointer;
+                break;
+            default:
+                throw std::invalid_argument(
+                    std::string("Unsupported conversion %") + conversion + " in log format \"" + text + "\"");
+        }
+        if (argument.kind != ArgumentKind::Signed && argument.kind != ArgumentKind::Unsigned
+            && argument.length != ArgumentLength::Default
+            && !(argument.kind == ArgumentKind::Double && argument.length == ArgumentLength::Long)) {
+            throw std::invalid_argument("Unsupported length modifier in log format \"" + text + "\"");
+        }
+        argument.conversion += conversion;
+        format.literals.push_back(literal);
+        format.arguments.push_back(argument);
+        literal.clear();
+    }
+    format.literals.push_back(literal);
+    return format;
+}
+
+template <typename T>
+void AppendValue(std::string &buffer, T value) {
+    buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void AppendString(std::string &buffer, const char *value, std::size_t length) {
+    AppendValue(buffer, static_cast<std::uint32_t>(length));
+    buffer.append(value, length);
+}
+
+void AppendString(std::string &buffer, const char *value) {
+    if (value == nullptr) {
+        value = "(null)";
+    }
+    AppendString(buffer, value, std::strlen(value));
+}
+
+/* Copies the raw arguments of a LogFormat call, no formatting happens here */
+void EncodeArguments(const Format &format, va_list arguments, std::string &buffer) {
+    for (const Argument &argument : format.arguments) {
+        switch (argument.kind) {
+            case ArgumentKind::Signed: {
+                long long value;
+                switch (argument.length) {
+                    case ArgumentLength::Char: value = static_cast<signed char>(va_arg(arguments, int)); break;
+                    case ArgumentLength::Short: value = static_cast<short>(va_arg(arguments, int)); break;
+                    case ArgumentLength::Long: value = va_arg(arguments, long); break;
+                    case ArgumentLength::LongLong: value = va_arg(arguments, long long); break;
+                    case ArgumentLength::Size: value = va_arg(arguments, std::ptrdiff_t); break;
+                    case ArgumentLength::IntMax: value = va_arg(arguments, std::intmax_t); break;
+                    case ArgumentLength::PtrDiff: value = va_arg(arguments, std::ptrdiff_t); break;
+                    default: value = va_arg(arguments, int); break;
+                }
+                AppendValue(buffer, value);
+                break;
+            }
+            case ArgumentKind::Unsigned: {
+                unsigned long long value;
+                switch (argument.length) {
+                    case ArgumentLength::Char: value = static_cast<unsigned char>(va_arg(arguments, unsigned int)); break;
+                    case ArgumentLength::Short: value = static_cast<unsigned short>(va_arg(arguments, unsigned int)); break;
+                    case ArgumentLength::Long: value = va_arg(arguments, unsigned long); break;
+                    case ArgumentLength::LongLong: value = va_arg(arguments, unsigned long long); break;
+                    case ArgumentLength::Size: value = va_arg(arguments, std::size_t); break;
+                    case ArgumentLength::IntMax: value = va_arg(arguments, std::uintmax_t); break;
+                    case ArgumentLength::PtrDiff: value = static_cast<std::size_t>(va_arg(arguments, std::ptrdiff_t)); break;
+                    default: value = va_arg(arguments, unsigned int); break;
+                }
+                AppendValue(buffer, value);
+                break;
+            }
+            case ArgumentKind::Character:
+                AppendValue(buffer, static_cast<long long>(va_arg(arguments, int)));
+                break;
+            case ArgumentKind::Double:
+                AppendValue(buffer, va_arg(arguments, double));
+                break;
+            case ArgumentKind::String:
+                AppendString(buffer, va_arg(arguments, const char *));
+                break;
+            case ArgumentKind::Pointer:
+                AppendValue(buffer, static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(va_arg(arguments, void *))));
+                break;
+        }
+    }
+}
+
+/* Reads the entries of a binary log, throws std::runtime_error past the end */
+class EntryReader {
+public:
+    EntryReader(const char *data, std::size_t size) :
+        data(data),
+        size(size) {
+    }
+
+    bool AtEnd() const {
+        return offset == size;
+    }
+
+    template <typename T>
+    T Read() {
+        T value;
+        std::memcpy(&value, Take(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    std::string ReadString() {
+        const std::uint32_t length = Read<std::uint32_t>();
+        return std::string(Take(length), length);
+    }
+
+    const char *Take(std::size_t length) {
+        if (length > size - offset) {
+            throw std::runtime_error("Truncated binary log entry");
+        }
+        const char *taken = data + offset;
+        offset += length;
+        return taken;
+    }
+
+private:
+    const char *data;
+    std::size_t size;
+    std::size_t offset = 0u;
+};
+
+template <typename T>
+void AppendConversion(std::string &text, const std::string &conversion, T value) {
+    const int length = std::snprintf(nullptr, 0u, conversion.c_str(), value);
+    if (length <= 0) {
+        return;
+    }
+    const std::size_t at = text.size();
+    text.resize(at + static_cast<std::size_t>(length) + 1u);
+    std::snprintf(&text[at], static_cast<std::size_t>(length) + 1u, conversion.c_str(), value);
+    text.resize(at + static_cast<std::size_t>(length));
+}
+
+void AppendTime(std::string &text, Smp::Duration time) {
+    const unsigned long long magnitude = time < 0
+        ? 0ull - static_cast<unsigned long long>(time)
+        : static_cast<unsigned long long>(time);
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%s%llu.%09llu", time < 0 ? "-" : "",
+        magnitude / 1000000000ull, magnitude % 1000000000ull);
+    text += buffer;
+}
+
+/* Turns binary log entries into text lines, keeping the definitions seen so far */
+class LogDecoder {
+public:
+    /* Returns the number of records decoded */
+    std::uint64_t Decode(const char *data, std::size_t size, std::string &text) {
+        std::uint64_t count = 0u;
+        EntryReader reader(data, size);
+        while (!reader.AtEnd()) {
+            switch (reader.Read<std::uint8_t>()) {
+                case KindEntry: {
+                    const Smp::Services::LogMessageKind kind = reader.Read<Smp::Services::LogMessageKind>();
+                    kinds[kind] = reader.ReadString();
+                    break;
+                }
+                case FormatEntry: {
+                    const std::uint32_t format = reader.Read<std::uint32_t>();
+                    formats[format] = ParseFormat(reader.ReadString());
+                    break;
+                }
+                case SenderEntry: {
+                    const std::uint64_t sender = reader.Read<std::uint64_t>();
+                    senders[sender] = reader.ReadString();
+                    break;
+                }
+                case RecordEntry: {
+                    const Smp::Duration time = reader.Read<Smp::Duration>();
+                    const Smp::Services::LogMessageKind kind = reader.Read<Smp::Services::LogMessageKind>();
+                    const std::uint64_t sender = reader.Read<std::uint64_t>();
+                    const std::uint32_t format = reader.Read<std::uint32_t>();
+                    const std::uint32_t length = reader.Read<std::uint32_t>();
+                    AppendRecord(text, time, kind, sender, format, reader.Take(length), length);
+                    ++count;
+                    break;
+                }
+                default:
+                    throw std::runtime_error("Unknown binary log entry");
+            }
+        }
+        return count;
+    }
+
+private:
+    void AppendRecord(
+        std::string &text,
+        Smp::Duration time,
+        Smp::Services::LogMessageKind kind,
+        std::uint64_t sender,
+        std::uint32_t format,
+        const char *arguments,
+        std::size_t size
+    ) const {
+        text += '[';
+        const auto kindName = kinds.find(kind);
+        text += kindName != kinds.end() ? kindName->second : std::to_string(kind);
+        text += "] ";
+        AppendTime(text, time);
+        text += ' ';
+        const auto path = senders.find(sender);
+        if (path != senders.end()) {
+            text += path->second;
+        }
+        text += ": ";
+        const auto found = formats.find(format);
+        if (found == formats.end()) {
+            text += "<unknown format " + std::to_string(format) + ">\n";
+            return;
+        }
+        try {
+            AppendArguments(text, found->second, arguments, size);
+        } catch (const std::runtime_error &) {
+            text += "<truncated>";
+        }
+        text += '\n';
+    }
+
+    static void AppendArguments(std::string &text, const Format &format, const char *arguments, std::size_t size) {
+        EntryReader reader(arguments, size);
+        for (std::size_t i = 0u; i < format.arguments.size(); ++i) {
+            text += format.literals[i];
+            const Argument &argument = format.arguments[i];
+            switch (argument.kind) {
+                case ArgumentKind::Signed:
+                    AppendConversion(text, argument.conversion, reader.Read<long long>());
+                    break;
+                case ArgumentKind::Unsigned:
+                    AppendConversion(text, argument.conversion, reader.Read<unsigned long long>());
+                    break;
+                case ArgumentKind::Character:
+                    AppendConversion(text, argument.conversion, static_cast<int>(reader.Read<long long>()));
+                    break;
+                case ArgumentKind::Double:
+                    AppendConversion(text, argument.conversion, reader.Read<double>());
+                    break;
+                case ArgumentKind::String:
+                    AppendConversion(text, argument.conversion, reader.ReadString().c_str());
+                    break;
+                case ArgumentKind::Pointer:
+                    AppendConversion(text, argument.conversion,
+                        reinterpret_cast<void *>(static_cast<std::uintptr_t>(reader.Read<std::uint64_t>())));
+                    break;
+            }
+        }
+        text += format.literals.back();
+    }
+
+    std::unordered_map<Smp::Services::LogMessageKind, std::string> kinds;
+    std::unordered_map<std::uint32_t, Format> formats;
+    std::unordered_map<std::uint64_t, std::string> senders;
+};
+
+struct RecordHeader {
+    Smp::Duration time;
+    std::uint64_t sender;
+    Smp::Services::LogMessageKind kind;
+    std::uint32_t format;
+    std::uint32_t pathLength;
+    std::uint32_t argumentsLength;
+};
+
+/* Single producer (the owning thread), single consumer (the drain thread) */
+class Ring {
+public:
+    explicit Ring(std::size_t capacity) :
+        data(capacity),
+        mask(capacity - 1u) {
+    }
+
+    /* Producer side, returns false when the record does not fit */
+    bool Push(const RecordHeader &header, const char *path, const char *arguments) {
+        const std::uint64_t size = sizeof(header) + header.pathLength + header.argumentsLength;
+        const std::uint64_t position = tail.load(std::memory_order_relaxed);
+        if (position + size - cachedHead > data.size()) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (position + size - cachedHead > data.size()) {
+                return false;
+            }
+        }
+        CopyIn(position, &header, sizeof(header));
+        CopyIn(position + sizeof(header), path, header.pathLength);
+        CopyIn(position + sizeof(header) + header.pathLength, arguments, header.argumentsLength);
+        tail.store(position + size, std::memory_order_release);
+        return true;
+    }
+
+    /* Consumer side, calls record(header, path, arguments) for each pending record */
+    template <typename Function>
+    void Pop(std::string &scratch, Function record) {
+        std::uint64_t position = head.load(std::memory_order_relaxed);
+        const std::uint64_t end = tail.load(std::memory_order_acquire);
+        while (position < end) {
+            RecordHeader header;
+            CopyOut(position, &header, sizeof(header));
+            scratch.resize(header.pathLength + header.argumentsLength);
+            CopyOut(position + sizeof(header), &scratch[0], scratch.size());
+            record(header, scratch.data(), scratch.data() + header.pathLength);
+            position += sizeof(header) + scratch.size();
+        }
+        head.store(position, std::memory_order_release);
+    }
+
+    /* Producer side scratch: encoded arguments, sender path, senders already described */
+    std::string arguments;
+    std::string path;
+    std::unordered_set<std::uint64_t> senders;
+
+private:
+    void CopyIn(std::uint64_t position, const void *source, std::size_t size) {
+        if (size == 0u) {
+            return;
+        }
+        const std::size_t offset = static_cast<std::size_t>(position & mask);
+        const std::size_t first = std::min(size, data.size() - offset);
+        std::memcpy(&data[offset], source, first);
+        std::memcpy(&data[0], static_cast<const char *>(source) + first, size - first);
+    }
+
+    void CopyOut(std::uint64_t position, void *destination, std::size_t size) const {
+        if (size == 0u) {
+            return;
+        }
+        const std::size_t offset = static_cast<std::size_t>(position & mask);
+        const std::size_t first = std::min(size, data.size() - offset);
+        std::memcpy(destination, &data[offset], first);
+        std::memcpy(static_cast<char *>(destination) + first, &data[0], size - first);
+    }
+
+    std::vector<char> data;
+    const std::uint64_t mask;
+    alignas(64) std::atomic<std::uint64_t> head{0u};
+    alignas(64) std::atomic<std::uint64_t> tail{0u};
+    std::uint64_t cachedHead = 0u;
+};
+
+/* Rings of the calling thread, by logger instance; the last one used first */
+struct ThreadRing {
+    std::uint64_t logger;
+    std::shared_ptr<Ring> ring;
+};
+
+thread_local std::vector<ThreadRing> threadRings;
+
+std::atomic<std::uint64_t> nextInstance{1u};
+
+std::size_t RingCapacity(std::size_t requested) {
+    std::size_t capacity = minimumRingCapacity;
+    while (capacity < requested) {
+        capacity <<= 1u;
+    }
+    return capacity;
+}
+
+void AppendPath(std::string &path, const Smp::IObject *object) {
+    const Smp::IObject *parent = object->GetParent();
+    if (parent != nullptr) {
+        AppendPath(path, parent);
+        path += '/';
+    }
+    const Smp::String8 name = object->GetName();
+    if (name != nullptr) {
+        path += name;
+    }
+}
+
+class RingLogger final : public CWraPPer::ServiceBase<Smp::Services::ILogger> {
+public:
+    RingLogger(
+        Smp::String8 name,
+        Smp::String8 description,
+        Smp::IObject *parent,
+        Smp::String8 fileName,
+        std::size_t ringCapacity,
+        bool binary
+    ) :
+        ServiceBase(name, description, parent),
+        instance(nextInstance.fetch_add(1u)),
+        ringCapacity(RingCapacity(ringCapacity != 0u ? ringCapacity : defaultRingCapacity)),
+        binary(binary) {
+        file = std::fopen(fileName != nullptr ? fileName : "", binary ? "wb" : "w");
+        if (file == nullptr) {
+            throw std::runtime_error(
+                std::string("Cannot open log file ") + (fileName != nullptr ? fileName : ""));
+        }
+        if (binary) {
+            std::fwrite(binaryMagic, 1u, sizeof(binaryMagic), file);
+        }
+        for (const char *kind : standardKinds) {
+            kindIds.emplace(kind, static_cast<Smp::Services::LogMessageKind>(kindNames.size()));
+            kindNames.emplace_back(kind);
+        }
+        formats.emplace_back(new Format(ParseFormat("%s")));
+        drainThread = std::thread(&RingLogger::Drain, this);
+    }
+
+    ~RingLogger() override {
+        {
+            std::lock_guard<std::mutex> lock(drainMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        drainThread.join();
+        std::fclose(file);
+    }
+
+    void Connect(Smp::ISimulator *simulator) override {
+        ServiceBase::Connect(simulator);
+        timeKeeper.store(simulator != nullptr ? simulator->GetTimeKeeper() : nullptr);
+    }
+
+    void Disconnect() override {
+        timeKeeper.store(nullptr);
+        ServiceBase::Disconnect();
+    }
+
+    Smp::Services::LogMessageKind QueryLogMessageKind(Smp::String8 messageKindName) override {
+        const std::string kindName(messageKindName != nullptr ? messageKindName : "");
+        std::lock_guard<std::mutex> lock(kindsMutex);
+        const auto found = kindIds.find(kindName);
+        if (found != kindIds.end()) {
+            return found->second;
+        }
+        const Smp::Services::LogMessageKind kind = static_cast<Smp::Services::LogMessageKind>(kindNames.size());
+        kindIds.emplace(kindName, kind);
+        kindNames.push_back(kindName);
+        return kind;
+    }
+
+    void Log(const Smp::IObject *sender, Smp::String8 message, Smp::Services::LogMessageKind kind) override {
+        Ring &ring = OwnRing();
+        ring.arguments.clear();
+        AppendString(ring.arguments, message != nullptr ? message : "");
+        Push(ring, sender, kind, messageFormat);
+    }
+
+    std::uint32_t RegisterFormat(Smp::String8 text) {
+        std::unique_ptr<Format> format(new Format(ParseFormat(text != nullptr ? text : "")));
+        std::unique_lock<std::shared_mutex> lock(formatsMutex);
+        formats.push_back(std::move(format));
+        return static_cast<std::uint32_t>(formats.size() - 1u);
+    }
+
+    void LogFormat(
+        const Smp::IObject *sender,
+        Smp::Services::LogMessageKind kind,
+        std::uint32_t format,
+        va_list arguments
+    ) {
+        Ring &ring = OwnRing();
+        ring.arguments.clear();
+        {
+            std::shared_lock<std::shared_mutex> lock(formatsMutex);
+            if (format == messageFormat || format >= formats.size()) {
+                throw std::out_of_range("Log format " + std::to_string(format) + " is not registered");
+            }
+            EncodeArguments(*formats[format], arguments, ring.arguments);
+        }
+        Push(ring, sender, kind, format);
+    }
+
+    void Flush() {
+        std::unique_lock<std::mutex> lock(drainMutex);
+        const std::uint64_t request = ++flushRequested;
+        wake.notify_all();
+        flushed.wait(lock, [this, request] { return flushDone >= request; });
+    }
+
+    std::uint64_t GetDroppedCount() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    Ring &OwnRing() {
+        if (!threadRings.empty() && threadRings.back().logger == instance) {
+            return *threadRings.back().ring;
+        }
+        for (std::size_t i = 0u; i < threadRings.size(); ++i) {
+            if (threadRings[i].logger == instance) {
+                std::swap(threadRings[i], threadRings.back());
+                return *threadRings.back().ring;
+            }
+        }
+        /* First record of this thread: forget the rings of destroyed loggers, then register */
+        threadRings.erase(
+            std::remove_if(threadRings.begin(), threadRings.end(),
+                [](const ThreadRing &entry) { return entry.ring.use_count() == 1; }),
+            threadRings.end());
+        std::shared_ptr<Ring> ring = std::make_shared<Ring>(ringCapacity);
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            rings.push_back(ring);
+        }
+        threadRings.push_back({instance, ring});
+        return *ring;
+    }
+
+    /* The first record of a sender on each thread carries its path */
+    void Push(Ring &ring, const Smp::IObject *sender, Smp::Services::LogMessageKind kind, std::uint32_t format) {
+        RecordHeader header;
+        Smp::Services::ITimeKeeper *keeper = timeKeeper.load(std::memory_order_acquire);
+        header.time = keeper != nullptr ? keeper->GetSimulationTime() : 0;
+        header.sender = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(sender));
+        header.kind = kind;
+        header.format = format;
+        ring.path.clear();
+        const bool describe = sender != nullptr && ring.senders.insert(header.sender).second;
+        if (describe) {
+            AppendPath(ring.path, sender);
+        }
+        header.pathLength = static_cast<std::uint32_t>(ring.path.size());
+        header.argumentsLength = static_cast<std::uint32_t>(ring.arguments.size());
+        if (!ring.Push(header, ring.path.data(), ring.arguments.data())) {
+            if (describe) {
+                ring.senders.erase(header.sender);
+            }
+            dropped.fetch_add(1u, std::memory_order_relaxed);
+        }
+    }
+
+    void Drain() {
+        std::unique_lock<std::mutex> lock(drainMutex);
+        for (;;) {
+            wake.wait_for(lock, drainInterval, [this] { return stopping || flushDone != flushRequested; });
+            const std::uint64_t request = flushRequested;
+            const bool stop = stopping;
+            lock.unlock();
+            WriteRecords();
+            lock.lock();
+            flushDone = request;
+            flushed.notify_all();
+            if (stop) {
+                return;
+            }
+        }
+    }
+
+    /*
+     * Records are read before the definitions, which then cover every kind
+     * and format they use. A ring only held here belongs to a thread that
+     * has exited: it is dropped once read, its thread can no longer fill it.
+     */
+    void WriteRecords() {
+        records.clear();
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            for (std::size_t i = 0u; i < rings.size();) {
+                const std::shared_ptr<Ring> &ring = rings[i];
+                const bool orphan = ring.use_count() == 1;
+                /* Pairs with the release of the thread's reference: its last records are visible */
+                std::atomic_thread_fence(std::memory_order_acquire);
+                ring->Pop(scratch, [this](const RecordHeader &header, const char *path, const char *arguments) {
+                    if (header.pathLength != 0u) {
+                        AppendValue(records, SenderEntry);
+                        AppendValue(records, header.sender);
+                        AppendString(records, path, header.pathLength);
+                    }
+                    AppendValue(records, RecordEntry);
+                    AppendValue(records, header.time);
+                    AppendValue(records, header.kind);
+                    AppendValue(records, header.sender);
+                    AppendValue(records, header.format);
+                    AppendString(records, arguments, header.argumentsLength);
+                });
+                if (orphan) {
+                    rings[i] = std::move(rings.back());
+                    rings.pop_back();
+                } else {
+                    ++i;
+                }
+            }
+        }
+        definitions.clear();
+        {
+            std::lock_guard<std::mutex> lock(kindsMutex);
+            for (; writtenKinds < kindNames.size(); ++writtenKinds) {
+                AppendValue(definitions, KindEntry);
+                AppendValue(definitions, static_cast<Smp::Services::LogMessageKind>(writtenKinds));
+                AppendString(definitions, kindNames[writtenKinds].data(), kindNames[writtenKinds].size());
+            }
+        }
+        {
+            std::shared_lock<std::shared_mutex> lock(formatsMutex);
+            for (; writtenFormats < formats.size(); ++writtenFormats) {
+                AppendValue(definitions, FormatEntry);
+                AppendValue(definitions, static_cast<std::uint32_t>(writtenFormats));
+                AppendString(definitions, formats[writtenFormats]->text.data(), formats[writtenFormats]->text.size());
+            }
+        }
+        if (binary) {
+            Write(definitions);
+            Write(records);
+        } else {
+            text.clear();
+            decoder.Decode(definitions.data(), definitions.size(), text);
+            decoder.Decode(records.data(), records.size(), text);
+            Write(text);
+        }
+    }
+
+    void Write(const std::string &buffer) {
+        if (!buffer.empty()) {
+            std::fwrite(buffer.data(), 1u, buffer.size(), file);
+            std::fflush(file);
+        }
+    }
+
+    const std::uint64_t instance;
+    const std::size_t ringCapacity;
+    const bool binary;
+    std::FILE *file = nullptr;
+    std::atomic<Smp::Services::ITimeKeeper *> timeKeeper{nullptr};
+    std::atomic<std::uint64_t> dropped{0u};
+
+    std::mutex kindsMutex;
+    std::unordered_map<std::string, Smp::Services::LogMessageKind> kindIds;
+    std::vector<std::string> kindNames;
+
+    std::shared_mutex formatsMutex;
+    std::vector<std::unique_ptr<Format>> formats;
+
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+
+    /* Owned by the drain thread */
+    std::string records;
+    std::string definitions;
+    std::string text;
+    std::string scratch;
+    std::size_t writtenKinds = 0u;
+    std::size_t writtenFormats = 0u;
+    LogDecoder decoder;
+
+    std::mutex drainMutex;
+    std::condition_variable wake;
+    std::condition_variable flushed;
+    std::uint64_t flushRequested = 0u;
+    std::uint64_t flushDone = 0u;
+    bool stopping = false;
+    std::thread drainThread;
+};
+
+std::uint64_t DecodeFile(Smp::String8 logFileName, Smp::String8 textFileName) {
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> input(
+        std::fopen(logFileName != nullptr ? logFileName : "", "rb"), &std::fclose);
+    if (!input) {
+        throw std::runtime_error(std::string("Cannot open log file ") + (logFileName != nullptr ? logFileName : ""));
+    }
+    std::string data;
+    char buffer[65536];
+    std::size_t read;
+    while ((read = std::fread(buffer, 1u, sizeof(buffer), input.get())) != 0u) {
+        data.append(buffer, read);
+    }
+    if (data.compare(0u, sizeof(binaryMagic), binaryMagic, sizeof(binaryMagic)) != 0) {
+        throw std::runtime_error(std::string("Not a binary log file: ") + logFileName);
+    }
+    std::string text;
+    LogDecoder decoder;
+    const std::uint64_t count = decoder.Decode(
+        data.data() + sizeof(binaryMagic), data.size() - sizeof(binaryMagic), text);
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> output(
+        std::fopen(textFileName != nullptr ? textFileName : "", "w"), &std::fclose);
+    if (!output) {
+        throw std::runtime_error(std::string("Cannot open text file ") + (textFileName != nullptr ? textFileName : ""));
+    }
+    if (std::fwrite(text.data(), 1u, text.size(), output.get()) != text.size()) {
+        throw std::runtime_error(std::string("Cannot write text file ") + textFileName);
+    }
+    return count;
+}
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::RingLogger ### */
+#define CW_SPACE CW_root_Smp_Services_RingLogger
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, IObject) * parent,
+    CW(CW_root_Smp, String8) fileName,
+    CW(CW_root_Smp, UInt64) ringCapacity,
+    CW(CW_root_Smp, Bool) binary
+) {
+    try {
+        return new RingLogger(
+            static_cast<Smp::String8>(name),
+            static_cast<Smp::String8>(description),
+            static_cast<Smp::IObject *>(parent),
+            static_cast<Smp::String8>(fileName),
+            static_cast<std::size_t>(ringCapacity),
+            static_cast<bool>(binary)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<RingLogger *>(self);
+}
+
+CW(CW_root_Smp_Services, ILogger) *
+CW(GetLogger)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp_Services, ILogger) *>(
+    static_cast<Smp::Services::ILogger *>(static_cast<RingLogger *>(self)));
+}
+
+CW(CW_root_Smp, IService) *
+CW(GetService)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IService) *>(
+    static_cast<Smp::IService *>(static_cast<RingLogger *>(self)));
+}
+
+CW(CW_root_Smp, UInt32)
+CW(RegisterFormat)
+(
+    CW() * self,
+    CW(CW_root_Smp, String8) format
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt32)>(
+        static_cast<RingLogger *>(self)->RegisterFormat(
+            static_cast<Smp::String8>(format)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(LogFormat)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IObject) * sender,
+    CW(CW_root_Smp_Services, LogMessageKind) kind,
+    CW(CW_root_Smp, UInt32) format,
+    ...
+) {
+    va_list arguments;
+    va_start(arguments, format);
+    CW(LogFormatList)(self, sender, kind, format, arguments);
+    va_end(arguments);
+}
+
+void
+CW(LogFormatList)
+(
+    CW() * self,
+    const CW(CW_root_Smp, IObject) * sender,
+    CW(CW_root_Smp_Services, LogMessageKind) kind,
+    CW(CW_root_Smp, UInt32) format,
+    va_list arguments
+) {
+    try {
+        static_cast<RingLogger *>(self)->LogFormat(
+            static_cast<const Smp::IObject *>(sender),
+            static_cast<Smp::Services::LogMessageKind>(kind),
+            static_cast<std::uint32_t>(format),
+            arguments
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+void
+CW(Flush)
+(
+    CW() * self
+) {
+    try {
+        static_cast<RingLogger *>(self)->Flush(
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetDroppedCount)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const RingLogger *>(self)->GetDroppedCount(
+    ));
+}
+
+CW(CW_root_Smp, UInt64)
+CW(Decode)
+(
+    CW(CW_root_Smp, String8) logFileName,
+    CW(CW_root_Smp, String8) textFileName
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        DecodeFile(
+            static_cast<Smp::String8>(logFileName),
+            static_cast<Smp::String8>(textFileName)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,146 @@
+/**
+ * Concrete base for the SMP services implemented in this library.
+ *
+ * Implements IObject and IComponent for a service without fields nor
+ * children: the component state follows Publish, Configure, Connect and
+ * Disconnect, and the simulator given to Connect is kept for the derived
+ * service.
+ */
+#ifndef CWRAPPER_SERVICEBASE_H
+#define CWRAPPER_SERVICEBASE_H
+
+#include <Smp/FieldCollection.h>
+#include <Smp/IComponent.h>
+#include <Smp/ISimulator.h>
+#include <Smp/Uuid.h>
+#include <string>
+
+namespace CWraPPer {
+
+template <typename T>
+class EmptyCollection final : public Smp::ICollection<T> {
+public:
+    T *at(Smp::String8) const override {
+        return nullptr;
+    }
+
+    T *at(std::size_t) const override {
+        return nullptr;
+    }
+
+    std::size_t size() const override {
+        return 0u;
+    }
+
+    bool empty() const override {
+        return true;
+    }
+
+    typename Smp::ICollection<T>::const_iterator begin() const override {
+        return typename Smp::ICollection<T>::const_iterator(*this, 0u);
+    }
+
+    typename Smp::ICollection<T>::const_iterator end() const override {
+        return typename Smp::ICollection<T>::const_iterator(*this, 0u);
+    }
+};
+
+template <typename Interface>
+class ServiceBase : public Interface {
+public:
+    ServiceBase(Smp::String8 name, Smp::String8 description, Smp::IObject *parent) :
+        name(name != nullptr ? name : ""),
+        description(description != nullptr ? description : ""),
+        parent(parent) {
+    }
+
+    Smp::String8 GetName() const override {
+        return name.c_str();
+    }
+
+    Smp::String8 GetDescription() const override {
+        return description.c_str();
+    }
+
+    Smp::IObject *GetParent() const override {
+        return parent;
+    }
+
+    Smp::IObject *GetChild(Smp::String8) const override {
+        return nullptr;
+    }
+
+    Smp::ComponentStateKind GetState() const override {
+        return state;
+    }
+
+    void Publish(Smp::IPublication *) override {
+        state = Smp::ComponentStateKind::CSK_Publishing;
+    }
+
+    void Configure(Smp::Services::ILogger *, Smp::Services::ILinkRegistry *) override {
+        state = Smp::ComponentStateKind::CSK_Configured;
+    }
+
+    void Connect(Smp::ISimulator *simulator) override {
+        this->simulator = simulator;
+        state = Smp::ComponentStateKind::CSK_Connected;
+    }
+
+    void Disconnect() override {
+        simulator = nullptr;
+        state = Smp::ComponentStateKind::CSK_Disconnected;
+    }
+
+    Smp::IField *GetField(Smp::String8) const override {
+        return nullptr;
+    }
+
+    const Smp::FieldCollection *GetFields() const override {
+        return &fields;
+    }
+
+    const Smp::Uuid &GetUuid() const override {
+        return uuid;
+    }
+
+    Smp::AnySimple GetSimpleValue(Smp::String8) const override {
+        return Smp::AnySimple();
+    }
+
+    void SetSimpleValue(Smp::String8, const Smp::AnySimple &) override {
+    }
+
+    void GetSimpleArrayValue(Smp::String8, Smp::UInt64, Smp::AnySimple *, Smp::UInt64) const override {
+    }
+
+    void SetSimpleArrayValue(Smp::String8, Smp::UInt64, const Smp::AnySimpleArray, Smp::UInt64) override {
+    }
+
+    Smp::Bool AddChild(Smp::IObject *, const Smp::ICollectionBase *) override {
+        return false;
+    }
+
+    Smp::Bool RemoveChild(Smp::IObject *, const Smp::ICollectionBase *) override {
+        return false;
+    }
+
+    Smp::IObject *IsChildInCollection(Smp::String8, const Smp::ICollectionBase *) const override {
+        return nullptr;
+    }
+
+protected:
+    Smp::ISimulator *simulator = nullptr;
+
+private:
+    std::string name;
+    std::string description;
+    Smp::IObject *parent;
+    Smp::ComponentStateKind state = Smp::ComponentStateKind::CSK_Created;
+    EmptyCollection<Smp::IField> fields;
+    Smp::Uuid uuid;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_SERVICEBASE_H */
@@ -0,0 +1,83 @@
+/**
+ * Concrete bases for the storage writers and readers implemented in this
+ * library.
+ *
+ * Keep the directory and the name of the state vector file for
+ * GetStateVectorFilePath and GetStateVectorFileName, and provide the
+ * CannotStore and CannotRestore exceptions they throw.
+ */
+#ifndef CWRAPPER_STORAGEBASE_H
+#define CWRAPPER_STORAGEBASE_H
+
+#include "ExceptionBase.h"
+#include <Smp/CannotRestore.h>
+#include <Smp/CannotStore.h>
+#include <Smp/IStorageReader.h>
+#include <Smp/IStorageWriter.h>
+#include <string>
+#include <utility>
+
+namespace CWraPPer {
+
+class StorageCannotStore final : public ExceptionBase<Smp::CannotStore> {
+public:
+    explicit StorageCannotStore(std::string message) :
+        ExceptionBase(
+            "CannotStore",
+            "Cannot store the state vector",
+            std::move(message),
+            nullptr
+        ) {
+    }
+};
+
+class StorageCannotRestore final : public ExceptionBase<Smp::CannotRestore> {
+public:
+    explicit StorageCannotRestore(std::string message) :
+        ExceptionBase(
+            "CannotRestore",
+            "Cannot restore the state vector",
+            std::move(message),
+            nullptr
+        ) {
+    }
+};
+
+/* Full name of the state vector file, the path being a directory */
+inline std::string StorageFileName(Smp::String8 path, Smp::String8 fileName) {
+    std::string fullName(path != nullptr ? path : "");
+    if (!fullName.empty() && fullName.back() != '/') {
+        fullName += '/';
+    }
+    return fullName + (fileName != nullptr ? fileName : "");
+}
+
+template <typename Interface>
+class StorageBase : public Interface {
+public:
+    StorageBase(Smp::String8 path, Smp::String8 fileName) :
+        path(path != nullptr ? path : ""),
+        fileName(fileName != nullptr ? fileName : "") {
+    }
+
+    Smp::String8 GetStateVectorFileName() const override {
+        return fileName.c_str();
+    }
+
+    Smp::String8 GetStateVectorFilePath() const override {
+        return path.c_str();
+    }
+
+protected:
+    std::string FullName() const {
+        return StorageFileName(path.c_str(), fileName.c_str());
+    }
+
+private:
+    std::string path;
+    std::string fileName;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_STORAGEBASE_H */
@@ -0,0 +1,967 @@
+/**
+ * Scheduler service built on a hierarchical timing wheel.
+ */
+#include "Smp-C/Services/TimingWheelScheduler.h"
+#include "Smp-C/Services/BatchScheduler.h"
+#include "ExceptionCatch.h"
+#include "ExceptionBase.h"
+#include "ServiceBase.h"
+#include "WorkStealingPool.h"
+#include <Smp/IEntryPoint.h>
+#include <Smp/ISimulator.h>
+#include <Smp/Services/IScheduler.h>
+#include <Smp/Services/ITimeKeeper.h>
+#include <Smp/Services/InvalidCycleTime.h>
+#include <Smp/Services/InvalidEventId.h>
+#include <Smp/Services/InvalidEventTime.h>
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+class SchedulerInvalidEventId final : public CWraPPer::ExceptionBase<Smp::Services::InvalidEventId> {
+public:
+    SchedulerInvalidEventId(const Smp::IObject *sender, Smp::Services::EventId eventId) :
+        ExceptionBase(
+            "InvalidEventId",
+            "Event id not known by the scheduler",
+            "Event " + std::to_string(eventId) + " is not scheduled",
+            sender
+        ),
+        eventId(eventId) {
+    }
+
+    Smp::Services::EventId GetInvalidEventId() const noexcept override {
+        return eventId;
+    }
+
+private:
+    Smp::Services::EventId eventId;
+};
+
+class SchedulerInvalidEventTime final : public CWraPPer::ExceptionBase<Smp::Services::InvalidEventTime> {
+public:
+    SchedulerInvalidEventTime(const Smp::IObject *sender, Smp::Duration time, Smp::Duration currentTime) :
+        ExceptionBase(
+            "InvalidEventTime",
+            "Event time before the current simulation time",
+            "Event time " + std::to_string(time) + " is before the current simulation time "
+                + std::to_string(currentTime),
+            sender
+        ) {
+    }
+};
+
+class SchedulerInvalidCycleTime final : public CWraPPer::ExceptionBase<Smp::Services::InvalidCycleTime> {
+public:
+    SchedulerInvalidCycleTime(const Smp::IObject *sender, Smp::Duration cycleTime) :
+        ExceptionBase(
+            "InvalidCycleTime",
+            "Cycle time not positive for a repeated event",
+            "Cycle time " + std::to_string(cycleTime) + " is not valid for a repeated event",
+            sender
+        ) {
+    }
+};
+
+/* Event run by the calling thread, so that each worker sees its own */
+struct CurrentEvent {
+    const void *scheduler;
+    Smp::Services::EventId eventId;
+};
+
+thread_local CurrentEvent currentEvent = {nullptr, -1};
+
+class CurrentEventScope {
+public:
+    CurrentEventScope(const void *scheduler, Smp::Services::EventId eventId) : previous(currentEvent) {
+        currentEvent = {scheduler, eventId};
+    }
+
+    ~CurrentEventScope() {
+        currentEvent = previous;
+    }
+
+private:
+    CurrentEvent previous;
+};
+
+class TimingWheelScheduler final :
+    public CWraPPer::ServiceBase<Smp::Services::IScheduler>,
+    public CWraPPer::BatchScheduler {
+public:
+    TimingWheelScheduler(
+        Smp::String8 name,
+        Smp::String8 description,
+        Smp::IObject *parent,
+        Smp::Duration resolution
+    ) :
+        ServiceBase(name, description, parent),
+        resolution(resolution > 0 ? resolution : 1000000) {
+    }
+
+    void Connect(Smp::ISimulator *simulator) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        ServiceBase::Connect(simulator);
+        timeKeeper = simulator != nullptr ? simulator->GetTimeKeeper() : nullptr;
+        if (timeKeeper != nullptr && scheduledCount == 0u) {
+            currentTime = std::max<Smp::Duration>(timeKeeper->GetSimulationTime(), 0);
+            currentTick = Tick(currentTime);
+            syncedTime = currentTime;
+        }
+    }
+
+    void Disconnect() override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        timeKeeper = nullptr;
+        ServiceBase::Disconnect();
+    }
+
+    Smp::Services::EventId AddImmediateEvent(const Smp::IEntryPoint *entryPoint) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        const std::uint32_t index = Allocate(entryPoint, currentTime, 0, 0);
+        events[index].state = Immediate;
+        Link(index, ImmediateList);
+        return Id(index);
+    }
+
+    Smp::Services::EventId AddSimulationTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration simulationTime,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    ) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        return Schedule(entryPoint, Relative(simulationTime), cycleTime, repeat);
+    }
+
+    /* One lock for the whole batch, and the slab grown once when it has no free entry to recycle */
+    void AddSimulationTimeEvents(
+        Smp::UInt64 count,
+        const CW(CW_root_Smp_Services, SimulationTimeEvent) * batch,
+        CW(CW_root_Smp_Services, EventId) * eventIds,
+        Smp::UInt64 &added
+    ) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        if (freeHead == None) {
+            events.reserve(events.size() + static_cast<std::size_t>(count));
+        }
+        for (; added < count; ++added) {
+            const CW(CW_root_Smp_Services, SimulationTimeEvent) &event = batch[added];
+            eventIds[added] = static_cast<CW(CW_root_Smp_Services, EventId)>(Schedule(
+                static_cast<const Smp::IEntryPoint *>(event.entryPoint),
+                Relative(static_cast<Smp::Duration>(event.simulationTime)),
+                static_cast<Smp::Duration>(event.cycleTime),
+                static_cast<Smp::Int64>(event.repeat)
+            ));
+        }
+    }
+
+    Smp::Services::EventId AddMissionTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration missionTime,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    ) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        return Schedule(entryPoint, FromMissionTime(missionTime), cycleTime, repeat);
+    }
+
+    Smp::Services::EventId AddEpochTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::DateTime epochTime,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    ) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        return Schedule(entryPoint, FromEpochTime(epochTime), cycleTime, repeat);
+    }
+
+    Smp::Services::EventId AddZuluTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::DateTime zuluTime,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    ) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        return Schedule(entryPoint, FromZuluTime(zuluTime), cycleTime, repeat);
+    }
+
+    Smp::Services::EventId AddRelativeZuluTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration zuluTimeDelay,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    ) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        return Schedule(entryPoint, Relative(zuluTimeDelay), cycleTime, repeat);
+    }
+
+    void SetEventSimulationTime(Smp::Services::EventId event, Smp::Duration simulationTime) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        Move(Lookup(event), simulationTime);
+    }
+
+    void SetEventMissionTime(Smp::Services::EventId event, Smp::Duration missionTime) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        Move(Lookup(event), FromMissionTime(missionTime));
+    }
+
+    void SetEventEpochTime(Smp::Services::EventId event, Smp::DateTime epochTime) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        Move(Lookup(event), FromEpochTime(epochTime));
+    }
+
+    void SetEventZuluTime(Smp::Services::EventId event, Smp::DateTime zuluTime) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        Move(Lookup(event), FromZuluTime(zuluTime));
+    }
+
+    void SetEventCycleTime(Smp::Services::EventId event, Smp::Duration cycleTime) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        Event &entry = events[Lookup(event)];
+        CheckCycle(cycleTime, entry.repeat);
+        entry.cycle = cycleTime;
+    }
+
+    void SetEventRepeat(Smp::Services::EventId event, Smp::Int64 repeat) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        Event &entry = events[Lookup(event)];
+        CheckCycle(entry.cycle, repeat);
+        entry.repeat = repeat;
+    }
+
+    void RemoveEvent(Smp::Services::EventId event) override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        const std::uint32_t index = Lookup(event);
+        if (events[index].state == Running) {
+            /* Freed once its entry point returns */
+            events[index].state = Removed;
+            return;
+        }
+        Unlink(index);
+        Free(index);
+    }
+
+    Smp::Services::EventId GetCurrentEventId() const override {
+        return currentEvent.scheduler == this ? currentEvent.eventId : -1;
+    }
+
+    Smp::Duration GetNextScheduledEventTime() const override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        if (lists[ImmediateList].head != None) {
+            return currentTime;
+        }
+        Smp::Duration next = -1;
+        for (unsigned level = 0u; level < Levels; ++level) {
+            const unsigned position = Digit(currentTick, level);
+            /* Level 0 starts at the current tick, upper levels at the next block */
+            const unsigned first = level == 0u ? position : position + 1u;
+            int slot = FindSlot(level, first, SlotCount);
+            if (slot < 0) {
+                slot = FindSlot(level, 0u, std::min(first, SlotCount));
+            }
+            if (slot >= 0) {
+                next = Earliest(lists[level * SlotCount + static_cast<unsigned>(slot)], next);
+            }
+        }
+        return Earliest(lists[OverflowList], next);
+    }
+
+    Smp::Bool IsEventScheduled(Smp::Services::EventId event) const override {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        return Find(event) != None;
+    }
+
+    Smp::Duration GetSimulationTime() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        return currentTime;
+    }
+
+    void SetWorkerCount(std::size_t workerCount) {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        if (poolRunning) {
+            throw std::logic_error("SetWorkerCount called while events run on the worker pool");
+        }
+        pool.reset();
+        if (workerCount > 0u) {
+            pool.reset(new CWraPPer::WorkStealingPool(workerCount));
+        }
+    }
+
+    void SetEventIndependent(Smp::Services::EventId event, bool independent) {
+        std::lock_guard<std::recursive_mutex> lock(mutex);
+        events[Lookup(event)].independent = independent;
+    }
+
+    std::uint64_t Advance(Smp::Duration simulationTime) {
+        std::unique_lock<std::recursive_mutex> lock(mutex);
+        if (simulationTime < currentTime) {
+            throw SchedulerInvalidEventTime(this, simulationTime, currentTime);
+        }
+        std::uint64_t executed = RunImmediate();
+        const std::uint64_t lastTick = Tick(simulationTime);
+        std::vector<std::uint32_t> due;
+        while (NextTick(lastTick)) {
+            Detach(lists[Digit(currentTick, 0u)], due);
+            std::sort(due.begin(), due.end(), [this](std::uint32_t left, std::uint32_t right) {
+                const Event &a = events[left];
+                const Event &b = events[right];
+                return a.time != b.time ? a.time < b.time : a.sequence < b.sequence;
+            });
+            std::size_t ran = 0u;
+            for (std::size_t i = 0u; i < due.size(); ++i) {
+                const std::uint32_t index = due[i];
+                if (!IsDue(index)) {
+                    continue;
+                }
+                if (events[index].time > simulationTime) {
+                    Insert(index);
+                    continue;
+                }
+                try {
+                    const std::size_t group = IndependentGroup(due, i);
+                    if (group > 1u) {
+                        ExecuteParallel(due, i, group, lock);
+                        i += group - 1u;
+                    } else {
+                        Execute(index);
+                    }
+                    executed += group + RunImmediate();
+                    ran += group;
+                } catch (...) {
+                    Relink(due, i + 1u);
+                    throw;
+                }
+            }
+            if (ran == 0u) {
+                break;
+            }
+        }
+        currentTime = simulationTime;
+        SyncTimeKeeper();
+        return executed;
+    }
+
+private:
+    static constexpr std::uint32_t None = 0xFFFFFFFFu;
+    static constexpr unsigned Levels = 4u;
+    static constexpr unsigned SlotBits = 8u;
+    static constexpr unsigned SlotCount = 1u << SlotBits;
+    static constexpr unsigned OverflowList = Levels * SlotCount;
+    static constexpr unsigned ImmediateList = OverflowList + 1u;
+    static constexpr unsigned ListCount = ImmediateList + 1u;
+    static constexpr std::uint16_t NoList = 0xFFFFu;
+
+    enum State : std::uint8_t {
+        Unused,
+        Scheduled,
+        Immediate,
+        Running,
+        Removed
+    };
+
+    struct Event {
+        const Smp::IEntryPoint *entryPoint = nullptr;
+        Smp::Duration time = 0;
+        Smp::Duration cycle = 0;
+        Smp::Int64 repeat = 0;
+        std::uint64_t sequence = 0u;
+        std::uint32_t generation = 1u;
+        std::uint32_t next = None;
+        std::uint32_t previous = None;
+        std::uint16_t list = NoList;
+        std::uint8_t state = Unused;
+        bool moved = false;
+        bool independent = false;
+    };
+
+    struct List {
+        std::uint32_t head = None;
+        std::uint32_t tail = None;
+    };
+
+    static unsigned Digit(std::uint64_t tick, unsigned level) {
+        return static_cast<unsigned>(tick >> (SlotBits * level)) & (SlotCount - 1u);
+    }
+
+    std::uint64_t Tick(Smp::Duration time) const {
+        return static_cast<std::uint64_t>(time / resolution);
+    }
+
+    Smp::Services::EventId Id(std::uint32_t index) const {
+        return static_cast<Smp::Services::EventId>(
+            (static_cast<std::uint64_t>(events[index].generation) << 32) | index
+        );
+    }
+
+    std::uint32_t Find(Smp::Services::EventId event) const {
+        if (event < 0) {
+            return None;
+        }
+        const std::uint32_t index = static_cast<std::uint32_t>(event & 0xFFFFFFFF);
+        const std::uint32_t generation = static_cast<std::uint32_t>(event >> 32);
+        if (index >= events.size() || events[index].generation != generation
+            || events[index].state == Unused || events[index].state == Removed) {
+            return None;
+        }
+        return index;
+    }
+
+    std::uint32_t Lookup(Smp::Services::EventId event) const {
+        const std::uint32_t index = Find(event);
+        if (index == None) {
+            throw SchedulerInvalidEventId(this, event);
+        }
+        return index;
+    }
+
+    Smp::Duration Relative(Smp::Duration delay) const {
+        if (delay < 0) {
+            throw SchedulerInvalidEventTime(this, currentTime + delay, currentTime);
+        }
+        return currentTime + delay;
+    }
+
+    Smp::Duration FromMissionTime(Smp::Duration missionTime) const {
+        return timeKeeper != nullptr ? currentTime + (missionTime - timeKeeper->GetMissionTime()) : missionTime;
+    }
+
+    Smp::Duration FromEpochTime(Smp::DateTime epochTime) const {
+        return timeKeeper != nullptr ? currentTime + (epochTime - timeKeeper->GetEpochTime()) : epochTime;
+    }
+
+    Smp::Duration FromZuluTime(Smp::DateTime zuluTime) const {
+        return timeKeeper != nullptr ? currentTime + (zuluTime - timeKeeper->GetZuluTime()) : zuluTime;
+    }
+
+    void CheckTime(Smp::Duration time) const {
+        if (time < currentTime) {
+            throw SchedulerInvalidEventTime(this, time, currentTime);
+        }
+    }
+
+    void CheckCycle(Smp::Duration cycleTime, Smp::Int64 repeat) const {
+        if (cycleTime < 0 || (cycleTime == 0 && repeat != 0)) {
+            throw SchedulerInvalidCycleTime(this, cycleTime);
+        }
+    }
+
+    Smp::Services::EventId Schedule(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration time,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    ) {
+        CheckTime(time);
+        CheckCycle(cycleTime, repeat);
+        const std::uint32_t index = Allocate(entryPoint, time, cycleTime, repeat);
+        Insert(index);
+        return Id(index);
+    }
+
+    std::uint32_t Allocate(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration time,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    ) {
+        std::uint32_t index = freeHead;
+        if (index != None) {
+            freeHead = events[index].next;
+        } else {
+            index = static_cast<std::uint32_t>(events.size());
+            events.emplace_back();
+        }
+        Event &entry = events[index];
+        entry.entryPoint = entryPoint;
+        entry.time = time;
+        entry.cycle = cycleTime;
+        entry.repeat = repeat;
+        entry.next = None;
+        entry.previous = None;
+        entry.list = NoList;
+        entry.state = Scheduled;
+        entry.moved = false;
+        entry.independent = false;
+        return index;
+    }
+
+    void Free(std::uint32_t index) {
+        Event &entry = events[index];
+        entry.state = Unused;
+        entry.entryPoint = nullptr;
+        entry.generation = entry.generation == 0xFFFFFFFFu ? 1u : entry.generation + 1u;
+        entry.next = freeHead;
+        freeHead = index;
+    }
+
+    void Move(std::uint32_t index, Smp::Duration time) {
+        CheckTime(time);
+        Event &entry = events[index];
+        if (entry.state == Running) {
+            /* Rescheduled at this time once its entry point returns */
+            entry.time = time;
+            entry.moved = true;
+            return;
+        }
+        Unlink(index);
+        entry.time = time;
+        entry.state = Scheduled;
+        Insert(index);
+    }
+
+    /* Places a scheduled event in the wheel level matching its distance to the current tick */
+    void Insert(std::uint32_t index) {
+        Event &entry = events[index];
+        entry.sequence = nextSequence++;
+        const std::uint64_t tick = std::max(Tick(entry.time), currentTick);
+        const std::uint64_t delta = tick - currentTick;
+        unsigned list = OverflowList;
+        for (unsigned level = 0u; level < Levels; ++level) {
+            if (delta < (std::uint64_t(1) << (SlotBits * (level + 1u)))) {
+                list = level * SlotCount + Digit(tick, level);
+                break;
+            }
+        }
+        Link(index, list);
+    }
+
+    void Link(std::uint32_t index, unsigned list) {
+        Event &entry = events[index];
+        List &target = lists[list];
+        entry.list = static_cast<std::uint16_t>(list);
+        entry.previous = target.tail;
+        entry.next = None;
+        if (target.tail != None) {
+            events[target.tail].next = index;
+        } else {
+            target.head = index;
+            if (list < OverflowList) {
+                occupied[list / SlotCount][(list % SlotCount) / 64u] |= std::uint64_t(1) << (list % 64u);
+            }
+        }
+        target.tail = index;
+        if (list != ImmediateList) {
+            ++scheduledCount;
+        }
+    }
+
+    void Unlink(std::uint32_t index) {
+        Event &entry = events[index];
+        if (entry.list == NoList) {
+            return;
+        }
+        const unsigned list = entry.list;
+        List &source = lists[list];
+        if (entry.previous != None) {
+            events[entry.previous].next = entry.next;
+        } else {
+            source.head = entry.next;
+        }
+        if (entry.next != None) {
+            events[entry.next].previous = entry.previous;
+        } else {
+            source.tail = entry.previous;
+        }
+        if (source.head == None && list < OverflowList) {
+            occupied[list / SlotCount][(list % SlotCount) / 64u] &= ~(std::uint64_t(1) << (list % 64u));
+        }
+        if (list != ImmediateList) {
+            --scheduledCount;
+        }
+        entry.list = NoList;
+        entry.next = None;
+        entry.previous = None;
+    }
+
+    /* Empties a list into indices, keeping the events themselves scheduled */
+    void Detach(List &list, std::vector<std::uint32_t> &indices) {
+        indices.clear();
+        while (list.head != None) {
+            const std::uint32_t index = list.head;
+            Unlink(index);
+            indices.push_back(index);
+        }
+    }
+
+    void Relink(const std::vector<std::uint32_t> &indices, std::size_t first) {
+        for (std::size_t i = first; i < indices.size(); ++i) {
+            const std::uint32_t index = indices[i];
+            if (events[index].state == Scheduled && events[index].list == NoList) {
+                Insert(index);
+            }
+        }
+    }
+
+    /* First occupied slot of a level in [first, last), or -1 */
+    int FindSlot(unsigned level, unsigned first, unsigned last) const {
+        for (unsigned slot = first; slot < last;) {
+            const std::uint64_t word = occupied[level][slot / 64u] >> (slot % 64u);
+            if (word != 0u) {
+                unsigned found = slot;
+                for (std::uint64_t bits = word; (bits & 1u) == 0u; bits >>= 1) {
+                    ++found;
+                }
+                return found < last ? static_cast<int>(found) : -1;
+            }
+            slot = (slot / 64u + 1u) * 64u;
+        }
+        return -1;
+    }
+
+    Smp::Duration Earliest(const List &list, Smp::Duration next) const {
+        for (std::uint32_t index = list.head; index != None; index = events[index].next) {
+            if (next < 0 || events[index].time < next) {
+                next = events[index].time;
+            }
+        }
+        return next;
+    }
+
+    /* Moves the upper-level slots reached at the current tick down the wheel */
+    void Cascade() {
+        unsigned top = 0u;
+        while (top < Levels && (currentTick & ((std::uint64_t(1) << (SlotBits * (top + 1u))) - 1u)) == 0u) {
+            ++top;
+        }
+        std::vector<std::uint32_t> moving;
+        for (unsigned level = top; level > 0u; --level) {
+            const unsigned list = level == Levels ? OverflowList : level * SlotCount + Digit(currentTick, level);
+            Detach(lists[list], moving);
+            for (const std::uint32_t index : moving) {
+                Insert(index);
+            }
+        }
+    }
+
+    /*
+     * Moves the current tick to the next one holding events, at most up to
+     * lastTick, jumping over ticks where nothing would happen.
+     */
+    bool NextTick(std::uint64_t lastTick) {
+        for (;;) {
+            if (lists[Digit(currentTick, 0u)].head != None) {
+                return true;
+            }
+            if (currentTick >= lastTick) {
+                return false;
+            }
+            std::uint64_t next = lastTick;
+            for (unsigned level = 0u; level < Levels; ++level) {
+                const unsigned shift = SlotBits * level;
+                const unsigned position = Digit(currentTick, level);
+                const std::uint64_t rotation = (currentTick >> (shift + SlotBits)) << (shift + SlotBits);
+                const std::uint64_t rotationLength = std::uint64_t(1) << (shift + SlotBits);
+                int slot = FindSlot(level, position + 1u, SlotCount);
+                std::uint64_t reached = rotation;
+                if (slot < 0) {
+                    slot = FindSlot(level, 0u, level == 0u ? position : position + 1u);
+                    reached += rotationLength;
+                }
+                if (slot >= 0) {
+                    next = std::min(next, reached + (static_cast<std::uint64_t>(slot) << shift));
+                }
+            }
+            if (lists[OverflowList].head != None) {
+                const unsigned span = SlotBits * Levels;
+                next = std::min(next, ((currentTick >> span) + 1u) << span);
+            }
+            currentTick = next;
+            Cascade();
+        }
+    }
+
+    void SyncTimeKeeper() {
+        if (timeKeeper != nullptr && syncedTime != currentTime) {
+            timeKeeper->SetSimulationTime(currentTime);
+            syncedTime = currentTime;
+        }
+    }
+
+    /* False for events removed or moved by an entry point run before them */
+    bool IsDue(std::uint32_t index) const {
+        return events[index].state == Scheduled && events[index].list == NoList;
+    }
+
+    /*
+     * Number of due events from first on that are independent and share its
+     * time, and can therefore run concurrently; 1 when running sequentially.
+     */
+    std::size_t IndependentGroup(const std::vector<std::uint32_t> &due, std::size_t first) const {
+        if (pool == nullptr || !events[due[first]].independent) {
+            return 1u;
+        }
+        const Smp::Duration time = events[due[first]].time;
+        std::size_t last = first + 1u;
+        while (last < due.size() && IsDue(due[last]) && events[due[last]].independent
+               && events[due[last]].time == time) {
+            ++last;
+        }
+        return last - first;
+    }
+
+    void Execute(std::uint32_t index) {
+        events[index].state = Running;
+        currentTime = std::max(currentTime, events[index].time);
+        const CurrentEventScope scope(this, Id(index));
+        try {
+            SyncTimeKeeper();
+            events[index].entryPoint->Execute();
+        } catch (...) {
+            Finish(index);
+            throw;
+        }
+        Finish(index);
+    }
+
+    /*
+     * Runs a group of independent events on the pool. The scheduler is
+     * unlocked meanwhile so that entry points can use it, then the events
+     * are finished in their sequential order to keep rescheduling
+     * deterministic.
+     */
+    void ExecuteParallel(
+        const std::vector<std::uint32_t> &due,
+        std::size_t first,
+        std::size_t count,
+        std::unique_lock<std::recursive_mutex> &lock
+    ) {
+        struct Task {
+            const Smp::IEntryPoint *entryPoint;
+            Smp::Services::EventId eventId;
+        };
+        std::vector<Task> tasks(count);
+        for (std::size_t i = 0u; i < count; ++i) {
+            const std::uint32_t index = due[first + i];
+            events[index].state = Running;
+            tasks[i] = {events[index].entryPoint, Id(index)};
+        }
+        currentTime = std::max(currentTime, events[due[first]].time);
+        std::exception_ptr failure;
+        try {
+            SyncTimeKeeper();
+            std::mutex failureMutex;
+            poolRunning = true;
+            lock.unlock();
+            pool->Run(count, [this, &tasks, &failure, &failureMutex](std::size_t i) {
+                const CurrentEventScope scope(this, tasks[i].eventId);
+                try {
+                    tasks[i].entryPoint->Execute();
+                } catch (...) {
+                    std::lock_guard<std::mutex> guard(failureMutex);
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+            });
+            lock.lock();
+        } catch (...) {
+            if (!lock.owns_lock()) {
+                lock.lock();
+            }
+            failure = std::current_exception();
+        }
+        poolRunning = false;
+        for (std::size_t i = 0u; i < count; ++i) {
+            Finish(due[first + i]);
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    void Finish(std::uint32_t index) {
+        Event &entry = events[index];
+        if (entry.state == Removed) {
+            Free(index);
+        } else if (entry.moved) {
+            entry.moved = false;
+            entry.state = Scheduled;
+            Insert(index);
+        } else if (entry.repeat != 0 && entry.cycle > 0) {
+            entry.time += entry.cycle;
+            if (entry.repeat > 0) {
+                --entry.repeat;
+            }
+            entry.state = Scheduled;
+            Insert(index);
+        } else {
+            Free(index);
+        }
+    }
+
+    std::uint64_t RunImmediate() {
+        std::uint64_t executed = 0u;
+        while (lists[ImmediateList].head != None) {
+            const std::uint32_t index = lists[ImmediateList].head;
+            Unlink(index);
+            Execute(index);
+            ++executed;
+        }
+        return executed;
+    }
+
+    const Smp::Duration resolution;
+    Smp::Services::ITimeKeeper *timeKeeper = nullptr;
+    Smp::Duration currentTime = 0;
+    Smp::Duration syncedTime = 0;
+    std::uint64_t currentTick = 0u;
+    std::uint64_t nextSequence = 0u;
+    std::size_t scheduledCount = 0u;
+    std::vector<Event> events;
+    std::uint32_t freeHead = None;
+    List lists[ListCount];
+    std::uint64_t occupied[Levels][SlotCount / 64u] = {};
+    std::unique_ptr<CWraPPer::WorkStealingPool> pool;
+    /* Set while the scheduler is unlocked around pool Run, so that the pool is not replaced under it */
+    bool poolRunning = false;
+    mutable std::recursive_mutex mutex;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services ### */
+#define CW_SPACE CW_root_Smp_Services
+
+#undef CW_SPACE
+
+
+/* ### Smp::Services::TimingWheelScheduler ### */
+#define CW_SPACE CW_root_Smp_Services_TimingWheelScheduler
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, String8) name,
+    CW(CW_root_Smp, String8) description,
+    CW(CW_root_Smp, IObject) * parent,
+    CW(CW_root_Smp, Duration) resolution
+) {
+    try {
+        return new TimingWheelScheduler(
+            static_cast<Smp::String8>(name),
+            static_cast<Smp::String8>(description),
+            static_cast<Smp::IObject *>(parent),
+            static_cast<Smp::Duration>(resolution)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<TimingWheelScheduler *>(self);
+}
+
+CW(CW_root_Smp_Services, IScheduler) *
+CW(GetScheduler)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp_Services, IScheduler) *>(
+    static_cast<Smp::Services::IScheduler *>(static_cast<TimingWheelScheduler *>(self)));
+}
+
+CW(CW_root_Smp, IService) *
+CW(GetService)
+(
+    CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, IService) *>(
+    static_cast<Smp::IService *>(static_cast<TimingWheelScheduler *>(self)));
+}
+
+CW(CW_root_Smp, Duration)
+CW(GetSimulationTime)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, Duration)>(
+    static_cast<const TimingWheelScheduler *>(self)->GetSimulationTime(
+    ));
+}
+
+void
+CW(SetWorkerCount)
+(
+    CW() * self,
+    CW(CW_root_Smp, UInt64) workerCount
+) {
+    try {
+        static_cast<TimingWheelScheduler *>(self)->SetWorkerCount(
+            static_cast<std::size_t>(workerCount)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+void
+CW(SetEventIndependent)
+(
+    CW() * self,
+    CW(CW_root_Smp_Services, EventId) event,
+    CW(CW_root_Smp, Bool) independent
+) {
+    try {
+        static_cast<TimingWheelScheduler *>(self)->SetEventIndependent(
+            static_cast<Smp::Services::EventId>(event),
+            static_cast<bool>(independent)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+}
+
+CW(CW_root_Smp, UInt64)
+CW(Advance)
+(
+    CW() * self,
+    CW(CW_root_Smp, Duration) simulationTime
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, UInt64)>(
+        static_cast<TimingWheelScheduler *>(self)->Advance(
+            static_cast<Smp::Duration>(simulationTime)
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
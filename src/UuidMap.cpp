@@ -0,0 +1,239 @@
+/**
+ * Open-addressing hash map keyed by Uuid.
+ */
+#include "Smp-C/UuidMap.h"
+#include "ExceptionCatch.h"
+#include <Smp/FactoryCollection.h>
+#include <Smp/IFactory.h>
+#include <Smp/Uuid.h>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+class UuidMap {
+public:
+    explicit UuidMap(std::size_t capacity) {
+        std::size_t slotCount = 16u;
+        while (slotCount * 3u < capacity * 4u) {
+            slotCount *= 2u;
+        }
+        slots.resize(slotCount);
+    }
+
+    std::size_t GetCount() const {
+        return count;
+    }
+
+    bool Insert(const CW(CW_root_Smp, Uuid) &key, void *value) {
+        if ((count + 1u) * 4u > slots.size() * 3u) {
+            Grow();
+        }
+        Slot &slot = slots[Probe(key)];
+        const bool inserted = !slot.used;
+        if (inserted) {
+            slot.used = true;
+            slot.key = key;
+            ++count;
+        }
+        slot.value = value;
+        return inserted;
+    }
+
+    void *Find(const CW(CW_root_Smp, Uuid) &key) const {
+        const Slot &slot = slots[Probe(key)];
+        return slot.used ? slot.value : nullptr;
+    }
+
+    bool Remove(const CW(CW_root_Smp, Uuid) &key) {
+        std::size_t hole = Probe(key);
+        if (!slots[hole].used) {
+            return false;
+        }
+        /* Backward-shift deletion: no tombstones, probe sequences stay short */
+        const std::size_t mask = slots.size() - 1u;
+        for (std::size_t next = (hole + 1u) & mask; slots[next].used; next = (next + 1u) & mask) {
+            const std::size_t home = Home(slots[next].key);
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                slots[hole] = slots[next];
+                hole = next;
+            }
+        }
+        slots[hole].used = false;
+        --count;
+        return true;
+    }
+
+private:
+    struct Slot {
+        CW(CW_root_Smp, Uuid) key;
+        void *value = nullptr;
+        bool used = false;
+    };
+
+    std::size_t Home(const CW(CW_root_Smp, Uuid) &key) const {
+        return static_cast<std::size_t>(CW(CW_root_Smp_Uuid, Hash)(&key)) & (slots.size() - 1u);
+    }
+
+    /* Slot holding the key, or the empty slot where it would go */
+    std::size_t Probe(const CW(CW_root_Smp, Uuid) &key) const {
+        const std::size_t mask = slots.size() - 1u;
+        std::size_t index = Home(key);
+        while (slots[index].used && !CW(CW_root_Smp_Uuid, Equals)(&slots[index].key, &key)) {
+            index = (index + 1u) & mask;
+        }
+        return index;
+    }
+
+    void Grow() {
+        std::vector<Slot> previous(slots.size() * 2u);
+        previous.swap(slots);
+        count = 0u;
+        for (const Slot &slot : previous) {
+            if (slot.used) {
+                Slot &target = slots[Probe(slot.key)];
+                target = slot;
+                ++count;
+            }
+        }
+    }
+
+    std::vector<Slot> slots;
+    std::size_t count = 0u;
+};
+
+} /* namespace */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+
+/* ### root ### */
+#define CW_SPACE CW_root
+
+#undef CW_SPACE
+
+
+/* ### Smp ### */
+#define CW_SPACE CW_root_Smp
+
+#undef CW_SPACE
+
+
+/* ### Smp::UuidMap ### */
+#define CW_SPACE CW_root_Smp_UuidMap
+
+CW() *
+CW(Create)
+(
+    CW(CW_root_Smp, UInt64) capacity
+) {
+    try {
+        return new UuidMap(
+            static_cast<std::size_t>(capacity)
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void
+CW(Destroy)
+(
+    CW() * self
+) {
+    delete static_cast<UuidMap *>(self);
+}
+
+CW(CW_root_Smp, UInt64)
+CW(GetCount)
+(
+    const CW() * self
+) {
+    return static_cast<CW(CW_root_Smp, UInt64)>(
+    static_cast<const UuidMap *>(self)->GetCount(
+    ));
+}
+
+CW(CW_root_Smp, Bool)
+CW(Insert)
+(
+    CW() * self,
+    const CW(CW_root_Smp, Uuid) * key,
+    void * value
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<UuidMap *>(self)->Insert(
+            *key,
+            value
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+void *
+CW(Find)
+(
+    const CW() * self,
+    const CW(CW_root_Smp, Uuid) * key
+) {
+    try {
+        return static_cast<const UuidMap *>(self)->Find(
+            *key
+        );
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW(CW_root_Smp, Bool)
+CW(Remove)
+(
+    CW() * self,
+    const CW(CW_root_Smp, Uuid) * key
+) {
+    try {
+        return static_cast<CW(CW_root_Smp, Bool)>(
+        static_cast<UuidMap *>(self)->Remove(
+            *key
+        ));
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return {};
+}
+
+CW(CW_root_Smp, UInt64)
+CW(InsertFactories)
+(
+    CW() * self,
+    const CW(CW_root_Smp, FactoryCollection) * factories
+) {
+    CW(CW_root_Smp, UInt64) inserted = 0u;
+    try {
+        UuidMap *map = static_cast<UuidMap *>(self);
+        for (Smp::IFactory *factory : *static_cast<const Smp::FactoryCollection *>(factories)) {
+            const Smp::Uuid uuid = factory->GetUuid();
+            CW(CW_root_Smp, Uuid) key;
+            std::memcpy(&key, &uuid, sizeof(key));
+            map->Insert(key, static_cast<CW(CW_root_Smp, IFactory) *>(factory));
+            ++inserted;
+        }
+    } catch (...) {
+        CWraPPer::CatchException();
+    }
+    return inserted;
+}
+
+#undef CW_SPACE
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
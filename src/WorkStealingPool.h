@@ -0,0 +1,156 @@
+/**
+ * Fixed set of worker threads running batches of independent jobs.
+ *
+ * Run splits a batch over one queue per thread (the calling thread
+ * included); a thread whose queue is empty steals from the back of the
+ * others, and Run returns once every job of the batch has completed.
+ * Jobs must not throw.
+ */
+#ifndef CWRAPPER_WORKSTEALINGPOOL_H
+#define CWRAPPER_WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CWraPPer {
+
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(std::size_t threadCount) {
+        for (std::size_t i = 0u; i <= threadCount; ++i) {
+            queues.emplace_back(new Queue());
+        }
+        for (std::size_t i = 0u; i < threadCount; ++i) {
+            threads.emplace_back(&WorkStealingPool::Loop, this, i);
+        }
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    std::size_t GetThreadCount() const {
+        return threads.size();
+    }
+
+    /* Runs job(0) to job(count - 1), returns once all of them are done */
+    void Run(std::size_t count, const std::function<void(std::size_t)> &job) {
+        if (count == 0u) {
+            return;
+        }
+        if (threads.empty() || count == 1u) {
+            for (std::size_t i = 0u; i < count; ++i) {
+                job(i);
+            }
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current = &job;
+            pending.store(count);
+        }
+        /* Contiguous chunks keep neighbouring jobs on the same thread until stolen */
+        const std::size_t chunk = (count + queues.size() - 1u) / queues.size();
+        for (std::size_t q = 0u; q < queues.size(); ++q) {
+            std::lock_guard<std::mutex> lock(queues[q]->mutex);
+            for (std::size_t i = q * chunk; i < count && i < (q + 1u) * chunk; ++i) {
+                queues[q]->items.push_back(i);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++batch;
+        }
+        wake.notify_all();
+        Work(threads.size());
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return pending.load() == 0u; });
+        current = nullptr;
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::size_t> items;
+    };
+
+    void Loop(std::size_t self) {
+        std::uint64_t seen = 0u;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this, seen] { return stopping || batch != seen; });
+                if (stopping) {
+                    return;
+                }
+                seen = batch;
+            }
+            Work(self);
+        }
+    }
+
+    void Work(std::size_t self) {
+        std::size_t item;
+        while (Take(self, item)) {
+            (*current)(item);
+            if (pending.fetch_sub(1u) == 1u) {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+        }
+    }
+
+    bool Take(std::size_t self, std::size_t &item) {
+        {
+            Queue &own = *queues[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.items.empty()) {
+                item = own.items.front();
+                own.items.pop_front();
+                return true;
+            }
+        }
+        for (std::size_t offset = 1u; offset < queues.size(); ++offset) {
+            Queue &victim = *queues[(self + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.items.empty()) {
+                item = victim.items.back();
+                victim.items.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(std::size_t)> *current = nullptr;
+    std::atomic<std::size_t> pending{0u};
+    std::uint64_t batch = 0u;
+    bool stopping = false;
+};
+
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_WORKSTEALINGPOOL_H */
@@ -0,0 +1,82 @@
+/**
+ * Collection of the stand-in simulator.
+ *
+ * Keeps the items in insertion order, with a name index so that at(name)
+ * stays constant time for containers holding thousands of components.
+ * Names need not be unique. The collection does not own its items.
+ */
+#ifndef CWRAPPER_STANDIN_COLLECTION_H
+#define CWRAPPER_STANDIN_COLLECTION_H
+
+#include <Smp/ICollection.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CWraPPer {
+namespace StandIn {
+
+template <typename T>
+class Collection final : public Smp::ICollection<T> {
+public:
+    /* at(name) keeps returning the first item added with the name */
+    void Add(T *item) {
+        items.push_back(item);
+        byName.emplace(item->GetName(), item);
+    }
+
+    bool Remove(T *item) {
+        const auto found = std::find(items.begin(), items.end(), item);
+        if (found == items.end()) {
+            return false;
+        }
+        items.erase(found);
+        const auto named = byName.find(item->GetName());
+        if (named != byName.end() && named->second == item) {
+            byName.erase(named);
+        }
+        return true;
+    }
+
+    const std::vector<T *> &Items() const {
+        return items;
+    }
+
+    T *at(Smp::String8 name) const override {
+        if (name == nullptr) {
+            return nullptr;
+        }
+        const auto found = byName.find(name);
+        return found != byName.end() ? found->second : nullptr;
+    }
+
+    T *at(std::size_t index) const override {
+        return index < items.size() ? items[index] : nullptr;
+    }
+
+    std::size_t size() const override {
+        return items.size();
+    }
+
+    bool empty() const override {
+        return items.empty();
+    }
+
+    typename Smp::ICollection<T>::const_iterator begin() const override {
+        return typename Smp::ICollection<T>::const_iterator(*this, 0u);
+    }
+
+    typename Smp::ICollection<T>::const_iterator end() const override {
+        return typename Smp::ICollection<T>::const_iterator(*this, items.size());
+    }
+
+private:
+    std::vector<T *> items;
+    std::unordered_map<std::string, T *> byName;
+};
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_STANDIN_COLLECTION_H */
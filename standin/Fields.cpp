@@ -0,0 +1,211 @@
+/**
+ * Fields of the stand-in simulator.
+ */
+#include "Fields.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace CWraPPer {
+namespace StandIn {
+
+std::size_t KindSize(Smp::PrimitiveTypeKind kind) {
+    switch (kind) {
+        case Smp::PrimitiveTypeKind::PTK_Char8:
+            return sizeof(Smp::Char8);
+        case Smp::PrimitiveTypeKind::PTK_Bool:
+            return sizeof(Smp::Bool);
+        case Smp::PrimitiveTypeKind::PTK_Int8:
+            return sizeof(Smp::Int8);
+        case Smp::PrimitiveTypeKind::PTK_UInt8:
+            return sizeof(Smp::UInt8);
+        case Smp::PrimitiveTypeKind::PTK_Int16:
+            return sizeof(Smp::Int16);
+        case Smp::PrimitiveTypeKind::PTK_UInt16:
+            return sizeof(Smp::UInt16);
+        case Smp::PrimitiveTypeKind::PTK_Int32:
+            return sizeof(Smp::Int32);
+        case Smp::PrimitiveTypeKind::PTK_UInt32:
+            return sizeof(Smp::UInt32);
+        case Smp::PrimitiveTypeKind::PTK_Int64:
+            return sizeof(Smp::Int64);
+        case Smp::PrimitiveTypeKind::PTK_UInt64:
+            return sizeof(Smp::UInt64);
+        case Smp::PrimitiveTypeKind::PTK_Float32:
+            return sizeof(Smp::Float32);
+        case Smp::PrimitiveTypeKind::PTK_Float64:
+            return sizeof(Smp::Float64);
+        case Smp::PrimitiveTypeKind::PTK_Duration:
+            return sizeof(Smp::Duration);
+        case Smp::PrimitiveTypeKind::PTK_DateTime:
+            return sizeof(Smp::DateTime);
+        default:
+            return 0u;
+    }
+}
+
+void ToRaw(const Smp::AnySimple &value, Smp::PrimitiveTypeKind kind, void *raw) {
+    if (value.GetType() != kind) {
+        throw std::invalid_argument("Value of another primitive type than the field");
+    }
+    /* Every member of the value union starts at its address */
+    std::memcpy(raw, &value.value, KindSize(kind));
+}
+
+namespace {
+
+template <typename T>
+Smp::AnySimple FromRawAs(Smp::PrimitiveTypeKind kind, const void *raw) {
+    T typed;
+    std::memcpy(&typed, raw, sizeof(typed));
+    Smp::AnySimple value;
+    value.SetValue(kind, typed);
+    return value;
+}
+
+} /* namespace */
+
+Smp::AnySimple FromRaw(Smp::PrimitiveTypeKind kind, const void *raw) {
+    switch (kind) {
+        case Smp::PrimitiveTypeKind::PTK_Char8:
+            return FromRawAs<Smp::Char8>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_Bool:
+            return FromRawAs<Smp::Bool>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_Int8:
+            return FromRawAs<Smp::Int8>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_UInt8:
+            return FromRawAs<Smp::UInt8>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_Int16:
+            return FromRawAs<Smp::Int16>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_UInt16:
+            return FromRawAs<Smp::UInt16>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_Int32:
+            return FromRawAs<Smp::Int32>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_UInt32:
+            return FromRawAs<Smp::UInt32>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_Int64:
+        case Smp::PrimitiveTypeKind::PTK_Duration:
+        case Smp::PrimitiveTypeKind::PTK_DateTime:
+            return FromRawAs<Smp::Int64>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_UInt64:
+            return FromRawAs<Smp::UInt64>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_Float32:
+            return FromRawAs<Smp::Float32>(kind, raw);
+        case Smp::PrimitiveTypeKind::PTK_Float64:
+            return FromRawAs<Smp::Float64>(kind, raw);
+        default:
+            return Smp::AnySimple();
+    }
+}
+
+SimpleField::SimpleField(
+    Smp::String8 name,
+    Smp::String8 description,
+    Smp::IObject *parent,
+    Smp::PrimitiveTypeKind kind
+) :
+    FieldBase(name, description, parent),
+    kind(kind) {
+    if (KindSize(kind) == 0u) {
+        throw std::invalid_argument("Simple fields cannot be of this primitive type");
+    }
+}
+
+Smp::PrimitiveTypeKind SimpleField::GetPrimitiveTypeKind() const {
+    return kind;
+}
+
+Smp::AnySimple SimpleField::GetValue() const {
+    return FromRaw(kind, raw);
+}
+
+void SimpleField::SetValue(const Smp::AnySimple &value) {
+    ToRaw(value, kind, raw);
+}
+
+void SimpleField::Restore(Smp::IStorageReader *reader) {
+    reader->Restore(raw, KindSize(kind));
+}
+
+void SimpleField::Store(Smp::IStorageWriter *writer) {
+    writer->Store(raw, KindSize(kind));
+}
+
+SimpleArrayField::SimpleArrayField(
+    Smp::String8 name,
+    Smp::String8 description,
+    Smp::IObject *parent,
+    Smp::PrimitiveTypeKind kind,
+    Smp::UInt64 size
+) :
+    FieldBase(name, description, parent),
+    kind(kind),
+    itemSize(KindSize(kind)),
+    size(size),
+    data(static_cast<std::size_t>(size) * itemSize) {
+    if (itemSize == 0u) {
+        throw std::invalid_argument("Simple array fields cannot be of this primitive type");
+    }
+}
+
+Smp::UInt64 SimpleArrayField::GetSize() const {
+    return size;
+}
+
+Smp::AnySimple SimpleArrayField::GetValue(Smp::UInt64 index) const {
+    CheckRange(1u, index);
+    return FromRaw(kind, data.data() + index * itemSize);
+}
+
+void SimpleArrayField::SetValue(Smp::UInt64 index, const Smp::AnySimple &value) {
+    CheckRange(1u, index);
+    ToRaw(value, kind, data.data() + index * itemSize);
+}
+
+void SimpleArrayField::GetValues(Smp::UInt64 length, Smp::AnySimpleArray values, Smp::UInt64 startIndex) const {
+    CheckRange(length, startIndex);
+    const unsigned char *item = data.data() + startIndex * itemSize;
+    for (Smp::UInt64 i = 0u; i < length; ++i, item += itemSize) {
+        values[i] = FromRaw(kind, item);
+    }
+}
+
+void SimpleArrayField::SetValues(Smp::UInt64 length, const Smp::AnySimpleArray values, Smp::UInt64 startIndex) {
+    CheckRange(length, startIndex);
+    unsigned char *item = data.data() + startIndex * itemSize;
+    for (Smp::UInt64 i = 0u; i < length; ++i, item += itemSize) {
+        ToRaw(values[i], kind, item);
+    }
+}
+
+void SimpleArrayField::GetItems(Smp::UInt64 length, void *values, Smp::UInt64 startIndex) const {
+    CheckRange(length, startIndex);
+    if (length != 0u) {
+        std::memcpy(values, data.data() + startIndex * itemSize, static_cast<std::size_t>(length) * itemSize);
+    }
+}
+
+void SimpleArrayField::SetItems(Smp::UInt64 length, const void *values, Smp::UInt64 startIndex) {
+    CheckRange(length, startIndex);
+    if (length != 0u) {
+        std::memcpy(data.data() + startIndex * itemSize, values, static_cast<std::size_t>(length) * itemSize);
+    }
+}
+
+void SimpleArrayField::Restore(Smp::IStorageReader *reader) {
+    reader->Restore(data.data(), data.size());
+}
+
+void SimpleArrayField::Store(Smp::IStorageWriter *writer) {
+    writer->Store(data.data(), data.size());
+}
+
+void SimpleArrayField::CheckRange(Smp::UInt64 length, Smp::UInt64 startIndex) const {
+    if (startIndex > size || length > size - startIndex) {
+        throw std::out_of_range(
+            "Items " + std::to_string(startIndex) + " to " + std::to_string(startIndex + length) + " of an array of "
+                + std::to_string(size));
+    }
+}
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
@@ -0,0 +1,151 @@
+/**
+ * Fields of the stand-in simulator.
+ *
+ * Simple and simple array fields of any primitive type but String8, kept
+ * as raw values of their native size so that Store and Restore write them
+ * as they are. Values given as AnySimple must be of the field's kind.
+ * Simple array fields also copy their raw items straight to and from
+ * the typed GetValues and SetValues thunks (see TypedArrayField).
+ */
+#ifndef CWRAPPER_STANDIN_FIELDS_H
+#define CWRAPPER_STANDIN_FIELDS_H
+
+#include "Smp-C/TypedArrayField.h"
+#include <Smp/AnySimple.h>
+#include <Smp/IField.h>
+#include <Smp/IObject.h>
+#include <Smp/ISimpleArrayField.h>
+#include <Smp/ISimpleField.h>
+#include <Smp/IStorageReader.h>
+#include <Smp/IStorageWriter.h>
+#include <Smp/PrimitiveTypes.h>
+#include <Smp/ViewKind.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace CWraPPer {
+namespace StandIn {
+
+/* Size of a value of the kind, 0 for the kinds a field cannot have */
+std::size_t KindSize(Smp::PrimitiveTypeKind kind);
+
+/* Copies the value, which must be of the kind, to raw */
+void ToRaw(const Smp::AnySimple &value, Smp::PrimitiveTypeKind kind, void *raw);
+
+Smp::AnySimple FromRaw(Smp::PrimitiveTypeKind kind, const void *raw);
+
+template <typename Interface>
+class FieldBase : public Interface {
+public:
+    FieldBase(Smp::String8 name, Smp::String8 description, Smp::IObject *parent) :
+        name(name != nullptr ? name : ""),
+        description(description != nullptr ? description : ""),
+        parent(parent) {
+    }
+
+    Smp::String8 GetName() const override {
+        return name.c_str();
+    }
+
+    Smp::String8 GetDescription() const override {
+        return description.c_str();
+    }
+
+    Smp::IObject *GetParent() const override {
+        return parent;
+    }
+
+    Smp::IObject *GetChild(Smp::String8) const override {
+        return nullptr;
+    }
+
+    Smp::ViewKind GetView() const override {
+        return Smp::ViewKind::VK_All;
+    }
+
+    Smp::Bool IsState() const override {
+        return true;
+    }
+
+    Smp::Bool IsInput() const override {
+        return false;
+    }
+
+    Smp::Bool IsOutput() const override {
+        return false;
+    }
+
+    const Smp::Publication::IType *GetType() const override {
+        return nullptr;
+    }
+
+private:
+    std::string name;
+    std::string description;
+    Smp::IObject *parent;
+};
+
+class SimpleField final : public FieldBase<Smp::ISimpleField> {
+public:
+    SimpleField(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, Smp::PrimitiveTypeKind kind);
+
+    Smp::PrimitiveTypeKind GetPrimitiveTypeKind() const override;
+    Smp::AnySimple GetValue() const override;
+    void SetValue(const Smp::AnySimple &value) override;
+    void Restore(Smp::IStorageReader *reader) override;
+    void Store(Smp::IStorageWriter *writer) override;
+
+    /* Address of the raw value, for the model owning the field */
+    void *Data() {
+        return raw;
+    }
+
+private:
+    const Smp::PrimitiveTypeKind kind;
+    alignas(8) unsigned char raw[8] = {};
+};
+
+class SimpleArrayField final : public FieldBase<Smp::ISimpleArrayField>, public TypedArrayField {
+public:
+    SimpleArrayField(
+        Smp::String8 name,
+        Smp::String8 description,
+        Smp::IObject *parent,
+        Smp::PrimitiveTypeKind kind,
+        Smp::UInt64 size
+    );
+
+    Smp::PrimitiveTypeKind GetItemKind() const override {
+        return kind;
+    }
+
+    void GetItems(Smp::UInt64 length, void *values, Smp::UInt64 startIndex) const override;
+    void SetItems(Smp::UInt64 length, const void *values, Smp::UInt64 startIndex) override;
+
+    Smp::UInt64 GetSize() const override;
+    Smp::AnySimple GetValue(Smp::UInt64 index) const override;
+    void SetValue(Smp::UInt64 index, const Smp::AnySimple &value) override;
+    void GetValues(Smp::UInt64 length, Smp::AnySimpleArray values, Smp::UInt64 startIndex = 0) const override;
+    void SetValues(Smp::UInt64 length, const Smp::AnySimpleArray values, Smp::UInt64 startIndex = 0) override;
+    void Restore(Smp::IStorageReader *reader) override;
+    void Store(Smp::IStorageWriter *writer) override;
+
+    /* Address of the raw items, for the model owning the field */
+    void *Data() {
+        return data.data();
+    }
+
+private:
+    void CheckRange(Smp::UInt64 length, Smp::UInt64 startIndex) const;
+
+    const Smp::PrimitiveTypeKind kind;
+    const std::size_t itemSize;
+    const Smp::UInt64 size;
+    std::vector<unsigned char> data;
+};
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_STANDIN_FIELDS_H */
@@ -0,0 +1,423 @@
+/**
+ * Components of the stand-in simulator.
+ */
+#include "Model.h"
+#include <Smp/RequestType.h>
+#include <Smp/ViewKind.h>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
+namespace CWraPPer {
+namespace StandIn {
+
+EntryPoint::EntryPoint(
+    Smp::String8 name,
+    Smp::String8 description,
+    Smp::IObject *parent,
+    std::function<void()> function
+) :
+    name(name != nullptr ? name : ""),
+    description(description != nullptr ? description : ""),
+    parent(parent),
+    function(std::move(function)) {
+}
+
+Smp::String8 EntryPoint::GetName() const {
+    return name.c_str();
+}
+
+Smp::String8 EntryPoint::GetDescription() const {
+    return description.c_str();
+}
+
+Smp::IObject *EntryPoint::GetParent() const {
+    return parent;
+}
+
+Smp::IObject *EntryPoint::GetChild(Smp::String8) const {
+    return nullptr;
+}
+
+void EntryPoint::Execute() const {
+    function();
+}
+
+Container::Container(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, Smp::Int64 upper) :
+    name(name != nullptr ? name : ""),
+    description(description != nullptr ? description : ""),
+    parent(parent),
+    upper(upper) {
+}
+
+void Container::Own(std::unique_ptr<Smp::IComponent> component) {
+    AddComponent(component.get());
+    owned.push_back(std::move(component));
+}
+
+Smp::String8 Container::GetName() const {
+    return name.c_str();
+}
+
+Smp::String8 Container::GetDescription() const {
+    return description.c_str();
+}
+
+Smp::IObject *Container::GetParent() const {
+    return parent;
+}
+
+Smp::IObject *Container::GetChild(Smp::String8 name) const {
+    return components.at(name);
+}
+
+const Smp::ComponentCollection *Container::GetComponents() const {
+    return &components;
+}
+
+Smp::IComponent *Container::GetComponent(Smp::String8 name) const {
+    return components.at(name);
+}
+
+void Container::AddComponent(Smp::IComponent *component) {
+    if (upper >= 0 && GetCount() >= upper) {
+        throw std::length_error("Container " + name + " is full");
+    }
+    if (components.at(component->GetName()) != nullptr) {
+        throw std::invalid_argument(
+            "Container " + name + " already holds a component named " + component->GetName());
+    }
+    components.Add(component);
+}
+
+void Container::DeleteComponent(Smp::IComponent *component) {
+    if (!components.Remove(component)) {
+        throw std::invalid_argument("Container " + name + " does not hold the component");
+    }
+    for (auto i = owned.begin(); i != owned.end(); ++i) {
+        if (i->get() == component) {
+            owned.erase(i);
+            break;
+        }
+    }
+}
+
+Smp::Int64 Container::GetCount() const {
+    return static_cast<Smp::Int64>(components.size());
+}
+
+Smp::Int64 Container::GetUpper() const {
+    return upper;
+}
+
+Smp::Int64 Container::GetLower() const {
+    return 0;
+}
+
+Request::Request(Smp::String8 name, std::vector<std::string> parameterNames) :
+    name(name != nullptr ? name : ""),
+    parameterNames(std::move(parameterNames)),
+    parameters(this->parameterNames.size()) {
+}
+
+Smp::String8 Request::GetName() const {
+    return name.c_str();
+}
+
+Smp::RequestType Request::GetType() const {
+    return Smp::RequestType::RT_Operation;
+}
+
+Smp::Int32 Request::GetParameterCount() const {
+    return static_cast<Smp::Int32>(parameters.size());
+}
+
+Smp::Int32 Request::GetParameterIndex(Smp::String8 parameterName) const {
+    for (std::size_t i = 0u; i < parameterNames.size(); ++i) {
+        if (parameterName != nullptr && parameterNames[i] == parameterName) {
+            return static_cast<Smp::Int32>(i);
+        }
+    }
+    return -1;
+}
+
+void Request::SetParameterValue(Smp::Int32 index, const Smp::AnySimple &value) {
+    parameters.at(static_cast<std::size_t>(index)) = value;
+}
+
+Smp::AnySimple Request::GetParameterValue(Smp::Int32 index) const {
+    return parameters.at(static_cast<std::size_t>(index));
+}
+
+void Request::SetReturnValue(const Smp::AnySimple &value) {
+    returnValue = value;
+}
+
+Smp::AnySimple Request::GetReturnValue() const {
+    return returnValue;
+}
+
+SumOperation::SumOperation(
+    Smp::String8 name,
+    Smp::String8 description,
+    Smp::IObject *parent,
+    Smp::Int32 parameterCount
+) :
+    name(name != nullptr ? name : ""),
+    description(description != nullptr ? description : ""),
+    parent(parent) {
+    for (Smp::Int32 i = 0; i < parameterCount; ++i) {
+        parameterNames.push_back("x" + std::to_string(i));
+    }
+}
+
+Smp::String8 SumOperation::GetName() const {
+    return name.c_str();
+}
+
+Smp::String8 SumOperation::GetDescription() const {
+    return description.c_str();
+}
+
+Smp::IObject *SumOperation::GetParent() const {
+    return parent;
+}
+
+Smp::IObject *SumOperation::GetChild(Smp::String8) const {
+    return nullptr;
+}
+
+const Smp::ParameterCollection *SumOperation::GetParameters() const {
+    return &parameters;
+}
+
+Smp::IParameter *SumOperation::GetParameter(Smp::String8) const {
+    return nullptr;
+}
+
+Smp::IParameter *SumOperation::GetReturnParameter() const {
+    return nullptr;
+}
+
+Smp::ViewKind SumOperation::GetView() const {
+    return Smp::ViewKind::VK_All;
+}
+
+Smp::IRequest *SumOperation::CreateRequest() {
+    return new Request(name.c_str(), parameterNames);
+}
+
+void SumOperation::Invoke(Smp::IRequest *request) {
+    Smp::Float64 sum = 0.0;
+    for (Smp::Int32 i = 0; i < request->GetParameterCount(); ++i) {
+        sum += static_cast<Smp::Float64>(request->GetParameterValue(i));
+    }
+    request->SetReturnValue(Smp::AnySimple(Smp::PrimitiveTypeKind::PTK_Float64, sum));
+}
+
+void SumOperation::DeleteRequest(Smp::IRequest *request) {
+    delete request;
+}
+
+namespace {
+
+std::atomic<Smp::UInt32> modelCount(0u);
+
+} /* namespace */
+
+Model::Model(
+    Smp::String8 name,
+    Smp::String8 description,
+    Smp::IObject *parent,
+    std::size_t simpleFieldCount,
+    std::size_t arrayFieldCount,
+    Smp::UInt64 arraySize
+) :
+    name(name != nullptr ? name : ""),
+    description(description != nullptr ? description : ""),
+    parent(parent),
+    children("Children", "Nested models", this),
+    step("Step", "Updates the fields", this, [this]() { Step(); }),
+    sum("Sum", "Sum of the parameters", this, 2),
+    steps(nullptr) {
+    uuid.Data1 = ++modelCount;
+    containers.Add(&children);
+    steps = AddSimpleField("Steps", Smp::PrimitiveTypeKind::PTK_Int64);
+    for (std::size_t i = 0u; i < simpleFieldCount; ++i) {
+        float64Fields.push_back(AddSimpleField(("F" + std::to_string(i)).c_str(), Smp::PrimitiveTypeKind::PTK_Float64));
+    }
+    for (std::size_t i = 0u; i < arrayFieldCount; ++i) {
+        AddArrayField(("A" + std::to_string(i)).c_str(), Smp::PrimitiveTypeKind::PTK_Float64, arraySize);
+    }
+}
+
+SimpleField *Model::AddSimpleField(Smp::String8 name, Smp::PrimitiveTypeKind kind) {
+    std::unique_ptr<SimpleField> field(new SimpleField(name, "", this, kind));
+    if (fields.at(name) != nullptr) {
+        throw std::invalid_argument("Model " + this->name + " already has a field named " + name);
+    }
+    fields.Add(field.get());
+    SimpleField *added = field.get();
+    owned.push_back(std::move(field));
+    return added;
+}
+
+SimpleArrayField *Model::AddArrayField(Smp::String8 name, Smp::PrimitiveTypeKind kind, Smp::UInt64 size) {
+    std::unique_ptr<SimpleArrayField> field(new SimpleArrayField(name, "", this, kind, size));
+    if (fields.at(name) != nullptr) {
+        throw std::invalid_argument("Model " + this->name + " already has a field named " + name);
+    }
+    fields.Add(field.get());
+    SimpleArrayField *added = field.get();
+    owned.push_back(std::move(field));
+    return added;
+}
+
+Model *Model::AddChildModel(std::unique_ptr<Model> child) {
+    Model *added = child.get();
+    children.Own(std::move(child));
+    return added;
+}
+
+Smp::Int64 Model::GetStepCount() const {
+    return *static_cast<const Smp::Int64 *>(steps->Data());
+}
+
+Smp::String8 Model::GetName() const {
+    return name.c_str();
+}
+
+Smp::String8 Model::GetDescription() const {
+    return description.c_str();
+}
+
+Smp::IObject *Model::GetParent() const {
+    return parent;
+}
+
+Smp::IObject *Model::GetChild(Smp::String8 name) const {
+    if (Smp::IField *field = fields.at(name)) {
+        return field;
+    }
+    return containers.at(name);
+}
+
+Smp::ComponentStateKind Model::GetState() const {
+    return state;
+}
+
+void Model::Publish(Smp::IPublication *) {
+    state = Smp::ComponentStateKind::CSK_Publishing;
+}
+
+void Model::Configure(Smp::Services::ILogger *, Smp::Services::ILinkRegistry *) {
+    state = Smp::ComponentStateKind::CSK_Configured;
+}
+
+void Model::Connect(Smp::ISimulator *simulator) {
+    this->simulator = simulator;
+    state = Smp::ComponentStateKind::CSK_Connected;
+}
+
+void Model::Disconnect() {
+    simulator = nullptr;
+    state = Smp::ComponentStateKind::CSK_Disconnected;
+}
+
+Smp::IField *Model::GetField(Smp::String8 fullName) const {
+    return fields.at(fullName);
+}
+
+const Smp::FieldCollection *Model::GetFields() const {
+    return &fields;
+}
+
+const Smp::Uuid &Model::GetUuid() const {
+    return uuid;
+}
+
+Smp::AnySimple Model::GetSimpleValue(Smp::String8 fullName) const {
+    return FindSimpleField(fullName)->GetValue();
+}
+
+void Model::SetSimpleValue(Smp::String8 fullName, const Smp::AnySimple &value) {
+    FindSimpleField(fullName)->SetValue(value);
+}
+
+void Model::GetSimpleArrayValue(
+    Smp::String8 fullName,
+    Smp::UInt64 length,
+    Smp::AnySimple *values,
+    Smp::UInt64 startIndex
+) const {
+    FindArrayField(fullName)->GetValues(length, values, startIndex);
+}
+
+void Model::SetSimpleArrayValue(
+    Smp::String8 fullName,
+    Smp::UInt64 length,
+    const Smp::AnySimpleArray values,
+    Smp::UInt64 startIndex
+) {
+    FindArrayField(fullName)->SetValues(length, values, startIndex);
+}
+
+Smp::Bool Model::AddChild(Smp::IObject *, const Smp::ICollectionBase *) {
+    return false;
+}
+
+Smp::Bool Model::RemoveChild(Smp::IObject *, const Smp::ICollectionBase *) {
+    return false;
+}
+
+Smp::IObject *Model::IsChildInCollection(Smp::String8, const Smp::ICollectionBase *) const {
+    return nullptr;
+}
+
+const Smp::ContainerCollection *Model::GetContainers() const {
+    return &containers;
+}
+
+Smp::IContainer *Model::GetContainer(Smp::String8 name) const {
+    return containers.at(name);
+}
+
+void Model::Restore(Smp::IStorageReader *reader) {
+    for (Smp::IField *field : fields.Items()) {
+        field->Restore(reader);
+    }
+}
+
+void Model::Store(Smp::IStorageWriter *writer) {
+    for (Smp::IField *field : fields.Items()) {
+        field->Store(writer);
+    }
+}
+
+Smp::ISimpleField *Model::FindSimpleField(Smp::String8 fullName) const {
+    Smp::ISimpleField *field = dynamic_cast<Smp::ISimpleField *>(fields.at(fullName));
+    if (field == nullptr) {
+        throw std::invalid_argument(
+            "Model " + name + " has no simple field named " + (fullName != nullptr ? fullName : ""));
+    }
+    return field;
+}
+
+Smp::ISimpleArrayField *Model::FindArrayField(Smp::String8 fullName) const {
+    Smp::ISimpleArrayField *field = dynamic_cast<Smp::ISimpleArrayField *>(fields.at(fullName));
+    if (field == nullptr) {
+        throw std::invalid_argument(
+            "Model " + name + " has no simple array field named " + (fullName != nullptr ? fullName : ""));
+    }
+    return field;
+}
+
+void Model::Step() {
+    ++*static_cast<Smp::Int64 *>(steps->Data());
+    for (SimpleField *field : float64Fields) {
+        *static_cast<Smp::Float64 *>(field->Data()) += 1.0;
+    }
+}
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
@@ -0,0 +1,222 @@
+/**
+ * Components of the stand-in simulator.
+ *
+ * A Model publishes simple and simple array fields, a "Step" entry point
+ * that updates them, a "Sum" operation and a "Children" container for
+ * nested models. It stores and restores all its fields, in the order they
+ * were added. Fields are found by their name, the children by the path
+ * "Children/<name>".
+ */
+#ifndef CWRAPPER_STANDIN_MODEL_H
+#define CWRAPPER_STANDIN_MODEL_H
+
+#include "Collection.h"
+#include "Fields.h"
+#include <Smp/ComponentStateKind.h>
+#include <Smp/IComponent.h>
+#include <Smp/IComposite.h>
+#include <Smp/IContainer.h>
+#include <Smp/IEntryPoint.h>
+#include <Smp/IModel.h>
+#include <Smp/IOperation.h>
+#include <Smp/IPersist.h>
+#include <Smp/IRequest.h>
+#include <Smp/Uuid.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CWraPPer {
+namespace StandIn {
+
+class EntryPoint final : public Smp::IEntryPoint {
+public:
+    EntryPoint(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, std::function<void()> function);
+
+    Smp::String8 GetName() const override;
+    Smp::String8 GetDescription() const override;
+    Smp::IObject *GetParent() const override;
+    Smp::IObject *GetChild(Smp::String8 name) const override;
+    void Execute() const override;
+
+private:
+    std::string name;
+    std::string description;
+    Smp::IObject *parent;
+    std::function<void()> function;
+};
+
+/* Container of components, which owns the components added through Own */
+class Container final : public Smp::IContainer {
+public:
+    Container(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, Smp::Int64 upper = -1);
+
+    /* Adds the component and takes its ownership */
+    void Own(std::unique_ptr<Smp::IComponent> component);
+
+    Smp::String8 GetName() const override;
+    Smp::String8 GetDescription() const override;
+    Smp::IObject *GetParent() const override;
+    Smp::IObject *GetChild(Smp::String8 name) const override;
+    const Smp::ComponentCollection *GetComponents() const override;
+    Smp::IComponent *GetComponent(Smp::String8 name) const override;
+    void AddComponent(Smp::IComponent *component) override;
+    void DeleteComponent(Smp::IComponent *component) override;
+    Smp::Int64 GetCount() const override;
+    Smp::Int64 GetUpper() const override;
+    Smp::Int64 GetLower() const override;
+
+private:
+    std::string name;
+    std::string description;
+    Smp::IObject *parent;
+    Smp::Int64 upper;
+    Collection<Smp::IComponent> components;
+    std::vector<std::unique_ptr<Smp::IComponent>> owned;
+};
+
+class Request final : public Smp::IRequest {
+public:
+    Request(Smp::String8 name, std::vector<std::string> parameterNames);
+
+    Smp::String8 GetName() const override;
+    Smp::RequestType GetType() const override;
+    Smp::Int32 GetParameterCount() const override;
+    Smp::Int32 GetParameterIndex(Smp::String8 parameterName) const override;
+    void SetParameterValue(Smp::Int32 index, const Smp::AnySimple &value) override;
+    Smp::AnySimple GetParameterValue(Smp::Int32 index) const override;
+    void SetReturnValue(const Smp::AnySimple &value) override;
+    Smp::AnySimple GetReturnValue() const override;
+
+private:
+    std::string name;
+    std::vector<std::string> parameterNames;
+    std::vector<Smp::AnySimple> parameters;
+    Smp::AnySimple returnValue;
+};
+
+/* Operation returning the Float64 sum of its Float64 parameters */
+class SumOperation final : public Smp::IOperation {
+public:
+    SumOperation(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, Smp::Int32 parameterCount);
+
+    Smp::String8 GetName() const override;
+    Smp::String8 GetDescription() const override;
+    Smp::IObject *GetParent() const override;
+    Smp::IObject *GetChild(Smp::String8 name) const override;
+    const Smp::ParameterCollection *GetParameters() const override;
+    Smp::IParameter *GetParameter(Smp::String8 name) const override;
+    Smp::IParameter *GetReturnParameter() const override;
+    Smp::ViewKind GetView() const override;
+    Smp::IRequest *CreateRequest() override;
+    void Invoke(Smp::IRequest *request) override;
+    void DeleteRequest(Smp::IRequest *request) override;
+
+private:
+    std::string name;
+    std::string description;
+    Smp::IObject *parent;
+    std::vector<std::string> parameterNames;
+    Collection<Smp::IParameter> parameters;
+};
+
+class Model final : public Smp::IModel, public Smp::IComposite, public Smp::IPersist {
+public:
+    /* The Float64 fields are named F0, F1..., the Float64 arrays A0, A1... */
+    Model(
+        Smp::String8 name,
+        Smp::String8 description,
+        Smp::IObject *parent,
+        std::size_t simpleFieldCount,
+        std::size_t arrayFieldCount,
+        Smp::UInt64 arraySize
+    );
+
+    /* Adds a simple field, owned by the model */
+    SimpleField *AddSimpleField(Smp::String8 name, Smp::PrimitiveTypeKind kind);
+
+    /* Adds a simple array field, owned by the model */
+    SimpleArrayField *AddArrayField(Smp::String8 name, Smp::PrimitiveTypeKind kind, Smp::UInt64 size);
+
+    /* Adds a nested model to the Children container */
+    Model *AddChildModel(std::unique_ptr<Model> child);
+
+    EntryPoint *GetStep() {
+        return &step;
+    }
+
+    SumOperation *GetSum() {
+        return &sum;
+    }
+
+    /* Number of times Step was executed, kept in the Int64 field "Steps" */
+    Smp::Int64 GetStepCount() const;
+
+    /* IObject */
+    Smp::String8 GetName() const override;
+    Smp::String8 GetDescription() const override;
+    Smp::IObject *GetParent() const override;
+    Smp::IObject *GetChild(Smp::String8 name) const override;
+
+    /* IComponent */
+    Smp::ComponentStateKind GetState() const override;
+    void Publish(Smp::IPublication *receiver) override;
+    void Configure(Smp::Services::ILogger *logger, Smp::Services::ILinkRegistry *linkRegistry) override;
+    void Connect(Smp::ISimulator *simulator) override;
+    void Disconnect() override;
+    Smp::IField *GetField(Smp::String8 fullName) const override;
+    const Smp::FieldCollection *GetFields() const override;
+    const Smp::Uuid &GetUuid() const override;
+    Smp::AnySimple GetSimpleValue(Smp::String8 fullName) const override;
+    void SetSimpleValue(Smp::String8 fullName, const Smp::AnySimple &value) override;
+    void GetSimpleArrayValue(
+        Smp::String8 fullName,
+        Smp::UInt64 length,
+        Smp::AnySimple *values,
+        Smp::UInt64 startIndex
+    ) const override;
+    void SetSimpleArrayValue(
+        Smp::String8 fullName,
+        Smp::UInt64 length,
+        const Smp::AnySimpleArray values,
+        Smp::UInt64 startIndex
+    ) override;
+    Smp::Bool AddChild(Smp::IObject *child, const Smp::ICollectionBase *collection) override;
+    Smp::Bool RemoveChild(Smp::IObject *child, const Smp::ICollectionBase *collection) override;
+    Smp::IObject *IsChildInCollection(Smp::String8 child, const Smp::ICollectionBase *collection) const override;
+
+    /* IComposite */
+    const Smp::ContainerCollection *GetContainers() const override;
+    Smp::IContainer *GetContainer(Smp::String8 name) const override;
+
+    /* IPersist */
+    void Restore(Smp::IStorageReader *reader) override;
+    void Store(Smp::IStorageWriter *writer) override;
+
+private:
+    Smp::ISimpleField *FindSimpleField(Smp::String8 fullName) const;
+    Smp::ISimpleArrayField *FindArrayField(Smp::String8 fullName) const;
+    void Step();
+
+    std::string name;
+    std::string description;
+    Smp::IObject *parent;
+    Smp::ComponentStateKind state = Smp::ComponentStateKind::CSK_Created;
+    Smp::ISimulator *simulator = nullptr;
+    Smp::Uuid uuid;
+    std::vector<std::unique_ptr<Smp::IField>> owned;
+    Collection<Smp::IField> fields;
+    std::vector<SimpleField *> float64Fields;
+    Container children;
+    Collection<Smp::IContainer> containers;
+    EntryPoint step;
+    SumOperation sum;
+    SimpleField *steps;
+};
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_STANDIN_MODEL_H */
@@ -0,0 +1,495 @@
+/**
+ * Services of the stand-in simulator.
+ */
+#include "Services.h"
+#include <Smp/IComponent.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace CWraPPer {
+namespace StandIn {
+
+namespace {
+
+/* Seconds from the Unix epoch to the SMP one, 2000-01-01T12:00:00 */
+const std::int64_t smpEpoch = 946728000;
+
+[[noreturn]] void InvalidEvent(Smp::Services::EventId event) {
+    throw std::invalid_argument("No event " + std::to_string(event));
+}
+
+} /* namespace */
+
+TimeKeeper::TimeKeeper(Smp::String8 name, Smp::String8 description, Smp::IObject *parent) :
+    ServiceBase(name, description, parent) {
+}
+
+Smp::Duration TimeKeeper::GetSimulationTime() const {
+    return simulationTime;
+}
+
+Smp::DateTime TimeKeeper::GetEpochTime() const {
+    return epochAtStart + simulationTime;
+}
+
+Smp::DateTime TimeKeeper::GetMissionStartTime() const {
+    return missionStart;
+}
+
+Smp::Duration TimeKeeper::GetMissionTime() const {
+    return GetEpochTime() - missionStart;
+}
+
+Smp::DateTime TimeKeeper::GetZuluTime() const {
+    const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    return now - smpEpoch * 1000000000;
+}
+
+void TimeKeeper::SetSimulationTime(Smp::Duration simulationTime) {
+    this->simulationTime = simulationTime;
+}
+
+void TimeKeeper::SetEpochTime(Smp::DateTime epochTime) {
+    epochAtStart = epochTime - simulationTime;
+}
+
+void TimeKeeper::SetMissionStartTime(Smp::DateTime missionStart) {
+    this->missionStart = missionStart;
+}
+
+void TimeKeeper::SetMissionTime(Smp::Duration missionTime) {
+    missionStart = GetEpochTime() - missionTime;
+}
+
+Scheduler::Scheduler(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, TimeKeeper *timeKeeper) :
+    ServiceBase(name, description, parent),
+    timeKeeper(timeKeeper) {
+}
+
+std::uint64_t Scheduler::Advance(Smp::Duration simulationTime) {
+    std::uint64_t executed = 0u;
+    for (DropStale(); !queue.empty() && queue.front().time <= simulationTime; DropStale()) {
+        const Due due = queue.front();
+        PopDue();
+        Event &event = events.at(due.event);
+        const Smp::IEntryPoint *entryPoint = event.entryPoint;
+        if (event.repeat != 0) {
+            event.time += event.cycleTime;
+            event.sequence = nextSequence++;
+            if (event.repeat > 0) {
+                --event.repeat;
+            }
+            PushDue({event.time, event.sequence, due.event});
+        } else {
+            events.erase(due.event);
+        }
+        timeKeeper->SetSimulationTime(due.time);
+        currentEvent = due.event;
+        entryPoint->Execute();
+        currentEvent = -1;
+        ++executed;
+    }
+    if (timeKeeper->GetSimulationTime() < simulationTime) {
+        timeKeeper->SetSimulationTime(simulationTime);
+    }
+    return executed;
+}
+
+Smp::Services::EventId Scheduler::AddImmediateEvent(const Smp::IEntryPoint *entryPoint) {
+    return Schedule(entryPoint, timeKeeper->GetSimulationTime(), 0, 0);
+}
+
+Smp::Services::EventId Scheduler::AddSimulationTimeEvent(
+    const Smp::IEntryPoint *entryPoint,
+    Smp::Duration simulationTime,
+    Smp::Duration cycleTime,
+    Smp::Int64 repeat
+) {
+    return Schedule(entryPoint, timeKeeper->GetSimulationTime() + simulationTime, cycleTime, repeat);
+}
+
+Smp::Services::EventId Scheduler::AddMissionTimeEvent(
+    const Smp::IEntryPoint *entryPoint,
+    Smp::Duration missionTime,
+    Smp::Duration cycleTime,
+    Smp::Int64 repeat
+) {
+    return Schedule(
+        entryPoint,
+        timeKeeper->GetSimulationTime() + (missionTime - timeKeeper->GetMissionTime()),
+        cycleTime,
+        repeat);
+}
+
+Smp::Services::EventId Scheduler::AddEpochTimeEvent(
+    const Smp::IEntryPoint *entryPoint,
+    Smp::DateTime epochTime,
+    Smp::Duration cycleTime,
+    Smp::Int64 repeat
+) {
+    return Schedule(
+        entryPoint,
+        timeKeeper->GetSimulationTime() + (epochTime - timeKeeper->GetEpochTime()),
+        cycleTime,
+        repeat);
+}
+
+Smp::Services::EventId Scheduler::AddZuluTimeEvent(
+    const Smp::IEntryPoint *entryPoint,
+    Smp::DateTime zuluTime,
+    Smp::Duration cycleTime,
+    Smp::Int64 repeat
+) {
+    return Schedule(
+        entryPoint,
+        timeKeeper->GetSimulationTime() + (zuluTime - timeKeeper->GetZuluTime()),
+        cycleTime,
+        repeat);
+}
+
+Smp::Services::EventId Scheduler::AddRelativeZuluTimeEvent(
+    const Smp::IEntryPoint *entryPoint,
+    Smp::Duration zuluTimeDelay,
+    Smp::Duration cycleTime,
+    Smp::Int64 repeat
+) {
+    return Schedule(entryPoint, timeKeeper->GetSimulationTime() + zuluTimeDelay, cycleTime, repeat);
+}
+
+void Scheduler::SetEventSimulationTime(Smp::Services::EventId event, Smp::Duration simulationTime) {
+    Move(event, timeKeeper->GetSimulationTime() + simulationTime);
+}
+
+void Scheduler::SetEventMissionTime(Smp::Services::EventId event, Smp::Duration missionTime) {
+    Move(event, timeKeeper->GetSimulationTime() + (missionTime - timeKeeper->GetMissionTime()));
+}
+
+void Scheduler::SetEventEpochTime(Smp::Services::EventId event, Smp::DateTime epochTime) {
+    Move(event, timeKeeper->GetSimulationTime() + (epochTime - timeKeeper->GetEpochTime()));
+}
+
+void Scheduler::SetEventZuluTime(Smp::Services::EventId event, Smp::DateTime zuluTime) {
+    Move(event, timeKeeper->GetSimulationTime() + (zuluTime - timeKeeper->GetZuluTime()));
+}
+
+void Scheduler::SetEventCycleTime(Smp::Services::EventId event, Smp::Duration cycleTime) {
+    Event &found = Lookup(event);
+    if (cycleTime < 0 || (cycleTime == 0 && found.repeat != 0)) {
+        throw std::invalid_argument("Invalid cycle time " + std::to_string(cycleTime));
+    }
+    found.cycleTime = cycleTime;
+}
+
+void Scheduler::SetEventRepeat(Smp::Services::EventId event, Smp::Int64 repeat) {
+    Event &found = Lookup(event);
+    if (repeat != 0 && found.cycleTime <= 0) {
+        throw std::invalid_argument("Cannot repeat an event without cycle time");
+    }
+    found.repeat = repeat;
+}
+
+void Scheduler::RemoveEvent(Smp::Services::EventId event) {
+    if (events.erase(event) == 0u) {
+        InvalidEvent(event);
+    }
+}
+
+Smp::Services::EventId Scheduler::GetCurrentEventId() const {
+    return currentEvent;
+}
+
+Smp::Duration Scheduler::GetNextScheduledEventTime() const {
+    DropStale();
+    return queue.empty() ? -1 : queue.front().time;
+}
+
+Smp::Bool Scheduler::IsEventScheduled(Smp::Services::EventId event) const {
+    return events.find(event) != events.end();
+}
+
+void Scheduler::AddSimulationTimeEvents(
+    Smp::UInt64 count,
+    const CW(CW_root_Smp_Services, SimulationTimeEvent) * batch,
+    CW(CW_root_Smp_Services, EventId) * eventIds,
+    Smp::UInt64 &added
+) {
+    events.reserve(events.size() + static_cast<std::size_t>(count));
+    queue.reserve(queue.size() + static_cast<std::size_t>(count));
+    /* The events added before a failing one stay scheduled */
+    try {
+        for (; added < count; ++added) {
+            const CW(CW_root_Smp_Services, SimulationTimeEvent) &event = batch[added];
+            eventIds[added] = static_cast<CW(CW_root_Smp_Services, EventId)>(Insert(
+                static_cast<const Smp::IEntryPoint *>(event.entryPoint),
+                timeKeeper->GetSimulationTime() + static_cast<Smp::Duration>(event.simulationTime),
+                static_cast<Smp::Duration>(event.cycleTime),
+                static_cast<Smp::Int64>(event.repeat)));
+        }
+    } catch (...) {
+        std::make_heap(queue.begin(), queue.end(), std::greater<Due>());
+        throw;
+    }
+    std::make_heap(queue.begin(), queue.end(), std::greater<Due>());
+}
+
+Smp::Services::EventId Scheduler::Schedule(
+    const Smp::IEntryPoint *entryPoint,
+    Smp::Duration simulationTime,
+    Smp::Duration cycleTime,
+    Smp::Int64 repeat
+) {
+    const Smp::Services::EventId id = Insert(entryPoint, simulationTime, cycleTime, repeat);
+    std::push_heap(queue.begin(), queue.end(), std::greater<Due>());
+    return id;
+}
+
+Smp::Services::EventId Scheduler::Insert(
+    const Smp::IEntryPoint *entryPoint,
+    Smp::Duration simulationTime,
+    Smp::Duration cycleTime,
+    Smp::Int64 repeat
+) {
+    if (simulationTime < timeKeeper->GetSimulationTime()) {
+        throw std::invalid_argument("Event time " + std::to_string(simulationTime) + " is in the past");
+    }
+    if (cycleTime < 0 || (cycleTime == 0 && repeat != 0)) {
+        throw std::invalid_argument("Invalid cycle time " + std::to_string(cycleTime));
+    }
+    const Smp::Services::EventId id = nextEvent++;
+    const std::uint64_t sequence = nextSequence++;
+    events.emplace(id, Event{entryPoint, simulationTime, cycleTime, repeat, sequence});
+    queue.push_back({simulationTime, sequence, id});
+    return id;
+}
+
+Scheduler::Event &Scheduler::Lookup(Smp::Services::EventId event) {
+    const auto found = events.find(event);
+    if (found == events.end()) {
+        InvalidEvent(event);
+    }
+    return found->second;
+}
+
+void Scheduler::Move(Smp::Services::EventId event, Smp::Duration simulationTime) {
+    Event &found = Lookup(event);
+    if (simulationTime < timeKeeper->GetSimulationTime()) {
+        throw std::invalid_argument("Event time " + std::to_string(simulationTime) + " is in the past");
+    }
+    found.time = simulationTime;
+    found.sequence = nextSequence++;
+    PushDue({simulationTime, found.sequence, event});
+}
+
+void Scheduler::DropStale() const {
+    while (!queue.empty()) {
+        const auto found = events.find(queue.front().event);
+        if (found != events.end() && found->second.sequence == queue.front().sequence) {
+            return;
+        }
+        PopDue();
+    }
+}
+
+void Scheduler::PushDue(const Due &due) {
+    queue.push_back(due);
+    std::push_heap(queue.begin(), queue.end(), std::greater<Due>());
+}
+
+void Scheduler::PopDue() const {
+    std::pop_heap(queue.begin(), queue.end(), std::greater<Due>());
+    queue.pop_back();
+}
+
+EventManager::EventManager(Smp::String8 name, Smp::String8 description, Smp::IObject *parent) :
+    ServiceBase(name, description, parent) {
+}
+
+Smp::Services::EventId EventManager::QueryEventId(Smp::String8 eventName) {
+    ++queryCount;
+    const std::string key(eventName != nullptr ? eventName : "");
+    const auto found = ids.find(key);
+    if (found != ids.end()) {
+        return found->second;
+    }
+    const Smp::Services::EventId id = static_cast<Smp::Services::EventId>(subscribers.size()) + 1;
+    subscribers.emplace_back();
+    ids.emplace(key, id);
+    return id;
+}
+
+void EventManager::Subscribe(Smp::Services::EventId event, const Smp::IEntryPoint *entryPoint) {
+    std::vector<const Smp::IEntryPoint *> &entryPoints = Subscribers(event);
+    for (const Smp::IEntryPoint *subscribed : entryPoints) {
+        if (subscribed == entryPoint) {
+            throw std::invalid_argument("Entry point already subscribed to event " + std::to_string(event));
+        }
+    }
+    entryPoints.push_back(entryPoint);
+}
+
+void EventManager::Unsubscribe(Smp::Services::EventId event, const Smp::IEntryPoint *entryPoint) {
+    std::vector<const Smp::IEntryPoint *> &entryPoints = Subscribers(event);
+    for (auto i = entryPoints.begin(); i != entryPoints.end(); ++i) {
+        if (*i == entryPoint) {
+            entryPoints.erase(i);
+            return;
+        }
+    }
+    throw std::invalid_argument("Entry point not subscribed to event " + std::to_string(event));
+}
+
+void EventManager::Emit(Smp::Services::EventId event, Smp::Bool) {
+    /* Subscribers may unsubscribe while the event is emitted */
+    const std::vector<const Smp::IEntryPoint *> entryPoints = Subscribers(event);
+    for (const Smp::IEntryPoint *entryPoint : entryPoints) {
+        entryPoint->Execute();
+    }
+}
+
+void EventManager::EmitMany(
+    Smp::UInt64 count,
+    const CW(CW_root_Smp_Services, EventId) * events,
+    Smp::Bool,
+    Smp::UInt64 &emitted
+) {
+    /* Subscribers may unsubscribe while the events are emitted */
+    std::vector<const Smp::IEntryPoint *> entryPoints;
+    for (; emitted < count; ++emitted) {
+        const std::vector<const Smp::IEntryPoint *> &subscribed =
+            Subscribers(static_cast<Smp::Services::EventId>(events[emitted]));
+        entryPoints.assign(subscribed.begin(), subscribed.end());
+        for (const Smp::IEntryPoint *entryPoint : entryPoints) {
+            entryPoint->Execute();
+        }
+    }
+}
+
+std::vector<const Smp::IEntryPoint *> &EventManager::Subscribers(Smp::Services::EventId event) {
+    if (event < 1 || static_cast<std::size_t>(event) > subscribers.size()) {
+        InvalidEvent(event);
+    }
+    return subscribers[static_cast<std::size_t>(event - 1)];
+}
+
+Logger::Logger(Smp::String8 name, Smp::String8 description, Smp::IObject *parent) :
+    ServiceBase(name, description, parent),
+    kinds{"Information", "Event", "Warning", "Error", "Debug"},
+    counts(kinds.size(), 0u) {
+}
+
+Smp::Services::LogMessageKind Logger::QueryLogMessageKind(Smp::String8 messageKindName) {
+    ++queryCount;
+    const std::string name(messageKindName != nullptr ? messageKindName : "");
+    for (std::size_t i = 0u; i < kinds.size(); ++i) {
+        if (kinds[i] == name) {
+            return static_cast<Smp::Services::LogMessageKind>(i);
+        }
+    }
+    kinds.push_back(name);
+    counts.push_back(0u);
+    return static_cast<Smp::Services::LogMessageKind>(kinds.size() - 1u);
+}
+
+void Logger::Log(const Smp::IObject *sender, Smp::String8 message, Smp::Services::LogMessageKind kind) {
+    if (kind < 0 || static_cast<std::size_t>(kind) >= counts.size()) {
+        throw std::invalid_argument("No log message kind " + std::to_string(kind));
+    }
+    ++counts[static_cast<std::size_t>(kind)];
+    lastMessage = message != nullptr ? message : "";
+    lastSender = sender;
+}
+
+std::uint64_t Logger::GetCount(Smp::Services::LogMessageKind kind) const {
+    return kind >= 0 && static_cast<std::size_t>(kind) < counts.size() ? counts[static_cast<std::size_t>(kind)] : 0u;
+}
+
+Resolver::Resolver(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, Smp::IObject *root) :
+    ServiceBase(name, description, parent),
+    root(root) {
+}
+
+Smp::IObject *Resolver::ResolveAbsolute(Smp::String8 absolutePath) {
+    return ResolveRelative(absolutePath, root);
+}
+
+Smp::IObject *Resolver::ResolveRelative(Smp::String8 relativePath, Smp::IObject *relativeRoot) {
+    if (relativePath == nullptr) {
+        return nullptr;
+    }
+    Smp::IObject *object = relativeRoot;
+    const std::string path(relativePath);
+    std::size_t begin = 0u;
+    while (object != nullptr && begin <= path.size()) {
+        std::size_t end = path.find('/', begin);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        const std::string element = path.substr(begin, end - begin);
+        if (element == "..") {
+            object = object->GetParent();
+        } else if (!element.empty() && element != ".") {
+            object = object->GetChild(element.c_str());
+        }
+        begin = end + 1u;
+    }
+    return object;
+}
+
+LinkRegistry::LinkRegistry(Smp::String8 name, Smp::String8 description, Smp::IObject *parent) :
+    ServiceBase(name, description, parent) {
+}
+
+void LinkRegistry::AddLink(Smp::IComponent *source, const Smp::IComponent *target) {
+    std::unique_ptr<Target> &links = targets[target];
+    if (!links) {
+        links.reset(new Target());
+    }
+    if (links->counts[source]++ == 0u) {
+        links->sources.Add(source);
+    }
+}
+
+Smp::UInt32 LinkRegistry::GetLinkCount(const Smp::IComponent *source, const Smp::IComponent *target) const {
+    const auto links = targets.find(target);
+    if (links == targets.end()) {
+        return 0u;
+    }
+    const auto count = links->second->counts.find(const_cast<Smp::IComponent *>(source));
+    return count != links->second->counts.end() ? count->second : 0u;
+}
+
+Smp::Bool LinkRegistry::RemoveLink(Smp::IComponent *source, const Smp::IComponent *target) {
+    const auto links = targets.find(target);
+    if (links == targets.end()) {
+        return false;
+    }
+    const auto count = links->second->counts.find(source);
+    if (count == links->second->counts.end()) {
+        return false;
+    }
+    if (--count->second == 0u) {
+        links->second->counts.erase(count);
+        links->second->sources.Remove(source);
+    }
+    return true;
+}
+
+const Smp::ComponentCollection *LinkRegistry::GetLinkSources(const Smp::IComponent *target) const {
+    const auto links = targets.find(target);
+    return links != targets.end() ? &links->second->sources : &noSources;
+}
+
+Smp::Bool LinkRegistry::CanRemove(const Smp::IComponent *) {
+    return true;
+}
+
+void LinkRegistry::RemoveLinks(const Smp::IComponent *target) {
+    targets.erase(target);
+}
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
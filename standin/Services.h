@@ -0,0 +1,261 @@
+/**
+ * Services of the stand-in simulator.
+ *
+ * Straightforward single-threaded implementations of the SMP services,
+ * built on the ServiceBase of the library: a time keeper, a scheduler
+ * executing its events in time then insertion order, an event manager,
+ * a logger keeping counts of the messages, a resolver walking GetChild,
+ * and a link registry.
+ */
+#ifndef CWRAPPER_STANDIN_SERVICES_H
+#define CWRAPPER_STANDIN_SERVICES_H
+
+#include "Collection.h"
+#include "ServiceBase.h"
+#include "Smp-C/Services/BatchEventManager.h"
+#include "Smp-C/Services/BatchScheduler.h"
+#include <Smp/IEntryPoint.h>
+#include <Smp/Services/IEventManager.h>
+#include <Smp/Services/ILinkRegistry.h>
+#include <Smp/Services/ILogger.h>
+#include <Smp/Services/IResolver.h>
+#include <Smp/Services/IScheduler.h>
+#include <Smp/Services/ITimeKeeper.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CWraPPer {
+namespace StandIn {
+
+class TimeKeeper final : public ServiceBase<Smp::Services::ITimeKeeper> {
+public:
+    TimeKeeper(Smp::String8 name, Smp::String8 description, Smp::IObject *parent);
+
+    Smp::Duration GetSimulationTime() const override;
+    Smp::DateTime GetEpochTime() const override;
+    Smp::DateTime GetMissionStartTime() const override;
+    Smp::Duration GetMissionTime() const override;
+    Smp::DateTime GetZuluTime() const override;
+    void SetSimulationTime(Smp::Duration simulationTime) override;
+    void SetEpochTime(Smp::DateTime epochTime) override;
+    void SetMissionStartTime(Smp::DateTime missionStart) override;
+    void SetMissionTime(Smp::Duration missionTime) override;
+
+private:
+    Smp::Duration simulationTime = 0;
+    Smp::DateTime epochAtStart = 0;
+    Smp::DateTime missionStart = 0;
+};
+
+class Scheduler final : public ServiceBase<Smp::Services::IScheduler>, public CWraPPer::BatchScheduler {
+public:
+    Scheduler(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, TimeKeeper *timeKeeper);
+
+    /* Executes the events due up to simulationTime, returns their number */
+    std::uint64_t Advance(Smp::Duration simulationTime);
+
+    /* Number of events scheduled */
+    std::size_t GetEventCount() const {
+        return events.size();
+    }
+
+    Smp::Services::EventId AddImmediateEvent(const Smp::IEntryPoint *entryPoint) override;
+    Smp::Services::EventId AddSimulationTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration simulationTime,
+        Smp::Duration cycleTime = 0,
+        Smp::Int64 repeat = 0
+    ) override;
+    Smp::Services::EventId AddMissionTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration missionTime,
+        Smp::Duration cycleTime = 0,
+        Smp::Int64 repeat = 0
+    ) override;
+    Smp::Services::EventId AddEpochTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::DateTime epochTime,
+        Smp::Duration cycleTime = 0,
+        Smp::Int64 repeat = 0
+    ) override;
+    Smp::Services::EventId AddZuluTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::DateTime zuluTime,
+        Smp::Duration cycleTime = 0,
+        Smp::Int64 repeat = 0
+    ) override;
+    Smp::Services::EventId AddRelativeZuluTimeEvent(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration zuluTimeDelay,
+        Smp::Duration cycleTime = 0,
+        Smp::Int64 repeat = 0
+    ) override;
+    void SetEventSimulationTime(Smp::Services::EventId event, Smp::Duration simulationTime) override;
+    void SetEventMissionTime(Smp::Services::EventId event, Smp::Duration missionTime) override;
+    void SetEventEpochTime(Smp::Services::EventId event, Smp::DateTime epochTime) override;
+    void SetEventZuluTime(Smp::Services::EventId event, Smp::DateTime zuluTime) override;
+    void SetEventCycleTime(Smp::Services::EventId event, Smp::Duration cycleTime) override;
+    void SetEventRepeat(Smp::Services::EventId event, Smp::Int64 repeat) override;
+    void RemoveEvent(Smp::Services::EventId event) override;
+    Smp::Services::EventId GetCurrentEventId() const override;
+    Smp::Duration GetNextScheduledEventTime() const override;
+    Smp::Bool IsEventScheduled(Smp::Services::EventId event) const override;
+
+    /* Appends the whole batch to the queue, then heapifies it once */
+    void AddSimulationTimeEvents(
+        Smp::UInt64 count,
+        const CW(CW_root_Smp_Services, SimulationTimeEvent) * events,
+        CW(CW_root_Smp_Services, EventId) * eventIds,
+        Smp::UInt64 &added
+    ) override;
+
+private:
+    struct Event {
+        const Smp::IEntryPoint *entryPoint;
+        Smp::Duration time;
+        Smp::Duration cycleTime;
+        Smp::Int64 repeat;
+        std::uint64_t sequence;
+    };
+
+    /* Entry of the queue, stale once the event is removed or moved */
+    struct Due {
+        Smp::Duration time;
+        std::uint64_t sequence;
+        Smp::Services::EventId event;
+
+        bool operator>(const Due &other) const {
+            return time != other.time ? time > other.time : sequence > other.sequence;
+        }
+    };
+
+    Smp::Services::EventId Schedule(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration simulationTime,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    );
+    /* Schedule without restoring the heap order of the queue */
+    Smp::Services::EventId Insert(
+        const Smp::IEntryPoint *entryPoint,
+        Smp::Duration simulationTime,
+        Smp::Duration cycleTime,
+        Smp::Int64 repeat
+    );
+    Event &Lookup(Smp::Services::EventId event);
+    void Move(Smp::Services::EventId event, Smp::Duration simulationTime);
+    void DropStale() const;
+    void PushDue(const Due &due);
+    void PopDue() const;
+
+    TimeKeeper *timeKeeper;
+    std::unordered_map<Smp::Services::EventId, Event> events;
+    /* Min-heap on (time, sequence), kept with the std heap algorithms so that a batch heapifies once */
+    mutable std::vector<Due> queue;
+    Smp::Services::EventId nextEvent = 1;
+    Smp::Services::EventId currentEvent = -1;
+    std::uint64_t nextSequence = 0u;
+};
+
+class EventManager final : public ServiceBase<Smp::Services::IEventManager>, public CWraPPer::BatchEventManager {
+public:
+    EventManager(Smp::String8 name, Smp::String8 description, Smp::IObject *parent);
+
+    Smp::Services::EventId QueryEventId(Smp::String8 eventName) override;
+    void Subscribe(Smp::Services::EventId event, const Smp::IEntryPoint *entryPoint) override;
+    void Unsubscribe(Smp::Services::EventId event, const Smp::IEntryPoint *entryPoint) override;
+    void Emit(Smp::Services::EventId event, Smp::Bool synchronous = true) override;
+
+    /* One pass over the subscriber lists, copied into a single buffer reused for the whole batch */
+    void EmitMany(
+        Smp::UInt64 count,
+        const CW(CW_root_Smp_Services, EventId) * events,
+        Smp::Bool synchronous,
+        Smp::UInt64 &emitted
+    ) override;
+
+    /* Number of QueryEventId calls, to check the callers caching the ids */
+    std::uint64_t GetQueryCount() const {
+        return queryCount;
+    }
+
+private:
+    std::vector<const Smp::IEntryPoint *> &Subscribers(Smp::Services::EventId event);
+
+    std::unordered_map<std::string, Smp::Services::EventId> ids;
+    std::vector<std::vector<const Smp::IEntryPoint *>> subscribers;
+    std::uint64_t queryCount = 0u;
+};
+
+class Logger final : public ServiceBase<Smp::Services::ILogger> {
+public:
+    Logger(Smp::String8 name, Smp::String8 description, Smp::IObject *parent);
+
+    Smp::Services::LogMessageKind QueryLogMessageKind(Smp::String8 messageKindName) override;
+    void Log(const Smp::IObject *sender, Smp::String8 message, Smp::Services::LogMessageKind kind = 0) override;
+
+    /* Number of messages logged with the kind */
+    std::uint64_t GetCount(Smp::Services::LogMessageKind kind) const;
+
+    const std::string &GetLastMessage() const {
+        return lastMessage;
+    }
+
+    const Smp::IObject *GetLastSender() const {
+        return lastSender;
+    }
+
+    /* Number of QueryLogMessageKind calls, to check the callers caching the kinds */
+    std::uint64_t GetQueryCount() const {
+        return queryCount;
+    }
+
+private:
+    std::vector<std::string> kinds;
+    std::vector<std::uint64_t> counts;
+    std::string lastMessage;
+    const Smp::IObject *lastSender = nullptr;
+    std::uint64_t queryCount = 0u;
+};
+
+class Resolver final : public ServiceBase<Smp::Services::IResolver> {
+public:
+    /* Absolute paths start from root */
+    Resolver(Smp::String8 name, Smp::String8 description, Smp::IObject *parent, Smp::IObject *root);
+
+    Smp::IObject *ResolveAbsolute(Smp::String8 absolutePath) override;
+    Smp::IObject *ResolveRelative(Smp::String8 relativePath, Smp::IObject *relativeRoot) override;
+
+private:
+    Smp::IObject *root;
+};
+
+class LinkRegistry final : public ServiceBase<Smp::Services::ILinkRegistry> {
+public:
+    LinkRegistry(Smp::String8 name, Smp::String8 description, Smp::IObject *parent);
+
+    void AddLink(Smp::IComponent *source, const Smp::IComponent *target) override;
+    Smp::UInt32 GetLinkCount(const Smp::IComponent *source, const Smp::IComponent *target) const override;
+    Smp::Bool RemoveLink(Smp::IComponent *source, const Smp::IComponent *target) override;
+    const Smp::ComponentCollection *GetLinkSources(const Smp::IComponent *target) const override;
+    Smp::Bool CanRemove(const Smp::IComponent *target) override;
+    void RemoveLinks(const Smp::IComponent *target) override;
+
+private:
+    struct Target {
+        std::map<Smp::IComponent *, Smp::UInt32> counts;
+        Collection<Smp::IComponent> sources;
+    };
+
+    std::map<const Smp::IComponent *, std::unique_ptr<Target>> targets;
+    Collection<Smp::IComponent> noSources;
+};
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_STANDIN_SERVICES_H */
@@ -0,0 +1,411 @@
+/**
+ * Stand-in SMP simulator.
+ */
+#include "Simulator.h"
+#include <Smp/IComposite.h>
+#include <Smp/IPersist.h>
+#include <Smp/IStorageReader.h>
+#include <Smp/IStorageWriter.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace CWraPPer {
+namespace StandIn {
+
+namespace {
+
+const char *StateName(Smp::SimulatorStateKind state) {
+    switch (state) {
+        case Smp::SimulatorStateKind::SSK_Building:
+            return "Building";
+        case Smp::SimulatorStateKind::SSK_Connecting:
+            return "Connecting";
+        case Smp::SimulatorStateKind::SSK_Initialising:
+            return "Initialising";
+        case Smp::SimulatorStateKind::SSK_Standby:
+            return "Standby";
+        case Smp::SimulatorStateKind::SSK_Executing:
+            return "Executing";
+        case Smp::SimulatorStateKind::SSK_Storing:
+            return "Storing";
+        case Smp::SimulatorStateKind::SSK_Restoring:
+            return "Restoring";
+        case Smp::SimulatorStateKind::SSK_Reconnecting:
+            return "Reconnecting";
+        case Smp::SimulatorStateKind::SSK_Exiting:
+            return "Exiting";
+        default:
+            return "Aborting";
+    }
+}
+
+/* State vector file written with stdio */
+class File final : public Smp::IStorageWriter, public Smp::IStorageReader {
+public:
+    File(Smp::String8 fileName, const char *mode) :
+        fileName(fileName != nullptr ? fileName : ""),
+        file(std::fopen(this->fileName.c_str(), mode)) {
+        if (file == nullptr) {
+            throw std::runtime_error("Cannot open " + this->fileName + ": " + std::strerror(errno));
+        }
+    }
+
+    ~File() override {
+        if (file != nullptr) {
+            std::fclose(file);
+        }
+    }
+
+    File(const File &) = delete;
+    File &operator=(const File &) = delete;
+
+    void Store(const void *address, Smp::UInt64 size) override {
+        if (std::fwrite(address, 1u, static_cast<std::size_t>(size), file) != size) {
+            throw std::runtime_error("Cannot write to " + fileName);
+        }
+    }
+
+    void Restore(void *address, Smp::UInt64 size) override {
+        if (std::fread(address, 1u, static_cast<std::size_t>(size), file) != size) {
+            throw std::runtime_error("State vector file " + fileName + " ends too early");
+        }
+    }
+
+    Smp::String8 GetStateVectorFileName() const override {
+        return fileName.c_str();
+    }
+
+    Smp::String8 GetStateVectorFilePath() const override {
+        return "";
+    }
+
+    void Close() {
+        const int result = std::fclose(file);
+        file = nullptr;
+        if (result != 0) {
+            throw std::runtime_error("Cannot write to " + fileName);
+        }
+    }
+
+private:
+    std::string fileName;
+    std::FILE *file;
+};
+
+} /* namespace */
+
+Simulator::Simulator(Smp::String8 name, Smp::String8 description) :
+    name(name != nullptr ? name : ""),
+    description(description != nullptr ? description : ""),
+    modelContainer("Models", "Models of the simulation", this),
+    serviceContainer("Services", "Services of the simulation", this),
+    timeKeeper("TimeKeeper", "Stand-in time keeper", this),
+    scheduler("Scheduler", "Stand-in scheduler", this, &timeKeeper),
+    eventManager("EventManager", "Stand-in event manager", this),
+    logger("Logger", "Stand-in logger", this),
+    resolver("Resolver", "Stand-in resolver", this, this),
+    linkRegistry("LinkRegistry", "Stand-in link registry", this) {
+    containers.Add(&modelContainer);
+    containers.Add(&serviceContainer);
+    serviceContainer.AddComponent(&timeKeeper);
+    serviceContainer.AddComponent(&scheduler);
+    serviceContainer.AddComponent(&eventManager);
+    serviceContainer.AddComponent(&logger);
+    serviceContainer.AddComponent(&resolver);
+    serviceContainer.AddComponent(&linkRegistry);
+}
+
+Simulator::~Simulator() noexcept = default;
+
+void Simulator::Populate(
+    std::size_t modelCount,
+    std::size_t simpleFieldCount,
+    std::size_t arrayFieldCount,
+    Smp::UInt64 arraySize,
+    std::size_t childCount
+) {
+    for (std::size_t i = 0u; i < modelCount; ++i) {
+        const std::string modelName = "M" + std::to_string(i);
+        std::unique_ptr<Model> model(
+            new Model(modelName.c_str(), "", &modelContainer, simpleFieldCount, arrayFieldCount, arraySize));
+        for (std::size_t j = 0u; j < childCount; ++j) {
+            const std::string childName = "C" + std::to_string(j);
+            model->AddChildModel(std::unique_ptr<Model>(new Model(
+                childName.c_str(),
+                "",
+                model->GetContainer("Children"),
+                simpleFieldCount,
+                arrayFieldCount,
+                arraySize)));
+        }
+        AddOwnedModel(std::move(model));
+    }
+}
+
+Model *Simulator::AddOwnedModel(std::unique_ptr<Model> model) {
+    Model *added = model.get();
+    modelContainer.Own(std::move(model));
+    models.push_back(added);
+    if (state != Smp::SimulatorStateKind::SSK_Building) {
+        added->Publish(nullptr);
+        added->Configure(&logger, &linkRegistry);
+        added->Connect(this);
+    }
+    return added;
+}
+
+Smp::String8 Simulator::GetName() const {
+    return name.c_str();
+}
+
+Smp::String8 Simulator::GetDescription() const {
+    return description.c_str();
+}
+
+Smp::IObject *Simulator::GetParent() const {
+    return nullptr;
+}
+
+Smp::IObject *Simulator::GetChild(Smp::String8 name) const {
+    return containers.at(name);
+}
+
+const Smp::ContainerCollection *Simulator::GetContainers() const {
+    return &containers;
+}
+
+Smp::IContainer *Simulator::GetContainer(Smp::String8 name) const {
+    return containers.at(name);
+}
+
+void Simulator::Initialise() {
+    CheckState(Smp::SimulatorStateKind::SSK_Standby, "Initialise");
+    state = Smp::SimulatorStateKind::SSK_Initialising;
+    for (Smp::IEntryPoint *entryPoint : initEntryPoints) {
+        entryPoint->Execute();
+    }
+    state = Smp::SimulatorStateKind::SSK_Standby;
+}
+
+void Simulator::Publish() {
+    CheckState(Smp::SimulatorStateKind::SSK_Building, "Publish");
+    auto publish = [](Smp::IComponent *component) {
+        if (component->GetState() == Smp::ComponentStateKind::CSK_Created) {
+            component->Publish(nullptr);
+        }
+    };
+    ForEachComponent(serviceContainer, publish);
+    ForEachComponent(modelContainer, publish);
+}
+
+void Simulator::Configure() {
+    CheckState(Smp::SimulatorStateKind::SSK_Building, "Configure");
+    Publish();
+    auto configure = [this](Smp::IComponent *component) {
+        if (component->GetState() == Smp::ComponentStateKind::CSK_Publishing) {
+            component->Configure(&logger, &linkRegistry);
+        }
+    };
+    ForEachComponent(serviceContainer, configure);
+    ForEachComponent(modelContainer, configure);
+}
+
+void Simulator::Connect() {
+    CheckState(Smp::SimulatorStateKind::SSK_Building, "Connect");
+    Configure();
+    state = Smp::SimulatorStateKind::SSK_Connecting;
+    auto connect = [this](Smp::IComponent *component) {
+        component->Connect(this);
+    };
+    ForEachComponent(serviceContainer, connect);
+    ForEachComponent(modelContainer, connect);
+    state = Smp::SimulatorStateKind::SSK_Standby;
+    Initialise();
+}
+
+void Simulator::Run() {
+    CheckState(Smp::SimulatorStateKind::SSK_Standby, "Run");
+    state = Smp::SimulatorStateKind::SSK_Executing;
+    holding = false;
+    /* Hold stops the run between two simulation times */
+    for (Smp::Duration next = scheduler.GetNextScheduledEventTime(); !holding && next >= 0 && next <= stopTime;
+         next = scheduler.GetNextScheduledEventTime()) {
+        scheduler.Advance(next);
+    }
+    if (!holding) {
+        scheduler.Advance(stopTime);
+    }
+    state = Smp::SimulatorStateKind::SSK_Standby;
+}
+
+void Simulator::Hold(Smp::Bool) {
+    holding = true;
+}
+
+void Simulator::Store(Smp::String8 filename) {
+    CheckState(Smp::SimulatorStateKind::SSK_Standby, "Store");
+    state = Smp::SimulatorStateKind::SSK_Storing;
+    try {
+        File file(filename, "wb");
+        auto store = [&file](Smp::IComponent *component) {
+            if (Smp::IPersist *persist = dynamic_cast<Smp::IPersist *>(component)) {
+                persist->Store(&file);
+            }
+        };
+        ForEachComponent(modelContainer, store);
+        file.Close();
+    } catch (...) {
+        state = Smp::SimulatorStateKind::SSK_Standby;
+        throw;
+    }
+    state = Smp::SimulatorStateKind::SSK_Standby;
+}
+
+void Simulator::Restore(Smp::String8 filename) {
+    CheckState(Smp::SimulatorStateKind::SSK_Standby, "Restore");
+    state = Smp::SimulatorStateKind::SSK_Restoring;
+    try {
+        File file(filename, "rb");
+        auto restore = [&file](Smp::IComponent *component) {
+            if (Smp::IPersist *persist = dynamic_cast<Smp::IPersist *>(component)) {
+                persist->Restore(&file);
+            }
+        };
+        ForEachComponent(modelContainer, restore);
+    } catch (...) {
+        state = Smp::SimulatorStateKind::SSK_Standby;
+        throw;
+    }
+    state = Smp::SimulatorStateKind::SSK_Standby;
+}
+
+void Simulator::Reconnect(Smp::IComponent *root) {
+    CheckState(Smp::SimulatorStateKind::SSK_Standby, "Reconnect");
+    state = Smp::SimulatorStateKind::SSK_Reconnecting;
+    root->Connect(this);
+    if (const Smp::IComposite *composite = dynamic_cast<const Smp::IComposite *>(root)) {
+        auto connect = [this](Smp::IComponent *component) {
+            component->Connect(this);
+        };
+        for (Smp::IContainer *container : *composite->GetContainers()) {
+            ForEachComponent(*container, connect);
+        }
+    }
+    state = Smp::SimulatorStateKind::SSK_Standby;
+}
+
+void Simulator::Exit() {
+    CheckState(Smp::SimulatorStateKind::SSK_Standby, "Exit");
+    state = Smp::SimulatorStateKind::SSK_Exiting;
+}
+
+void Simulator::Abort() {
+    state = Smp::SimulatorStateKind::SSK_Aborting;
+}
+
+Smp::SimulatorStateKind Simulator::GetState() const {
+    return state;
+}
+
+void Simulator::AddInitEntryPoint(Smp::IEntryPoint *entryPoint) {
+    initEntryPoints.push_back(entryPoint);
+}
+
+void Simulator::AddModel(Smp::IModel *model) {
+    modelContainer.AddComponent(model);
+    if (Model *standIn = dynamic_cast<Model *>(model)) {
+        models.push_back(standIn);
+    }
+    if (state != Smp::SimulatorStateKind::SSK_Building) {
+        model->Publish(nullptr);
+        model->Configure(&logger, &linkRegistry);
+        model->Connect(this);
+    }
+}
+
+void Simulator::AddService(Smp::IService *service) {
+    serviceContainer.AddComponent(service);
+    if (state != Smp::SimulatorStateKind::SSK_Building) {
+        service->Publish(nullptr);
+        service->Configure(&logger, &linkRegistry);
+        service->Connect(this);
+    }
+}
+
+Smp::IService *Simulator::GetService(Smp::String8 name) const {
+    return dynamic_cast<Smp::IService *>(serviceContainer.GetComponent(name));
+}
+
+Smp::Services::ILogger *Simulator::GetLogger() const {
+    return const_cast<Logger *>(&logger);
+}
+
+Smp::Services::ITimeKeeper *Simulator::GetTimeKeeper() const {
+    return const_cast<TimeKeeper *>(&timeKeeper);
+}
+
+Smp::Services::IScheduler *Simulator::GetScheduler() const {
+    return const_cast<Scheduler *>(&scheduler);
+}
+
+Smp::Services::IEventManager *Simulator::GetEventManager() const {
+    return const_cast<EventManager *>(&eventManager);
+}
+
+Smp::Services::IResolver *Simulator::GetResolver() const {
+    return const_cast<Resolver *>(&resolver);
+}
+
+Smp::Services::ILinkRegistry *Simulator::GetLinkRegistry() const {
+    return const_cast<LinkRegistry *>(&linkRegistry);
+}
+
+void Simulator::RegisterFactory(Smp::IFactory *) {
+    throw std::logic_error("The stand-in simulator does not support factories");
+}
+
+Smp::IComponent *Simulator::CreateInstance(const Smp::Uuid &, Smp::String8, Smp::String8, Smp::IComposite *) {
+    throw std::logic_error("The stand-in simulator does not support factories");
+}
+
+Smp::IFactory *Simulator::GetFactory(const Smp::Uuid &) const {
+    return nullptr;
+}
+
+const Smp::FactoryCollection *Simulator::GetFactories() const {
+    return &factories;
+}
+
+Smp::Publication::ITypeRegistry *Simulator::GetTypeRegistry() const {
+    return nullptr;
+}
+
+void Simulator::LoadLibrary(Smp::String8, Smp::LibraryLoadingFlag) {
+    throw std::logic_error("The stand-in simulator does not load libraries");
+}
+
+void Simulator::CheckState(Smp::SimulatorStateKind expected, const char *operation) const {
+    if (state != expected) {
+        throw std::logic_error(
+            std::string(operation) + " called in the " + StateName(state) + " state instead of "
+                + StateName(expected));
+    }
+}
+
+template <typename Visit>
+void Simulator::ForEachComponent(const Smp::IContainer &container, Visit &visit) {
+    for (Smp::IComponent *component : *container.GetComponents()) {
+        visit(component);
+        if (const Smp::IComposite *composite = dynamic_cast<const Smp::IComposite *>(component)) {
+            for (Smp::IContainer *child : *composite->GetContainers()) {
+                ForEachComponent(*child, visit);
+            }
+        }
+    }
+}
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
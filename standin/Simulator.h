@@ -0,0 +1,153 @@
+/**
+ * Stand-in SMP simulator.
+ *
+ * Hosts the stand-in services in its "Services" container and the models
+ * in its "Models" container, and follows the SMP state machine: Publish,
+ * Configure and Connect walk every model, Run advances the scheduler up
+ * to the stop time, Store and Restore write every IPersist component to
+ * a plain file. Factories, the type registry and libraries are not
+ * supported: CreateInstance and LoadLibrary throw.
+ *
+ * Populate builds a simulation of the size of a real one, thousands of
+ * models with tens of thousands of fields, for the tests and benchmarks.
+ */
+#ifndef CWRAPPER_STANDIN_SIMULATOR_H
+#define CWRAPPER_STANDIN_SIMULATOR_H
+
+#include "Collection.h"
+#include "Model.h"
+#include "Services.h"
+#include <Smp/IFactory.h>
+#include <Smp/IService.h>
+#include <Smp/ISimulator.h>
+#include <Smp/LibraryLoadingFlag.h>
+#include <Smp/SimulatorStateKind.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CWraPPer {
+namespace StandIn {
+
+class Simulator final : public Smp::ISimulator {
+public:
+    explicit Simulator(Smp::String8 name = "Simulator", Smp::String8 description = "Stand-in SMP simulator");
+    ~Simulator() noexcept override;
+
+    /*
+     * Adds modelCount models M0, M1... of simpleFieldCount Float64 fields
+     * and arrayFieldCount Float64 arrays of arraySize items each, with
+     * childCount nested models C0, C1... of the same fields
+     */
+    void Populate(
+        std::size_t modelCount,
+        std::size_t simpleFieldCount,
+        std::size_t arrayFieldCount,
+        Smp::UInt64 arraySize,
+        std::size_t childCount = 0u
+    );
+
+    /* Adds a model owned by the simulator */
+    Model *AddOwnedModel(std::unique_ptr<Model> model);
+
+    /* Run executes the events up to the stop time */
+    void SetStopTime(Smp::Duration stopTime) {
+        this->stopTime = stopTime;
+    }
+
+    const std::vector<Model *> &GetModels() const {
+        return models;
+    }
+
+    TimeKeeper *GetStandInTimeKeeper() {
+        return &timeKeeper;
+    }
+
+    Scheduler *GetStandInScheduler() {
+        return &scheduler;
+    }
+
+    EventManager *GetStandInEventManager() {
+        return &eventManager;
+    }
+
+    Logger *GetStandInLogger() {
+        return &logger;
+    }
+
+    /* IObject */
+    Smp::String8 GetName() const override;
+    Smp::String8 GetDescription() const override;
+    Smp::IObject *GetParent() const override;
+    Smp::IObject *GetChild(Smp::String8 name) const override;
+
+    /* IComposite */
+    const Smp::ContainerCollection *GetContainers() const override;
+    Smp::IContainer *GetContainer(Smp::String8 name) const override;
+
+    /* ISimulator */
+    void Initialise() override;
+    void Publish() override;
+    void Configure() override;
+    void Connect() override;
+    void Run() override;
+    void Hold(Smp::Bool immediate) override;
+    void Store(Smp::String8 filename) override;
+    void Restore(Smp::String8 filename) override;
+    void Reconnect(Smp::IComponent *root) override;
+    void Exit() override;
+    void Abort() override;
+    Smp::SimulatorStateKind GetState() const override;
+    void AddInitEntryPoint(Smp::IEntryPoint *entryPoint) override;
+    void AddModel(Smp::IModel *model) override;
+    void AddService(Smp::IService *service) override;
+    Smp::IService *GetService(Smp::String8 name) const override;
+    Smp::Services::ILogger *GetLogger() const override;
+    Smp::Services::ITimeKeeper *GetTimeKeeper() const override;
+    Smp::Services::IScheduler *GetScheduler() const override;
+    Smp::Services::IEventManager *GetEventManager() const override;
+    Smp::Services::IResolver *GetResolver() const override;
+    Smp::Services::ILinkRegistry *GetLinkRegistry() const override;
+    void RegisterFactory(Smp::IFactory *componentFactory) override;
+    Smp::IComponent *CreateInstance(
+        const Smp::Uuid &uuid,
+        Smp::String8 name,
+        Smp::String8 description,
+        Smp::IComposite *parent
+    ) override;
+    Smp::IFactory *GetFactory(const Smp::Uuid &uuid) const override;
+    const Smp::FactoryCollection *GetFactories() const override;
+    Smp::Publication::ITypeRegistry *GetTypeRegistry() const override;
+    void LoadLibrary(Smp::String8 libraryPath, Smp::LibraryLoadingFlag flag) override;
+
+private:
+    void CheckState(Smp::SimulatorStateKind expected, const char *operation) const;
+
+    /* Calls visit on every component of the container and below, depth first */
+    template <typename Visit>
+    static void ForEachComponent(const Smp::IContainer &container, Visit &visit);
+
+    std::string name;
+    std::string description;
+    Smp::SimulatorStateKind state = Smp::SimulatorStateKind::SSK_Building;
+    Container modelContainer;
+    Container serviceContainer;
+    Collection<Smp::IContainer> containers;
+    TimeKeeper timeKeeper;
+    Scheduler scheduler;
+    EventManager eventManager;
+    Logger logger;
+    Resolver resolver;
+    LinkRegistry linkRegistry;
+    std::vector<Smp::IEntryPoint *> initEntryPoints;
+    std::vector<Model *> models;
+    Collection<Smp::IFactory> factories;
+    Smp::Duration stopTime = 0;
+    bool holding = false;
+};
+
+} /* namespace StandIn */
+} /* namespace CWraPPer */
+
+#endif /* CWRAPPER_STANDIN_SIMULATOR_H */
@@ -0,0 +1,20 @@
+/**
+ * Minimal test harness, for C and C++ tests.
+ *
+ * CHECK reports a failed condition and goes on; main returns
+ * CHECK_RESULT(), non-zero if any check failed.
+ */
+#ifndef CWRAPPER_TESTS_CHECK_H
+#define CWRAPPER_TESTS_CHECK_H
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(condition) \
+    ((condition) ? (void) 0 : (void) (++checkFailures, \
+        fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition)))
+
+#define CHECK_RESULT() (checkFailures == 0 ? 0 : 1)
+
+#endif /* CWRAPPER_TESTS_CHECK_H */
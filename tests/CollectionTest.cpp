@@ -0,0 +1,95 @@
+/**
+ * Collection thunks: Size and ToArray see the elements in order, ToArray
+ * writing no more than the capacity it is given; Begin and Next walk the
+ * elements present when the walk started, At and AtString8 find one.
+ */
+#include "Check.h"
+#include "Collection.h"
+#include "Fields.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/FieldCollection.h"
+#include <Smp/IField.h>
+#include <cstddef>
+
+namespace {
+
+using CWraPPer::StandIn::Collection;
+using CWraPPer::StandIn::SimpleField;
+
+const Smp::PrimitiveTypeKind kind = Smp::PrimitiveTypeKind::PTK_Int32;
+
+void TestSizeAndToArray() {
+    SimpleField a("A", "", nullptr, kind);
+    SimpleField b("B", "", nullptr, kind);
+    SimpleField c("C", "", nullptr, kind);
+    Collection<Smp::IField> collection;
+    const Smp::FieldCollection *fields = &collection;
+    CHECK(root_Smp_FieldCollection_Size(fields) == 0u);
+    CHECK(root_Smp_FieldCollection_ToArray(fields, 4u, nullptr) == 0u);
+
+    collection.Add(&a);
+    collection.Add(&b);
+    collection.Add(&c);
+    CHECK(root_Smp_FieldCollection_Size(fields) == 3u);
+
+    root_Smp_IField *items[4] = {};
+    CHECK(root_Smp_FieldCollection_ToArray(fields, 4u, items) == 3u);
+    CHECK(items[0] == static_cast<Smp::IField *>(&a));
+    CHECK(items[1] == static_cast<Smp::IField *>(&b));
+    CHECK(items[2] == static_cast<Smp::IField *>(&c));
+    CHECK(items[3] == nullptr);
+
+    /* A short array gets the first elements only */
+    root_Smp_IField *first[4] = {};
+    CHECK(root_Smp_FieldCollection_ToArray(fields, 2u, first) == 2u);
+    CHECK(first[0] == static_cast<Smp::IField *>(&a));
+    CHECK(first[1] == static_cast<Smp::IField *>(&b));
+    CHECK(first[2] == nullptr);
+    CHECK(root_Smp_FieldCollection_ToArray(fields, 0u, first) == 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+void TestIterator() {
+    SimpleField a("A", "", nullptr, kind);
+    SimpleField b("B", "", nullptr, kind);
+    SimpleField c("C", "", nullptr, kind);
+    Collection<Smp::IField> collection;
+    const Smp::FieldCollection *fields = &collection;
+    root_Smp_CollectionIterator iterator;
+    root_Smp_FieldCollection_Begin(fields, &iterator);
+    CHECK(root_Smp_FieldCollection_Empty(fields));
+    CHECK(root_Smp_FieldCollection_Next(&iterator) == nullptr);
+
+    collection.Add(&a);
+    collection.Add(&b);
+    root_Smp_FieldCollection_Begin(fields, &iterator);
+    CHECK(!root_Smp_FieldCollection_Empty(fields));
+    CHECK(root_Smp_FieldCollection_Next(&iterator) == static_cast<Smp::IField *>(&a));
+
+    /* An element added during the walk is not seen by it */
+    collection.Add(&c);
+    CHECK(root_Smp_FieldCollection_Next(&iterator) == static_cast<Smp::IField *>(&b));
+    CHECK(root_Smp_FieldCollection_Next(&iterator) == nullptr);
+    CHECK(root_Smp_FieldCollection_Next(&iterator) == nullptr);
+
+    root_Smp_FieldCollection_Begin(fields, &iterator);
+    std::size_t count = 0u;
+    while (root_Smp_FieldCollection_Next(&iterator) != nullptr) {
+        ++count;
+    }
+    CHECK(count == 3u);
+
+    CHECK(root_Smp_FieldCollection_At(fields, 2u) == static_cast<Smp::IField *>(&c));
+    CHECK(root_Smp_FieldCollection_At(fields, 3u) == nullptr);
+    CHECK(root_Smp_FieldCollection_AtString8(fields, "B") == static_cast<Smp::IField *>(&b));
+    CHECK(root_Smp_FieldCollection_AtString8(fields, "D") == nullptr);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+} /* namespace */
+
+int main() {
+    TestSizeAndToArray();
+    TestIterator();
+    return CHECK_RESULT();
+}
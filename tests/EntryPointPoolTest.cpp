@@ -0,0 +1,162 @@
+/**
+ * EntryPointPool: C entry points call their function with their user
+ * data, across several slabs, are reused once released, and subscribe to
+ * the events of an event manager, emitted in batches.
+ */
+#include "Check.h"
+#include "ServiceBase.h"
+#include "Simulator.h"
+#include "Smp-C/EntryPointPool.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/IEntryPoint.h"
+#include "Smp-C/Services/BatchEventManager.h"
+#include "Smp-C/Services/IEventManager.h"
+#include <Smp/IEntryPoint.h>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using CWraPPer::StandIn::Simulator;
+
+void Increment(void *userData) {
+    ++*static_cast<int *>(userData);
+}
+
+void TestAcquireRelease() {
+    root_Smp_EntryPointPool *pool = root_Smp_EntryPointPool_Create(16u);
+    const std::size_t count = 1000u;
+    std::vector<int> counters(count, 0);
+    std::vector<root_Smp_EntryPointDefinition> definitions(count);
+    for (std::size_t i = 0u; i < count; ++i) {
+        definitions[i] = {&Increment, &counters[i], "Increment", "Adds one to its counter"};
+    }
+    std::vector<root_Smp_IEntryPoint *> entryPoints(count);
+    CHECK(root_Smp_EntryPointPool_AcquireBatch(pool, count, definitions.data(), nullptr, entryPoints.data()) == count);
+    for (std::size_t i = 0u; i < count; ++i) {
+        root_Smp_IEntryPoint_Execute(entryPoints[i]);
+        root_Smp_IEntryPoint_Execute(entryPoints[i]);
+    }
+    bool allTwice = true;
+    for (int counter : counters) {
+        allTwice = allTwice && counter == 2;
+    }
+    CHECK(allTwice);
+    CHECK(std::strcmp(static_cast<Smp::IEntryPoint *>(entryPoints[7])->GetName(), "Increment") == 0);
+
+    /* Released entry points are handed out again */
+    root_Smp_IEntryPoint *released = entryPoints[500];
+    root_Smp_EntryPointPool_Release(pool, released);
+    root_Smp_IEntryPoint *reused = root_Smp_EntryPointPool_Acquire(pool, &definitions[0], nullptr);
+    CHECK(reused == released);
+    root_Smp_IEntryPoint_Execute(reused);
+    CHECK(counters[0] == 3);
+    entryPoints[500] = reused;
+
+    /* NULL is ignored, alone or in a batch */
+    root_Smp_EntryPointPool_Release(pool, nullptr);
+    root_Smp_EntryPointPool_Release(pool, entryPoints[10]);
+    entryPoints[10] = nullptr;
+    root_Smp_EntryPointPool_ReleaseBatch(pool, count, entryPoints.data());
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    root_Smp_EntryPointPool_Destroy(pool);
+}
+
+void TestSubscribe() {
+    Simulator simulator;
+    root_Smp_Services_IEventManager *eventManager = simulator.GetEventManager();
+    const root_Smp_Services_EventId event = root_Smp_Services_IEventManager_QueryEventId(eventManager, "Tick");
+    root_Smp_EntryPointPool *pool = root_Smp_EntryPointPool_Create(0u);
+    int counter = 0;
+    const root_Smp_EntryPointDefinition definition = {&Increment, &counter, "OnTick", ""};
+    root_Smp_IEntryPoint *first = root_Smp_EntryPointPool_Subscribe(pool, eventManager, event, &definition, nullptr);
+    root_Smp_IEntryPoint *second = root_Smp_EntryPointPool_Subscribe(pool, eventManager, event, &definition, nullptr);
+    CHECK(first != nullptr && second != nullptr && first != second);
+    const root_Smp_Services_EventId events[] = {event, event, event};
+    CHECK(root_Smp_Services_IEventManager_EmitMany(eventManager, 3u, events, true) == 3u);
+    CHECK(counter == 6);
+    root_Smp_EntryPointPool_Unsubscribe(pool, eventManager, event, first);
+    root_Smp_Services_IEventManager_Emit(eventManager, event, true);
+    CHECK(counter == 7);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+
+    /* An unknown event: nothing is subscribed, the error of the event manager is recorded */
+    CHECK(root_Smp_EntryPointPool_Subscribe(pool, eventManager, 999, &definition, nullptr) == nullptr);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_EntryPointPool_Unsubscribe(pool, eventManager, event, second);
+    root_Smp_EntryPointPool_Destroy(pool);
+}
+
+/* An event manager without the batch interface, forwarding to the stand-in and counting the Emit calls */
+class LoopEventManager final : public CWraPPer::ServiceBase<Smp::Services::IEventManager> {
+public:
+    explicit LoopEventManager(Smp::Services::IEventManager *target) :
+        ServiceBase("LoopEventManager", "", nullptr),
+        target(target) {
+    }
+
+    Smp::Services::EventId QueryEventId(Smp::String8 eventName) override {
+        return target->QueryEventId(eventName);
+    }
+
+    void Subscribe(Smp::Services::EventId event, const Smp::IEntryPoint *entryPoint) override {
+        target->Subscribe(event, entryPoint);
+    }
+
+    void Unsubscribe(Smp::Services::EventId event, const Smp::IEntryPoint *entryPoint) override {
+        target->Unsubscribe(event, entryPoint);
+    }
+
+    void Emit(Smp::Services::EventId event, Smp::Bool synchronous) override {
+        ++emitCount;
+        target->Emit(event, synchronous);
+    }
+
+    std::size_t emitCount = 0u;
+
+private:
+    Smp::Services::IEventManager *target;
+};
+
+/* EmitMany takes the batch of the stand-in at once, and loops over Emit for any other event manager */
+void TestEmitMany() {
+    Simulator simulator;
+    Smp::Services::IEventManager *standIn = simulator.GetEventManager();
+    CHECK(dynamic_cast<CWraPPer::BatchEventManager *>(standIn) != nullptr);
+    root_Smp_EntryPointPool *pool = root_Smp_EntryPointPool_Create(0u);
+    int ticks = 0;
+    int tocks = 0;
+    const root_Smp_EntryPointDefinition onTick = {&Increment, &ticks, "OnTick", ""};
+    const root_Smp_EntryPointDefinition onTock = {&Increment, &tocks, "OnTock", ""};
+    const root_Smp_Services_EventId tick = root_Smp_Services_IEventManager_QueryEventId(standIn, "Tick");
+    const root_Smp_Services_EventId tock = root_Smp_Services_IEventManager_QueryEventId(standIn, "Tock");
+    root_Smp_IEntryPoint *tickEntryPoint = root_Smp_EntryPointPool_Subscribe(pool, standIn, tick, &onTick, nullptr);
+    root_Smp_IEntryPoint *tockEntryPoint = root_Smp_EntryPointPool_Subscribe(pool, standIn, tock, &onTock, nullptr);
+
+    /* The batch stops at the unknown event, after emitting the ones before it */
+    const root_Smp_Services_EventId events[] = {tick, tock, tick, 999, tock};
+    CHECK(root_Smp_Services_IEventManager_EmitMany(standIn, 5u, events, true) == 3u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(ticks == 2 && tocks == 1);
+
+    LoopEventManager loop(standIn);
+    CHECK(root_Smp_Services_IEventManager_EmitMany(static_cast<Smp::Services::IEventManager *>(&loop), 3u, events, true)
+        == 3u);
+    CHECK(loop.emitCount == 3u);
+    CHECK(ticks == 4 && tocks == 2);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    root_Smp_EntryPointPool_Unsubscribe(pool, standIn, tick, tickEntryPoint);
+    root_Smp_EntryPointPool_Unsubscribe(pool, standIn, tock, tockEntryPoint);
+    root_Smp_EntryPointPool_Destroy(pool);
+}
+
+} /* namespace */
+
+int main() {
+    TestAcquireRelease();
+    TestSubscribe();
+    TestEmitMany();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,75 @@
+/**
+ * FieldHandle: a handle resolved once from a field name reads and writes
+ * the field through the typed accessors, converting between kinds like
+ * AnySimple does, and only simple fields resolve.
+ */
+#include "Check.h"
+#include "Simulator.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/FieldHandle.h"
+#include <Smp/ISimpleField.h>
+
+namespace {
+
+using CWraPPer::StandIn::Model;
+using CWraPPer::StandIn::Simulator;
+
+void TestResolve() {
+    Simulator simulator;
+    simulator.Populate(1u, 2u, 1u, 4u);
+    Model *model = simulator.GetModels()[0];
+    root_Smp_FieldHandle handle;
+    CHECK(root_Smp_FieldHandle_Resolve(&handle, static_cast<Smp::IComponent *>(model), "F1"));
+    CHECK(handle.field == dynamic_cast<Smp::ISimpleField *>(model->GetField("F1")));
+    CHECK(handle.kind == static_cast<root_Smp_PrimitiveTypeKind>(Smp::PrimitiveTypeKind::PTK_Float64));
+
+    /* An array field or an unknown name leaves an empty handle */
+    CHECK(!root_Smp_FieldHandle_Resolve(&handle, static_cast<Smp::IComponent *>(model), "A0"));
+    CHECK(handle.field == nullptr);
+    CHECK(!root_Smp_FieldHandle_Resolve(&handle, static_cast<Smp::IComponent *>(model), "Missing"));
+    CHECK(handle.field == nullptr);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+void TestTypedAccess() {
+    Simulator simulator;
+    simulator.Populate(1u, 1u, 0u, 0u);
+    Model *model = simulator.GetModels()[0];
+    model->AddSimpleField("Count", Smp::PrimitiveTypeKind::PTK_Int32);
+    model->AddSimpleField("Flag", Smp::PrimitiveTypeKind::PTK_Bool);
+    Smp::IComponent *component = model;
+
+    root_Smp_FieldHandle value;
+    CHECK(root_Smp_FieldHandle_Resolve(&value, component, "F0"));
+    root_Smp_FieldHandle_SetFloat64(&value, 3.5);
+    CHECK(root_Smp_FieldHandle_GetFloat64(&value) == 3.5);
+    model->GetStep()->Execute();
+    CHECK(root_Smp_FieldHandle_GetFloat64(&value) == 4.5);
+
+    root_Smp_FieldHandle count;
+    CHECK(root_Smp_FieldHandle_Resolve(&count, component, "Count"));
+    root_Smp_FieldHandle_SetInt32(&count, -7);
+    CHECK(root_Smp_FieldHandle_GetInt32(&count) == -7);
+    CHECK(root_Smp_FieldHandle_GetInt64(&count) == -7);
+    CHECK(static_cast<Smp::Int32>(dynamic_cast<Smp::ISimpleField *>(model->GetField("Count"))->GetValue()) == -7);
+
+    root_Smp_FieldHandle flag;
+    CHECK(root_Smp_FieldHandle_Resolve(&flag, component, "Flag"));
+    root_Smp_FieldHandle_SetBool(&flag, true);
+    CHECK(root_Smp_FieldHandle_GetBool(&flag));
+
+    /* The step counter, written by the model itself */
+    root_Smp_FieldHandle steps;
+    CHECK(root_Smp_FieldHandle_Resolve(&steps, component, "Steps"));
+    model->GetStep()->Execute();
+    CHECK(root_Smp_FieldHandle_GetInt64(&steps) == 2);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+} /* namespace */
+
+int main() {
+    TestResolve();
+    TestTypedAccess();
+    return CHECK_RESULT();
+}
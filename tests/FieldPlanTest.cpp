@@ -0,0 +1,152 @@
+/**
+ * FieldPlan: fields are laid out in the given order at their natural
+ * alignment, Read and Write copy every value through the caller buffer,
+ * and both return how many fields they processed when one fails.
+ */
+#include "Check.h"
+#include "Fields.h"
+#include "Simulator.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/FieldHandle.h"
+#include "Smp-C/FieldPlan.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+using CWraPPer::StandIn::FieldBase;
+using CWraPPer::StandIn::Model;
+using CWraPPer::StandIn::Simulator;
+
+/* An Int32 field failing every access */
+class BrokenField final : public FieldBase<Smp::ISimpleField> {
+public:
+    BrokenField() :
+        FieldBase("Broken", "", nullptr) {
+    }
+
+    Smp::PrimitiveTypeKind GetPrimitiveTypeKind() const override {
+        return Smp::PrimitiveTypeKind::PTK_Int32;
+    }
+
+    Smp::AnySimple GetValue() const override {
+        throw std::runtime_error("Broken field");
+    }
+
+    void SetValue(const Smp::AnySimple &) override {
+        throw std::runtime_error("Broken field");
+    }
+
+    void Restore(Smp::IStorageReader *) override {
+    }
+
+    void Store(Smp::IStorageWriter *) override {
+    }
+};
+
+Model *MakeModel(Simulator &simulator) {
+    simulator.Populate(1u, 1u, 1u, 4u);
+    Model *model = simulator.GetModels()[0];
+    model->AddSimpleField("Flag", Smp::PrimitiveTypeKind::PTK_Bool);
+    model->AddSimpleField("Small", Smp::PrimitiveTypeKind::PTK_Int16);
+    model->AddSimpleField("Ratio", Smp::PrimitiveTypeKind::PTK_Float32);
+    model->AddSimpleField("Delay", Smp::PrimitiveTypeKind::PTK_Duration);
+    return model;
+}
+
+void TestLayout() {
+    Simulator simulator;
+    Model *model = MakeModel(simulator);
+    const root_Smp_String8 names[] = {"Flag", "F0", "Small", "Ratio", "Delay"};
+    root_Smp_FieldPlan *plan = root_Smp_FieldPlan_CreateFromPaths(static_cast<Smp::IComponent *>(model), 5u, names);
+    CHECK(plan != nullptr);
+    CHECK(root_Smp_FieldPlan_GetCount(plan) == 5u);
+    CHECK(root_Smp_FieldPlan_GetOffset(plan, 0u) == 0u);
+    CHECK(root_Smp_FieldPlan_GetOffset(plan, 1u) == 8u);
+    CHECK(root_Smp_FieldPlan_GetOffset(plan, 2u) == 16u);
+    CHECK(root_Smp_FieldPlan_GetOffset(plan, 3u) == 20u);
+    CHECK(root_Smp_FieldPlan_GetOffset(plan, 4u) == 24u);
+    CHECK(root_Smp_FieldPlan_GetSize(plan) == 32u);
+    CHECK(root_Smp_FieldPlan_GetOffset(plan, 5u) == 32u);
+    root_Smp_FieldPlan_Destroy(plan);
+
+    /* A missing field or an array field has no place in a plan */
+    const root_Smp_String8 missing[] = {"F0", "Missing"};
+    CHECK(root_Smp_FieldPlan_CreateFromPaths(static_cast<Smp::IComponent *>(model), 2u, missing) == nullptr);
+    const root_Smp_String8 array[] = {"A0"};
+    CHECK(root_Smp_FieldPlan_CreateFromPaths(static_cast<Smp::IComponent *>(model), 1u, array) == nullptr);
+    root_Smp_ExceptionRecord_Clear();
+}
+
+void TestReadWrite() {
+    Simulator simulator;
+    Model *model = MakeModel(simulator);
+    Smp::IComponent *component = model;
+    const root_Smp_String8 names[] = {"Flag", "F0", "Small", "Steps"};
+    root_Smp_FieldHandle handles[4];
+    for (std::size_t i = 0u; i < 4u; ++i) {
+        CHECK(root_Smp_FieldHandle_Resolve(&handles[i], component, names[i]));
+    }
+    root_Smp_FieldPlan *plan = root_Smp_FieldPlan_Create(4u, handles);
+    CHECK(plan != nullptr);
+    CHECK(root_Smp_FieldPlan_GetSize(plan) == 32u);
+
+    unsigned char buffer[32] = {};
+    const Smp::Bool flag = true;
+    const Smp::Float64 value = 2.25;
+    const Smp::Int16 small = -300;
+    const Smp::Int64 steps = 41;
+    std::memcpy(buffer + 0, &flag, sizeof(flag));
+    std::memcpy(buffer + 8, &value, sizeof(value));
+    std::memcpy(buffer + 16, &small, sizeof(small));
+    std::memcpy(buffer + 24, &steps, sizeof(steps));
+    CHECK(root_Smp_FieldPlan_Write(plan, buffer) == 4u);
+    CHECK(root_Smp_FieldHandle_GetBool(&handles[0]));
+    CHECK(root_Smp_FieldHandle_GetFloat64(&handles[1]) == 2.25);
+    CHECK(root_Smp_FieldHandle_GetInt16(&handles[2]) == -300);
+    CHECK(model->GetStepCount() == 41);
+
+    model->GetStep()->Execute();
+    unsigned char read[32] = {};
+    CHECK(root_Smp_FieldPlan_Read(plan, read) == 4u);
+    Smp::Float64 readValue = 0.0;
+    Smp::Int64 readSteps = 0;
+    std::memcpy(&readValue, read + 8, sizeof(readValue));
+    std::memcpy(&readSteps, read + 24, sizeof(readSteps));
+    CHECK(read[0] == buffer[0]);
+    CHECK(readValue == 3.25);
+    CHECK(std::memcmp(read + 16, buffer + 16, sizeof(small)) == 0);
+    CHECK(readSteps == 42);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    root_Smp_FieldPlan_Destroy(plan);
+}
+
+/* A failing field stops Read and Write, which count the fields before it */
+void TestFailure() {
+    Simulator simulator;
+    Model *model = MakeModel(simulator);
+    BrokenField broken;
+    root_Smp_FieldHandle handles[3];
+    CHECK(root_Smp_FieldHandle_Resolve(&handles[0], static_cast<Smp::IComponent *>(model), "F0"));
+    CHECK(root_Smp_FieldHandle_FromField(&handles[1], static_cast<Smp::IField *>(&broken)));
+    CHECK(root_Smp_FieldHandle_Resolve(&handles[2], static_cast<Smp::IComponent *>(model), "Small"));
+    root_Smp_FieldPlan *plan = root_Smp_FieldPlan_Create(3u, handles);
+    CHECK(plan != nullptr);
+    unsigned char buffer[16] = {};
+    CHECK(root_Smp_FieldPlan_Read(plan, buffer) == 1u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_FieldPlan_Write(plan, buffer) == 1u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_FieldPlan_Destroy(plan);
+}
+
+} /* namespace */
+
+int main() {
+    TestLayout();
+    TestReadWrite();
+    TestFailure();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,82 @@
+/**
+ * ForkSnapshot, from C: results and exit status of every branch.
+ */
+#include "Check.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/ForkSnapshot.h"
+#include <signal.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#define BRANCH_COUNT 40u
+#define LARGE_SIZE (1u << 20u)
+
+static char large[LARGE_SIZE];
+
+int main(void) {
+    root_Smp_ForkSnapshot *snapshot = root_Smp_ForkSnapshot_Create(4u);
+    root_Smp_UInt64 branch;
+    root_Smp_UInt64 i;
+    struct rlimit limit;
+    struct rlimit lowered;
+    CHECK(snapshot != NULL);
+    CHECK(root_Smp_ForkSnapshot_GetBranch(snapshot) == 0u);
+
+    memset(large, 'x', sizeof(large));
+    branch = root_Smp_ForkSnapshot_Branch(snapshot, BRANCH_COUNT);
+    CHECK(branch != UINT64_MAX);
+    if (branch != 0u && branch != UINT64_MAX) {
+        /* Child: the last branch sends more than a pipe holds, another one is killed */
+        if (branch == BRANCH_COUNT) {
+            root_Smp_ForkSnapshot_Send(snapshot, large, sizeof(large));
+        } else if (branch == 2u) {
+            kill(getpid(), SIGKILL);
+        } else {
+            root_Smp_ForkSnapshot_Send(snapshot, &branch, sizeof(branch));
+        }
+        root_Smp_ForkSnapshot_Exit(snapshot, (root_Smp_Int32) (branch % 7u));
+    }
+
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+    for (i = 1u; i <= BRANCH_COUNT; ++i) {
+        const root_Smp_UInt64 size = root_Smp_ForkSnapshot_GetResultSize(snapshot, i);
+        const void *result = root_Smp_ForkSnapshot_GetResult(snapshot, i);
+        if (i == BRANCH_COUNT) {
+            CHECK(size == LARGE_SIZE);
+            CHECK(memcmp(result, large, LARGE_SIZE) == 0);
+            CHECK(root_Smp_ForkSnapshot_GetExitStatus(snapshot, i) == (root_Smp_Int32) (i % 7u));
+        } else if (i == 2u) {
+            CHECK(size == 0u);
+            CHECK(root_Smp_ForkSnapshot_GetExitStatus(snapshot, i) == -SIGKILL);
+        } else {
+            root_Smp_UInt64 sent = 0u;
+            CHECK(size == sizeof(sent));
+            memcpy(&sent, result, sizeof(sent));
+            CHECK(sent == i);
+            CHECK(root_Smp_ForkSnapshot_GetExitStatus(snapshot, i) == (root_Smp_Int32) (i % 7u));
+        }
+    }
+
+    /* Out of range branch, and Send outside of a branch */
+    CHECK(root_Smp_ForkSnapshot_GetResult(snapshot, BRANCH_COUNT + 1u) == NULL);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != NULL && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_Unknown);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_ForkSnapshot_Send(snapshot, &branch, sizeof(branch));
+    CHECK(root_Smp_ExceptionRecord_GetLast() != NULL && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_Unknown);
+    root_Smp_ExceptionRecord_Clear();
+
+    /* No descriptor left for the pipes: no branch runs and the failure is not taken for a child */
+    CHECK(getrlimit(RLIMIT_NOFILE, &limit) == 0);
+    lowered = limit;
+    lowered.rlim_cur = 3u;
+    CHECK(setrlimit(RLIMIT_NOFILE, &lowered) == 0);
+    CHECK(root_Smp_ForkSnapshot_Branch(snapshot, 2u) == UINT64_MAX);
+    CHECK(setrlimit(RLIMIT_NOFILE, &limit) == 0);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != NULL);
+    root_Smp_ExceptionRecord_Clear();
+
+    root_Smp_ForkSnapshot_Destroy(snapshot);
+    return CHECK_RESULT();
+}
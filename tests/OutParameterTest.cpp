@@ -0,0 +1,73 @@
+/**
+ * Out-parameter getters: values returned by value in C++ are written into
+ * an AnySimple constructed by the caller, and left as they were when the
+ * call fails.
+ */
+#include "Check.h"
+#include "Simulator.h"
+#include "Smp-C/AnySimple.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/IComponent.h"
+#include "Smp-C/ISimpleArrayField.h"
+#include "Smp-C/ISimpleField.h"
+
+namespace {
+
+using CWraPPer::StandIn::Model;
+using CWraPPer::StandIn::Simulator;
+
+const root_Smp_PrimitiveTypeKind float64Kind =
+    static_cast<root_Smp_PrimitiveTypeKind>(Smp::PrimitiveTypeKind::PTK_Float64);
+const root_Smp_PrimitiveTypeKind int64Kind =
+    static_cast<root_Smp_PrimitiveTypeKind>(Smp::PrimitiveTypeKind::PTK_Int64);
+
+void TestSimpleField() {
+    Simulator simulator;
+    simulator.Populate(1u, 1u, 0u, 0u);
+    Model *model = simulator.GetModels()[0];
+    model->GetStep()->Execute();
+    root_Smp_AnySimple value;
+    root_Smp_AnySimple_Construct(&value);
+    root_Smp_ISimpleField_GetValue(dynamic_cast<Smp::ISimpleField *>(model->GetField("F0")), &value);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    CHECK(root_Smp_AnySimple_GetType(&value) == float64Kind);
+    CHECK(root_Smp_AnySimple_operatorFloat64(&value) == 1.0);
+
+    /* The same value through the component, by name */
+    Smp::IComponent *component = model;
+    root_Smp_IComponent_GetSimpleValue(component, "Steps", &value);
+    CHECK(root_Smp_AnySimple_GetType(&value) == int64Kind);
+    CHECK(root_Smp_AnySimple_operatorInt64(&value) == 1);
+    root_Smp_IComponent_GetSimpleValue(component, "Missing", &value);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_AnySimple_GetType(&value) == int64Kind);
+    CHECK(root_Smp_AnySimple_operatorInt64(&value) == 1);
+    root_Smp_AnySimple__AnySimple(&value);
+}
+
+void TestSimpleArrayField() {
+    Simulator simulator;
+    simulator.Populate(1u, 0u, 1u, 4u);
+    Model *model = simulator.GetModels()[0];
+    Smp::ISimpleArrayField *field = dynamic_cast<Smp::ISimpleArrayField *>(model->GetField("A0"));
+    field->SetValue(2u, Smp::AnySimple(Smp::PrimitiveTypeKind::PTK_Float64, 6.5));
+    root_Smp_AnySimple value;
+    root_Smp_AnySimple_Construct(&value);
+    root_Smp_ISimpleArrayField_GetValue(field, 2u, &value);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    CHECK(root_Smp_AnySimple_operatorFloat64(&value) == 6.5);
+    root_Smp_ISimpleArrayField_GetValue(field, 4u, &value);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_AnySimple_operatorFloat64(&value) == 6.5);
+    root_Smp_AnySimple__AnySimple(&value);
+}
+
+} /* namespace */
+
+int main() {
+    TestSimpleField();
+    TestSimpleArrayField();
+    return CHECK_RESULT();
+}
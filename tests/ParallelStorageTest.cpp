@@ -0,0 +1,140 @@
+/**
+ * ParallelStorage: a simulation of thousands of nested models stored on
+ * a pool of threads comes back to the same state once restored,
+ * restoring from a file that is missing or lacks a component fails, and
+ * component paths must be unique both in the tree and in the file index.
+ */
+#include "Check.h"
+#include "Simulator.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/ParallelStorage.h"
+#include <Smp/IStorageWriter.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+using CWraPPer::StandIn::Model;
+using CWraPPer::StandIn::Simulator;
+
+/* Keeps what the models store, to compare whole states */
+class StringWriter final : public Smp::IStorageWriter {
+public:
+    void Store(const void *address, Smp::UInt64 size) override {
+        data.append(static_cast<const char *>(address), static_cast<std::size_t>(size));
+    }
+
+    Smp::String8 GetStateVectorFileName() const override {
+        return "";
+    }
+
+    Smp::String8 GetStateVectorFilePath() const override {
+        return "";
+    }
+
+    std::string data;
+};
+
+/* Appends the model and its children, depth first */
+void CollectModels(Model *model, std::vector<Model *> &models) {
+    models.push_back(model);
+    const Smp::ComponentCollection *children = model->GetContainer("Children")->GetComponents();
+    for (Smp::IComponent *child : *children) {
+        CollectModels(dynamic_cast<Model *>(child), models);
+    }
+}
+
+std::string State(const std::vector<Model *> &models) {
+    StringWriter writer;
+    for (Model *model : models) {
+        model->Store(&writer);
+    }
+    return writer.data;
+}
+
+void TestRoundTrip(Smp::UInt64 workerCount) {
+    Simulator simulator;
+    simulator.Populate(1000u, 10u, 2u, 16u, 2u);
+    std::vector<Model *> models;
+    for (Model *model : simulator.GetModels()) {
+        CollectModels(model, models);
+    }
+    for (std::size_t i = 0u; i < models.size(); i += 3u) {
+        models[i]->GetStep()->Execute();
+    }
+    const std::string stored = State(models);
+
+    root_Smp_ParallelStorage *storage = root_Smp_ParallelStorage_Create(workerCount);
+    Smp::ISimulator *smpSimulator = &simulator;
+    CHECK(root_Smp_ParallelStorage_Store(storage, smpSimulator, ".", "ParallelStorageTest.sv") == models.size());
+    for (Model *model : models) {
+        model->GetStep()->Execute();
+    }
+    CHECK(State(models) != stored);
+    CHECK(root_Smp_ParallelStorage_Restore(storage, smpSimulator, ".", "ParallelStorageTest.sv") == models.size());
+    CHECK(State(models) == stored);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+
+    /* A file lacking the segment of a new model */
+    simulator.AddOwnedModel(std::unique_ptr<Model>(new Model("Extra", "", &simulator, 1u, 0u, 0u)));
+    CHECK(root_Smp_ParallelStorage_Restore(storage, smpSimulator, ".", "ParallelStorageTest.sv") == 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_CannotRestore);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_ParallelStorage_Restore(storage, smpSimulator, ".", "missing.sv") == 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_CannotRestore);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_ParallelStorage_Destroy(storage);
+}
+
+/* Paths are joined with '/', so a name holding one can collide with a nested component */
+void TestDuplicatePaths() {
+    Simulator simulator;
+    simulator.Populate(2u, 1u, 0u, 0u, 1u);
+    simulator.AddOwnedModel(std::unique_ptr<Model>(new Model("M0/Children/C0", "", &simulator, 1u, 0u, 0u)));
+    root_Smp_ParallelStorage *storage = root_Smp_ParallelStorage_Create(0u);
+    Smp::ISimulator *smpSimulator = &simulator;
+    CHECK(root_Smp_ParallelStorage_Store(storage, smpSimulator, ".", "ParallelStorageTest.sv") == 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_CannotStore);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_ParallelStorage_Destroy(storage);
+}
+
+/* An index naming the same path twice is corrupted, even if the extra segment is never looked up */
+void TestDuplicateIndexEntry() {
+    Simulator stored;
+    stored.Populate(2u, 1u, 0u, 0u);
+    Simulator restored;
+    restored.Populate(1u, 1u, 0u, 0u);
+    root_Smp_ParallelStorage *storage = root_Smp_ParallelStorage_Create(0u);
+    CHECK(root_Smp_ParallelStorage_Store(storage, &stored, ".", "ParallelStorageTest.sv") == 2u);
+    CHECK(root_Smp_ParallelStorage_Restore(storage, &restored, ".", "ParallelStorageTest.sv") == 1u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+
+    /* The index ends with the path of M1: rename it M0 */
+    std::FILE *file = std::fopen("ParallelStorageTest.sv", "r+b");
+    CHECK(file != nullptr);
+    if (file != nullptr) {
+        std::fseek(file, -1L, SEEK_END);
+        std::fputc('0', file);
+        std::fclose(file);
+    }
+    CHECK(root_Smp_ParallelStorage_Restore(storage, &restored, ".", "ParallelStorageTest.sv") == 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_CannotRestore);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_ParallelStorage_Destroy(storage);
+}
+
+} /* namespace */
+
+int main() {
+    TestRoundTrip(0u);
+    TestRoundTrip(4u);
+    TestDuplicatePaths();
+    TestDuplicateIndexEntry();
+    return CHECK_RESULT();
+}
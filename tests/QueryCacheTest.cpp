@@ -0,0 +1,78 @@
+/**
+ * QueryCache: only the first query of a name on a service reaches it,
+ * whatever the buffer holding the name, from any thread, until Clear.
+ */
+#include "Check.h"
+#include "Services.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/Services/QueryCache.h"
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+using CWraPPer::StandIn::EventManager;
+using CWraPPer::StandIn::Logger;
+
+void TestLogMessageKind() {
+    root_Smp_Services_QueryCache_Clear();
+    Logger logger("Logger", "", nullptr);
+    Logger other("Other", "", nullptr);
+    const Smp::Services::LogMessageKind kind = logger.QueryLogMessageKind("Trace");
+    const std::uint64_t direct = logger.GetQueryCount();
+
+    CHECK(root_Smp_Services_QueryCache_QueryLogMessageKind(&logger, "Trace") == kind);
+    CHECK(root_Smp_Services_QueryCache_QueryLogMessageKind(&logger, "Trace") == kind);
+    CHECK(logger.GetQueryCount() == direct + 1u);
+
+    /* Same content in another buffer, then other content in the same buffer */
+    char name[16];
+    std::strcpy(name, "Trace");
+    CHECK(root_Smp_Services_QueryCache_QueryLogMessageKind(&logger, name) == kind);
+    CHECK(logger.GetQueryCount() == direct + 1u);
+    std::strcpy(name, "Audit");
+    const Smp::Services::LogMessageKind audit = root_Smp_Services_QueryCache_QueryLogMessageKind(&logger, name);
+    CHECK(audit != kind);
+    CHECK(logger.GetQueryCount() == direct + 2u);
+
+    /* Another service gets its own ids */
+    root_Smp_Services_QueryCache_QueryLogMessageKind(&other, "Trace");
+    CHECK(other.GetQueryCount() == 1u);
+
+    root_Smp_Services_QueryCache_Clear();
+    CHECK(root_Smp_Services_QueryCache_QueryLogMessageKind(&logger, "Trace") == kind);
+    CHECK(logger.GetQueryCount() == direct + 3u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+void TestEventId() {
+    root_Smp_Services_QueryCache_Clear();
+    EventManager eventManager("EventManager", "", nullptr);
+    const Smp::Services::EventId id = root_Smp_Services_QueryCache_QueryEventId(&eventManager, "Tick");
+    CHECK(id == eventManager.QueryEventId("Tick"));
+    CHECK(eventManager.GetQueryCount() == 2u);
+
+    /* Another thread finds the id cached by this one */
+    Smp::Services::EventId seen = -1;
+    std::thread([&] { seen = root_Smp_Services_QueryCache_QueryEventId(&eventManager, "Tick"); }).join();
+    CHECK(seen == id);
+    CHECK(eventManager.GetQueryCount() == 2u);
+
+    /* Clear also drops what the other threads cached */
+    root_Smp_Services_QueryCache_Clear();
+    std::thread([&] { seen = root_Smp_Services_QueryCache_QueryEventId(&eventManager, "Tick"); }).join();
+    CHECK(seen == id);
+    CHECK(eventManager.GetQueryCount() == 3u);
+    CHECK(root_Smp_Services_QueryCache_QueryEventId(&eventManager, "Tick") == id);
+    CHECK(eventManager.GetQueryCount() == 3u);
+    root_Smp_Services_QueryCache_Clear();
+}
+
+} /* namespace */
+
+int main() {
+    TestLogMessageKind();
+    TestEventId();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,153 @@
+/**
+ * RingLogger: records of several threads reach the text log in the order
+ * of each thread, with the simulation time and the sender path, and a
+ * binary log decodes to the text of its deferred formats. The rings of
+ * exited threads are written out before they are dropped.
+ */
+#include "Check.h"
+#include "Simulator.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/ISimulator.h"
+#include "Smp-C/Services/ILogger.h"
+#include "Smp-C/Services/RingLogger.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using CWraPPer::StandIn::Simulator;
+
+std::vector<std::string> ReadLines(const char *fileName) {
+    std::ifstream file(fileName);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+bool EndsWith(const std::string &text, const std::string &end) {
+    return text.size() >= end.size() && text.compare(text.size() - end.size(), end.size(), end) == 0;
+}
+
+void TestTextLog() {
+    Simulator simulator;
+    simulator.Populate(4u, 1u, 0u, 0u);
+    root_Smp_Services_RingLogger *ringLogger = root_Smp_Services_RingLogger_Create(
+        "RingLogger", "", static_cast<Smp::IObject *>(&simulator), "RingLoggerTest.log", 0u, false);
+    CHECK(ringLogger != nullptr);
+    root_Smp_ISimulator_AddService(
+        static_cast<Smp::ISimulator *>(&simulator), root_Smp_Services_RingLogger_GetService(ringLogger));
+    simulator.Connect();
+    simulator.GetStandInScheduler()->Advance(1500000000);
+    root_Smp_Services_ILogger *logger = root_Smp_Services_RingLogger_GetLogger(ringLogger);
+    const root_Smp_Services_LogMessageKind custom = root_Smp_Services_ILogger_QueryLogMessageKind(logger, "Custom");
+    CHECK(custom == 5);
+    CHECK(root_Smp_Services_ILogger_QueryLogMessageKind(logger, "Warning") == 2);
+
+    const int threadCount = 4;
+    const int recordCount = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&, t]() {
+            const Smp::IObject *sender = simulator.GetModels()[static_cast<std::size_t>(t)];
+            for (int i = 0; i < recordCount; ++i) {
+                const std::string message = "T" + std::to_string(t) + " " + std::to_string(i);
+                root_Smp_Services_ILogger_Log(logger, sender, message.c_str(), custom);
+                if (i % 256 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    root_Smp_Services_RingLogger_Flush(ringLogger);
+    const std::uint64_t dropped = root_Smp_Services_RingLogger_GetDroppedCount(ringLogger);
+    root_Smp_Services_RingLogger_Destroy(ringLogger);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+
+    const std::vector<std::string> lines = ReadLines("RingLoggerTest.log");
+    CHECK(lines.size() + dropped == static_cast<std::size_t>(threadCount * recordCount));
+    std::vector<int> next(threadCount, 0);
+    std::size_t wellFormed = 0u;
+    for (const std::string &line : lines) {
+        int thread = -1;
+        int index = -1;
+        const std::size_t message = line.rfind(": T");
+        if (line.compare(0u, 21u, "[Custom] 1.500000000 ") != 0 || message == std::string::npos
+            || std::sscanf(line.c_str() + message, ": T%d %d", &thread, &index) != 2
+            || thread < 0 || thread >= threadCount
+            || !EndsWith(line.substr(0u, message), "Models/M" + std::to_string(thread))) {
+            continue;
+        }
+        /* Dropped records leave gaps, never reorder */
+        if (index >= next[static_cast<std::size_t>(thread)]) {
+            next[static_cast<std::size_t>(thread)] = index + 1;
+            ++wellFormed;
+        }
+    }
+    CHECK(wellFormed == lines.size());
+}
+
+void TestBinaryLog() {
+    root_Smp_Services_RingLogger *ringLogger = root_Smp_Services_RingLogger_Create(
+        "RingLogger", "", nullptr, "RingLoggerTest.bin", 0u, true);
+    root_Smp_Services_ILogger *logger = root_Smp_Services_RingLogger_GetLogger(ringLogger);
+    const Smp::UInt32 format = root_Smp_Services_RingLogger_RegisterFormat(ringLogger, "x=%d y=%.2f s=%s %%");
+    CHECK(format != 0u);
+    for (int i = 0; i < 100; ++i) {
+        root_Smp_Services_RingLogger_LogFormat(ringLogger, nullptr, 1, format, i, i / 4.0, "text");
+    }
+    root_Smp_Services_ILogger_Log(logger, nullptr, "plain", 3);
+    root_Smp_Services_RingLogger_LogFormat(ringLogger, nullptr, 1, 0u, 1);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_Services_RingLogger_RegisterFormat(ringLogger, "%n") == 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_Services_RingLogger_Destroy(ringLogger);
+
+    CHECK(root_Smp_Services_RingLogger_Decode("RingLoggerTest.bin", "RingLoggerTest.txt") == 101u);
+    const std::vector<std::string> lines = ReadLines("RingLoggerTest.txt");
+    CHECK(lines.size() == 101u);
+    if (lines.size() == 101u) {
+        CHECK(lines[6] == "[Event] 0.000000000 : x=6 y=1.50 s=text %");
+        CHECK(lines[100] == "[Error] 0.000000000 : plain");
+    }
+    CHECK(root_Smp_Services_RingLogger_Decode("missing.bin", "RingLoggerTest.txt") == 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+}
+
+void TestExitedThreads() {
+    root_Smp_Services_RingLogger *ringLogger = root_Smp_Services_RingLogger_Create(
+        "RingLogger", "", nullptr, "RingLoggerThreads.log", 0u, false);
+    root_Smp_Services_ILogger *logger = root_Smp_Services_RingLogger_GetLogger(ringLogger);
+    const int threadCount = 200;
+    for (int t = 0; t < threadCount; ++t) {
+        std::thread([&]() { root_Smp_Services_ILogger_Log(logger, nullptr, "exiting", 0); }).join();
+        if (t % 50 == 0) {
+            root_Smp_Services_RingLogger_Flush(ringLogger);
+        }
+    }
+    root_Smp_Services_RingLogger_Flush(ringLogger);
+    CHECK(root_Smp_Services_RingLogger_GetDroppedCount(ringLogger) == 0u);
+    root_Smp_Services_RingLogger_Destroy(ringLogger);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    CHECK(ReadLines("RingLoggerThreads.log").size() == static_cast<std::size_t>(threadCount));
+}
+
+} /* namespace */
+
+int main() {
+    TestTextLog();
+    TestBinaryLog();
+    TestExitedThreads();
+    return CHECK_RESULT();
+}
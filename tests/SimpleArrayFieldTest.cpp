@@ -0,0 +1,55 @@
+/**
+ * ISimpleArrayField typed thunks: values of the field's own kind are
+ * copied as they are, in and out, with the range checks of GetValues and
+ * SetValues, and read back the same through AnySimple.
+ */
+#include "Check.h"
+#include "Fields.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/ISimpleArrayField.h"
+#include <vector>
+
+namespace {
+
+using CWraPPer::StandIn::SimpleArrayField;
+
+void TestSameKind() {
+    SimpleArrayField field("Array", "", nullptr, Smp::PrimitiveTypeKind::PTK_Float64, 600u);
+    std::vector<double> in(600u);
+    for (std::size_t i = 0u; i < in.size(); ++i) {
+        in[i] = 0.5 * static_cast<double>(i);
+    }
+    root_Smp_ISimpleArrayField_SetValuesFloat64(&field, 500u, in.data(), 100u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    CHECK(static_cast<double>(field.GetValue(100u)) == 0.0);
+    CHECK(static_cast<double>(field.GetValue(599u)) == 0.5 * 499.0);
+
+    std::vector<double> out(500u, -1.0);
+    root_Smp_ISimpleArrayField_GetValuesFloat64(&field, 500u, out.data(), 100u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    bool same = true;
+    for (std::size_t i = 0u; i < out.size(); ++i) {
+        same = same && out[i] == in[i];
+    }
+    CHECK(same);
+}
+
+void TestOutOfRange() {
+    SimpleArrayField field("Array", "", nullptr, Smp::PrimitiveTypeKind::PTK_Int32, 8u);
+    std::vector<Smp::Int32> values(8u, 7);
+    root_Smp_ISimpleArrayField_SetValuesInt32(&field, 8u, values.data(), 1u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(static_cast<Smp::Int32>(field.GetValue(7u)) == 0);
+    root_Smp_ISimpleArrayField_GetValuesInt32(&field, 9u, values.data(), 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+}
+
+} /* namespace */
+
+int main() {
+    TestSameKind();
+    TestOutOfRange();
+    return CHECK_RESULT();
+}
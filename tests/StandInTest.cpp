@@ -0,0 +1,116 @@
+/**
+ * Stand-in simulator: the scheduler runs its events in time then
+ * insertion order, the event manager, logger, resolver and link registry
+ * behave as the SMP interfaces describe, and Store/Restore round trip the
+ * model state.
+ */
+#include "Check.h"
+#include "Simulator.h"
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using CWraPPer::StandIn::EntryPoint;
+using CWraPPer::StandIn::Model;
+using CWraPPer::StandIn::Simulator;
+
+const Smp::Duration millisecond = 1000000;
+
+void TestPopulate() {
+    Simulator simulator;
+    simulator.Populate(3u, 2u, 1u, 4u, 1u);
+    CHECK(simulator.GetModels().size() == 3u);
+    Smp::IObject *models = simulator.GetChild("Models");
+    CHECK(models != nullptr);
+    CHECK(models->GetChild("M1") == simulator.GetModels()[1]);
+    CHECK(simulator.GetModels()[0]->GetField("F1") != nullptr);
+    CHECK(simulator.GetModels()[0]->GetField("A0") != nullptr);
+    CHECK(simulator.GetModels()[0]->GetField("Steps") != nullptr);
+}
+
+void TestSchedulerOrder() {
+    Simulator simulator;
+    simulator.Connect();
+    std::vector<int> log;
+    EntryPoint first("First", "", nullptr, [&log]() { log.push_back(0); });
+    EntryPoint second("Second", "", nullptr, [&log]() { log.push_back(1); });
+    EntryPoint third("Third", "", nullptr, [&log]() { log.push_back(2); });
+    Smp::Services::IScheduler *scheduler = simulator.GetScheduler();
+    scheduler->AddSimulationTimeEvent(&first, 2 * millisecond, 0, 0);
+    scheduler->AddSimulationTimeEvent(&second, millisecond, 0, 0);
+    scheduler->AddSimulationTimeEvent(&third, millisecond, 0, 0);
+    CHECK(scheduler->GetNextScheduledEventTime() == millisecond);
+    CHECK(simulator.GetStandInScheduler()->Advance(2 * millisecond) == 3u);
+    CHECK((log == std::vector<int>{1, 2, 0}));
+    CHECK(simulator.GetTimeKeeper()->GetSimulationTime() == 2 * millisecond);
+}
+
+void TestEventManager() {
+    Simulator simulator;
+    simulator.Populate(1u, 0u, 0u, 0u);
+    Smp::Services::IEventManager *eventManager = simulator.GetEventManager();
+    const Smp::Services::EventId event = eventManager->QueryEventId("Custom");
+    CHECK(eventManager->QueryEventId("Custom") == event);
+    CHECK(eventManager->QueryEventId("Other") != event);
+    Model *model = simulator.GetModels()[0];
+    eventManager->Subscribe(event, model->GetStep());
+    eventManager->Emit(event, false);
+    eventManager->Emit(event, false);
+    CHECK(model->GetStepCount() == 2);
+    eventManager->Unsubscribe(event, model->GetStep());
+    eventManager->Emit(event, false);
+    CHECK(model->GetStepCount() == 2);
+}
+
+void TestLoggerResolverLinks() {
+    Simulator simulator;
+    simulator.Populate(2u, 1u, 0u, 0u);
+    Smp::Services::ILogger *logger = simulator.GetLogger();
+    const Smp::Services::LogMessageKind warning = logger->QueryLogMessageKind("Warning");
+    logger->Log(&simulator, "Careful", warning);
+    CHECK(simulator.GetStandInLogger()->GetCount(warning) == 1u);
+
+    Model *model = simulator.GetModels()[1];
+    Smp::Services::IResolver *resolver = simulator.GetResolver();
+    CHECK(resolver->ResolveAbsolute("Models/M1") == model);
+    CHECK(resolver->ResolveRelative("../M0", model) == simulator.GetModels()[0]);
+    CHECK(resolver->ResolveAbsolute("Models/M9") == nullptr);
+
+    Smp::Services::ILinkRegistry *links = simulator.GetLinkRegistry();
+    links->AddLink(simulator.GetModels()[0], model);
+    links->AddLink(simulator.GetModels()[0], model);
+    CHECK(links->GetLinkCount(simulator.GetModels()[0], model) == 2u);
+    CHECK(links->GetLinkSources(model)->size() == 1u);
+    CHECK(links->RemoveLink(simulator.GetModels()[0], model));
+    CHECK(links->RemoveLink(simulator.GetModels()[0], model));
+    CHECK(!links->RemoveLink(simulator.GetModels()[0], model));
+    CHECK(links->GetLinkSources(model)->size() == 0u);
+}
+
+void TestStoreRestore() {
+    Simulator simulator;
+    simulator.Populate(2u, 1u, 1u, 4u);
+    simulator.Connect();
+    Model *model = simulator.GetModels()[0];
+    model->GetStep()->Execute();
+    simulator.Store("StandInTest.sav");
+    model->GetStep()->Execute();
+    model->GetStep()->Execute();
+    CHECK(model->GetStepCount() == 3);
+    simulator.Restore("StandInTest.sav");
+    CHECK(model->GetStepCount() == 1);
+    CHECK(simulator.GetState() == Smp::SimulatorStateKind::SSK_Standby);
+    std::remove("StandInTest.sav");
+}
+
+} /* namespace */
+
+int main() {
+    TestPopulate();
+    TestSchedulerOrder();
+    TestEventManager();
+    TestLoggerResolverLinks();
+    TestStoreRestore();
+    return CHECK_RESULT();
+}
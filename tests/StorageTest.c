@@ -0,0 +1,265 @@
+/**
+ * State vector storage codecs, from C: mapped, delta and compressed
+ * writers and readers round trip a state stored in blocks of many sizes.
+ */
+#include "Check.h"
+#include "Smp-C/CompressedStorageReader.h"
+#include "Smp-C/CompressedStorageWriter.h"
+#include "Smp-C/DeltaStorageReader.h"
+#include "Smp-C/DeltaStorageWriter.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/IStorageReader.h"
+#include "Smp-C/IStorageWriter.h"
+#include "Smp-C/MappedStorageReader.h"
+#include "Smp-C/MappedStorageWriter.h"
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#define STATE_SIZE (3u << 20u)
+
+static unsigned char state[STATE_SIZE];
+static unsigned char restored[STATE_SIZE];
+
+/* Half random, half repeated bytes, so that the compression has work on both */
+static void Fill(unsigned seed) {
+    size_t i;
+    srand(seed);
+    for (i = 0u; i < STATE_SIZE; ++i) {
+        state[i] = (i / 4096u) % 2u == 0u ? (unsigned char) rand() : (unsigned char) (i / 4096u);
+    }
+}
+
+/* Stores the state in blocks of 1 to 20000 bytes, as models of various sizes would */
+static void StoreState(root_Smp_IStorageWriter *writer) {
+    size_t position = 0u;
+    size_t size = 1u;
+    while (position < STATE_SIZE) {
+        if (size > STATE_SIZE - position) {
+            size = STATE_SIZE - position;
+        }
+        root_Smp_IStorageWriter_Store(writer, state + position, size);
+        position += size;
+        size = size * 7u % 20000u + 1u;
+    }
+}
+
+static void RestoreState(root_Smp_IStorageReader *reader) {
+    size_t position = 0u;
+    size_t size = 1u;
+    memset(restored, 0, sizeof(restored));
+    while (position < STATE_SIZE) {
+        if (size > STATE_SIZE - position) {
+            size = STATE_SIZE - position;
+        }
+        root_Smp_IStorageReader_Restore(reader, restored + position, size);
+        position += size;
+        size = size * 7u % 20000u + 1u;
+    }
+}
+
+static int LastKindIs(root_Smp_ExceptionKind kind) {
+    const root_Smp_ExceptionRecord *record = root_Smp_ExceptionRecord_GetLast();
+    const int matches = record != NULL && record->kind == kind;
+    root_Smp_ExceptionRecord_Clear();
+    return matches;
+}
+
+static struct rlimit fileSizeLimit;
+
+/* Files cannot grow past size bytes until RestoreFileSizeLimit; writing past it fails instead of raising SIGXFSZ */
+static void LowerFileSizeLimit(rlim_t size) {
+    struct rlimit lowered;
+    CHECK(getrlimit(RLIMIT_FSIZE, &fileSizeLimit) == 0);
+    lowered = fileSizeLimit;
+    lowered.rlim_cur = size;
+    signal(SIGXFSZ, SIG_IGN);
+    CHECK(setrlimit(RLIMIT_FSIZE, &lowered) == 0);
+}
+
+static void RestoreFileSizeLimit(void) {
+    CHECK(setrlimit(RLIMIT_FSIZE, &fileSizeLimit) == 0);
+    signal(SIGXFSZ, SIG_DFL);
+}
+
+static void TestMapped(void) {
+    root_Smp_MappedStorageWriter *writer;
+    root_Smp_IStorageWriter *storageWriter;
+    root_Smp_MappedStorageReader *reader;
+    unsigned char extra = 0u;
+
+    Fill(1u);
+    /* A small capacity makes the writer grow the file many times */
+    writer = root_Smp_MappedStorageWriter_Create(".", "Mapped.sv", 4096u);
+    CHECK(writer != NULL);
+    StoreState(root_Smp_MappedStorageWriter_GetStorageWriter(writer));
+    CHECK(root_Smp_MappedStorageWriter_GetSize(writer) == STATE_SIZE);
+    root_Smp_MappedStorageWriter_Destroy(writer);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+
+    reader = root_Smp_MappedStorageReader_Create(".", "Mapped.sv");
+    CHECK(reader != NULL);
+    CHECK(root_Smp_MappedStorageReader_GetSize(reader) == STATE_SIZE);
+    RestoreState(root_Smp_MappedStorageReader_GetStorageReader(reader));
+    CHECK(memcmp(state, restored, STATE_SIZE) == 0);
+    CHECK(root_Smp_MappedStorageReader_GetPosition(reader) == STATE_SIZE);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+    root_Smp_IStorageReader_Restore(root_Smp_MappedStorageReader_GetStorageReader(reader), &extra, 1u);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotRestore));
+    root_Smp_MappedStorageReader_Destroy(reader);
+
+    CHECK(root_Smp_MappedStorageReader_Create(".", "Missing.sv") == NULL);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_Unknown));
+
+    /* A store the file cannot grow for fails alone, the file keeps what was stored before and after */
+    writer = root_Smp_MappedStorageWriter_Create(".", "Mapped.sv", 4096u);
+    storageWriter = root_Smp_MappedStorageWriter_GetStorageWriter(writer);
+    root_Smp_IStorageWriter_Store(storageWriter, state, STATE_SIZE / 2u);
+    root_Smp_IStorageWriter_Store(storageWriter, state, (root_Smp_UInt64) 1u << 62u);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    root_Smp_IStorageWriter_Store(storageWriter, state, ~(root_Smp_UInt64) 0u);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    root_Smp_IStorageWriter_Store(storageWriter, state + STATE_SIZE / 2u, STATE_SIZE - STATE_SIZE / 2u);
+    CHECK(root_Smp_MappedStorageWriter_GetSize(writer) == STATE_SIZE);
+    root_Smp_MappedStorageWriter_Destroy(writer);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+    reader = root_Smp_MappedStorageReader_Create(".", "Mapped.sv");
+    RestoreState(root_Smp_MappedStorageReader_GetStorageReader(reader));
+    CHECK(memcmp(state, restored, STATE_SIZE) == 0);
+    root_Smp_MappedStorageReader_Destroy(reader);
+}
+
+static void TestDelta(void) {
+    root_Smp_DeltaStorageWriter *writer;
+    root_Smp_DeltaStorageReader *reader;
+    unsigned char full[STATE_SIZE];
+
+    Fill(2u);
+    writer = root_Smp_DeltaStorageWriter_Create(".", "Delta0.sv", NULL, 0u);
+    CHECK(writer != NULL);
+    StoreState(root_Smp_DeltaStorageWriter_GetStorageWriter(writer));
+    CHECK(root_Smp_DeltaStorageWriter_GetStoredSize(writer) == STATE_SIZE);
+    CHECK(root_Smp_DeltaStorageWriter_GetWrittenSize(writer) == STATE_SIZE);
+    root_Smp_DeltaStorageWriter_Destroy(writer);
+    memcpy(full, state, STATE_SIZE);
+
+    /* Two changed bytes: the second breakpoint only writes the chunks holding them */
+    state[10u] ^= 0xFFu;
+    state[STATE_SIZE - 10u] ^= 0xFFu;
+    writer = root_Smp_DeltaStorageWriter_Create(".", "Delta1.sv", "Delta0.sv", 0u);
+    CHECK(writer != NULL);
+    StoreState(root_Smp_DeltaStorageWriter_GetStorageWriter(writer));
+    CHECK(root_Smp_DeltaStorageWriter_GetStoredSize(writer) == STATE_SIZE);
+    CHECK(root_Smp_DeltaStorageWriter_GetWrittenSize(writer) > 0u);
+    CHECK(root_Smp_DeltaStorageWriter_GetWrittenSize(writer) <= 2u * 16384u);
+    root_Smp_DeltaStorageWriter_Destroy(writer);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+
+    reader = root_Smp_DeltaStorageReader_Create(".", "Delta1.sv");
+    CHECK(reader != NULL);
+    CHECK(root_Smp_DeltaStorageReader_GetSize(reader) == STATE_SIZE);
+    RestoreState(root_Smp_DeltaStorageReader_GetStorageReader(reader));
+    CHECK(memcmp(state, restored, STATE_SIZE) == 0);
+    root_Smp_DeltaStorageReader_Destroy(reader);
+
+    reader = root_Smp_DeltaStorageReader_Create(".", "Delta0.sv");
+    CHECK(reader != NULL);
+    RestoreState(root_Smp_DeltaStorageReader_GetStorageReader(reader));
+    CHECK(memcmp(full, restored, STATE_SIZE) == 0);
+    root_Smp_DeltaStorageReader_Destroy(reader);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+
+    /* Writing over a file of the chain would destroy the chunks it is based on */
+    CHECK(root_Smp_DeltaStorageWriter_Create(".", "Delta1.sv", "Delta1.sv", 0u) == NULL);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    CHECK(root_Smp_DeltaStorageWriter_Create(".", "Delta0.sv", "Delta1.sv", 0u) == NULL);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    reader = root_Smp_DeltaStorageReader_Create(".", "Delta1.sv");
+    CHECK(reader != NULL);
+    RestoreState(root_Smp_DeltaStorageReader_GetStorageReader(reader));
+    CHECK(memcmp(state, restored, STATE_SIZE) == 0);
+    root_Smp_DeltaStorageReader_Destroy(reader);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+
+    /* A file size limit below the state: the failed Store fails the rest and no manifest is written */
+    LowerFileSizeLimit(STATE_SIZE / 2u);
+    writer = root_Smp_DeltaStorageWriter_Create(".", "DeltaFailed.sv", NULL, 0u);
+    CHECK(writer != NULL);
+    root_Smp_IStorageWriter_Store(root_Smp_DeltaStorageWriter_GetStorageWriter(writer), state, STATE_SIZE);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    root_Smp_IStorageWriter_Store(root_Smp_DeltaStorageWriter_GetStorageWriter(writer), state, 16u);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    root_Smp_DeltaStorageWriter_Destroy(writer);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    RestoreFileSizeLimit();
+    CHECK(root_Smp_DeltaStorageReader_Create(".", "DeltaFailed.sv") == NULL);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != NULL);
+    root_Smp_ExceptionRecord_Clear();
+}
+
+static void TestCompressed(root_Smp_UInt64 workerCount) {
+    root_Smp_CompressedStorageWriter *writer;
+    root_Smp_CompressedStorageReader *reader;
+    root_Smp_IStorageReader *storageReader;
+    const root_Smp_UInt64 blockSize = 65536u;
+    size_t i;
+
+    Fill(3u);
+    writer = root_Smp_CompressedStorageWriter_Create(".", "Compressed.sv", blockSize, workerCount);
+    CHECK(writer != NULL);
+    StoreState(root_Smp_CompressedStorageWriter_GetStorageWriter(writer));
+    CHECK(root_Smp_CompressedStorageWriter_GetStoredSize(writer) == STATE_SIZE);
+    root_Smp_CompressedStorageWriter_Destroy(writer);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+
+    reader = root_Smp_CompressedStorageReader_Create(".", "Compressed.sv", workerCount);
+    CHECK(reader != NULL);
+    CHECK(root_Smp_CompressedStorageReader_GetSize(reader) == STATE_SIZE);
+    CHECK(root_Smp_CompressedStorageReader_GetBlockSize(reader) == blockSize);
+    CHECK(root_Smp_CompressedStorageReader_GetBlockCount(reader) == STATE_SIZE / blockSize);
+    storageReader = root_Smp_CompressedStorageReader_GetStorageReader(reader);
+    RestoreState(storageReader);
+    CHECK(memcmp(state, restored, STATE_SIZE) == 0);
+
+    /* Seek back to block 3 and restore it alone */
+    root_Smp_CompressedStorageReader_Seek(reader, 3u);
+    CHECK(root_Smp_CompressedStorageReader_GetPosition(reader) == 3u * blockSize);
+    root_Smp_IStorageReader_Restore(storageReader, restored, blockSize);
+    CHECK(memcmp(state + 3u * blockSize, restored, blockSize) == 0);
+    root_Smp_CompressedStorageReader_Seek(reader, STATE_SIZE / blockSize + 1u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != NULL);
+    root_Smp_ExceptionRecord_Clear();
+    root_Smp_CompressedStorageReader_Destroy(reader);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+
+    /* Sizes and positions in a block are 32 bits */
+    CHECK(root_Smp_CompressedStorageWriter_Create(".", "Compressed.sv", (root_Smp_UInt64) 1u << 32u, workerCount)
+        == NULL);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+
+    /* A block that cannot be written fails every later Store and Destroy, and no index is written */
+    LowerFileSizeLimit(blockSize);
+    writer = root_Smp_CompressedStorageWriter_Create(".", "CompressedFailed.sv", blockSize, workerCount);
+    CHECK(writer != NULL);
+    for (i = 0u; i < STATE_SIZE / blockSize && root_Smp_ExceptionRecord_GetLast() == NULL; ++i) {
+        root_Smp_IStorageWriter_Store(root_Smp_CompressedStorageWriter_GetStorageWriter(writer), state, blockSize);
+    }
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    root_Smp_IStorageWriter_Store(root_Smp_CompressedStorageWriter_GetStorageWriter(writer), state, blockSize);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    root_Smp_CompressedStorageWriter_Destroy(writer);
+    CHECK(LastKindIs(root_Smp_ExceptionKind_CannotStore));
+    RestoreFileSizeLimit();
+    CHECK(root_Smp_CompressedStorageReader_Create(".", "CompressedFailed.sv", workerCount) == NULL);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != NULL);
+    root_Smp_ExceptionRecord_Clear();
+}
+
+int main(void) {
+    TestMapped();
+    TestDelta();
+    TestCompressed(0u);
+    TestCompressed(3u);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,251 @@
+/**
+ * TimingWheelScheduler, through the IScheduler wrappers: the events of a
+ * large random schedule run in the same order as on the stand-in
+ * scheduler, cyclic events repeat, errors are reported, the stand-in
+ * scheduler takes a batch at once, and independent events run on the
+ * worker pool.
+ */
+#include "Check.h"
+#include "Simulator.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/ISimulator.h"
+#include "Smp-C/Services/BatchScheduler.h"
+#include "Smp-C/Services/IScheduler.h"
+#include "Smp-C/Services/TimingWheelScheduler.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using CWraPPer::StandIn::EntryPoint;
+using CWraPPer::StandIn::Simulator;
+
+const Smp::Duration millisecond = 1000000;
+
+struct Fixture {
+    Simulator simulator;
+    root_Smp_Services_TimingWheelScheduler *wheel;
+    root_Smp_Services_IScheduler *scheduler;
+
+    Fixture() :
+        wheel(root_Smp_Services_TimingWheelScheduler_Create("Wheel", "", static_cast<Smp::IObject *>(&simulator), 0)),
+        scheduler(root_Smp_Services_TimingWheelScheduler_GetScheduler(wheel)) {
+        root_Smp_ISimulator_AddService(
+            static_cast<Smp::ISimulator *>(&simulator),
+            root_Smp_Services_TimingWheelScheduler_GetService(wheel));
+        root_Smp_ISimulator_Connect(static_cast<Smp::ISimulator *>(&simulator));
+    }
+
+    ~Fixture() {
+        root_Smp_Services_TimingWheelScheduler_Destroy(wheel);
+    }
+};
+
+/* Entry points appending their index to a log */
+std::vector<std::unique_ptr<EntryPoint>> MakeEntryPoints(std::size_t count, std::vector<std::size_t> &log) {
+    std::vector<std::unique_ptr<EntryPoint>> entryPoints;
+    for (std::size_t i = 0u; i < count; ++i) {
+        entryPoints.emplace_back(new EntryPoint("Record", "", nullptr, [i, &log]() { log.push_back(i); }));
+    }
+    return entryPoints;
+}
+
+/* Same random schedule on the wheel and on the stand-in scheduler, spread over several wheel levels */
+void TestSameOrderAsStandIn() {
+    Fixture fixture;
+    Simulator reference;
+    reference.Connect();
+    std::vector<std::size_t> wheelLog;
+    std::vector<std::size_t> referenceLog;
+    const std::size_t count = 20000u;
+    std::vector<std::unique_ptr<EntryPoint>> wheelEntryPoints = MakeEntryPoints(count, wheelLog);
+    std::vector<std::unique_ptr<EntryPoint>> referenceEntryPoints = MakeEntryPoints(count, referenceLog);
+    std::mt19937_64 random(42u);
+    std::vector<root_Smp_Services_SimulationTimeEvent> events(count);
+    for (std::size_t i = 0u; i < count; ++i) {
+        /* Few distinct times, so that many events share a tick or a time */
+        const Smp::Duration time = static_cast<Smp::Duration>(random() % 5000u) * (millisecond / 2)
+            * static_cast<Smp::Duration>(1u + random() % 3u);
+        events[i] = {static_cast<const Smp::IEntryPoint *>(wheelEntryPoints[i].get()), time, 0, 0};
+        reference.GetScheduler()->AddSimulationTimeEvent(referenceEntryPoints[i].get(), time);
+    }
+    std::vector<root_Smp_Services_EventId> ids(count);
+    CHECK(root_Smp_Services_IScheduler_AddSimulationTimeEvents(fixture.scheduler, count, events.data(), ids.data())
+        == count);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+
+    std::uint64_t executed = 0u;
+    for (Smp::Duration time = 0; time <= 8000 * millisecond; time += 37 * millisecond) {
+        executed += root_Smp_Services_TimingWheelScheduler_Advance(fixture.wheel, time);
+        reference.GetStandInScheduler()->Advance(time);
+        CHECK(fixture.simulator.GetTimeKeeper()->GetSimulationTime() == time);
+    }
+    CHECK(executed == count);
+    CHECK(wheelLog == referenceLog);
+    CHECK(root_Smp_Services_IScheduler_GetNextScheduledEventTime(fixture.scheduler) == -1);
+}
+
+void TestCyclicEvents() {
+    Fixture fixture;
+    std::vector<std::size_t> log;
+    std::vector<std::unique_ptr<EntryPoint>> entryPoints = MakeEntryPoints(2u, log);
+    const root_Smp_Services_EventId cyclic = root_Smp_Services_IScheduler_AddSimulationTimeEvent(
+        fixture.scheduler, entryPoints[0].get(), 10 * millisecond, 10 * millisecond, 4);
+    const root_Smp_Services_EventId forever = root_Smp_Services_IScheduler_AddSimulationTimeEvent(
+        fixture.scheduler, entryPoints[1].get(), 0, 25 * millisecond, -1);
+    CHECK(root_Smp_Services_TimingWheelScheduler_Advance(fixture.wheel, 100 * millisecond) == 5u + 5u);
+    CHECK(!root_Smp_Services_IScheduler_IsEventScheduled(fixture.scheduler, cyclic));
+    CHECK(root_Smp_Services_IScheduler_IsEventScheduled(fixture.scheduler, forever));
+    CHECK(root_Smp_Services_IScheduler_GetNextScheduledEventTime(fixture.scheduler) == 125 * millisecond);
+    root_Smp_Services_IScheduler_RemoveEvent(fixture.scheduler, forever);
+    CHECK(!root_Smp_Services_IScheduler_IsEventScheduled(fixture.scheduler, forever));
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+void TestErrors() {
+    Fixture fixture;
+    std::vector<std::size_t> log;
+    std::vector<std::unique_ptr<EntryPoint>> entryPoints = MakeEntryPoints(1u, log);
+    root_Smp_Services_IScheduler_RemoveEvent(fixture.scheduler, 12345);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_InvalidEventId);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_Services_IScheduler_AddSimulationTimeEvent(fixture.scheduler, entryPoints[0].get(), -1, 0, 0) == 0);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_InvalidEventTime);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_Services_IScheduler_AddSimulationTimeEvent(fixture.scheduler, entryPoints[0].get(), 0, 0, 3) == 0);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_InvalidCycleTime);
+    root_Smp_ExceptionRecord_Clear();
+
+    /* A batch stops at its first invalid event, keeping the ones before */
+    const Smp::IEntryPoint *entryPoint = entryPoints[0].get();
+    const root_Smp_Services_SimulationTimeEvent events[3] = {
+        {entryPoint, millisecond, 0, 0}, {entryPoint, -1, 0, 0}, {entryPoint, millisecond, 0, 0}};
+    root_Smp_Services_EventId ids[3] = {0, 0, 0};
+    CHECK(root_Smp_Services_IScheduler_AddSimulationTimeEvents(fixture.scheduler, 3u, events, ids) == 1u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr
+        && root_Smp_ExceptionRecord_GetLast()->kind == root_Smp_ExceptionKind_InvalidEventTime);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_Services_IScheduler_IsEventScheduled(fixture.scheduler, ids[0]));
+    CHECK(root_Smp_Services_TimingWheelScheduler_Advance(fixture.wheel, millisecond) == 1u);
+}
+
+/* The stand-in scheduler takes a batch in one heapify, in the same order as one event at a time */
+void TestStandInBatch() {
+    Simulator batched;
+    Simulator reference;
+    batched.Connect();
+    reference.Connect();
+    root_Smp_Services_IScheduler *scheduler = batched.GetScheduler();
+    CHECK(dynamic_cast<CWraPPer::BatchScheduler *>(batched.GetScheduler()) != nullptr);
+    std::vector<std::size_t> batchedLog;
+    std::vector<std::size_t> referenceLog;
+    const std::size_t count = 5000u;
+    std::vector<std::unique_ptr<EntryPoint>> batchedEntryPoints = MakeEntryPoints(count, batchedLog);
+    std::vector<std::unique_ptr<EntryPoint>> referenceEntryPoints = MakeEntryPoints(count, referenceLog);
+    std::mt19937_64 random(7u);
+    std::vector<root_Smp_Services_SimulationTimeEvent> events(count);
+    for (std::size_t i = 0u; i < count; ++i) {
+        const Smp::Duration time = static_cast<Smp::Duration>(random() % 100u) * millisecond;
+        events[i] = {static_cast<const Smp::IEntryPoint *>(batchedEntryPoints[i].get()), time, 0, 0};
+        reference.GetScheduler()->AddSimulationTimeEvent(referenceEntryPoints[i].get(), time);
+    }
+    std::vector<root_Smp_Services_EventId> ids(count);
+    CHECK(root_Smp_Services_IScheduler_AddSimulationTimeEvents(scheduler, count, events.data(), ids.data()) == count);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+    CHECK(batched.GetStandInScheduler()->Advance(100 * millisecond) == count);
+    reference.GetStandInScheduler()->Advance(100 * millisecond);
+    CHECK(batchedLog == referenceLog);
+
+    /* A failed batch keeps, and still orders, the events before the invalid one */
+    events[0].simulationTime = 2 * millisecond;
+    events[1].simulationTime = millisecond;
+    events[2].simulationTime = -1;
+    CHECK(root_Smp_Services_IScheduler_AddSimulationTimeEvents(scheduler, 3u, events.data(), ids.data()) == 2u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() != nullptr);
+    root_Smp_ExceptionRecord_Clear();
+    CHECK(root_Smp_Services_IScheduler_GetNextScheduledEventTime(scheduler) == 101 * millisecond);
+    CHECK(batched.GetStandInScheduler()->Advance(102 * millisecond) == 2u);
+}
+
+/* Independent events of the same time run on every thread, the others one by one in between */
+void TestIndependentEvents() {
+    Fixture fixture;
+    root_Smp_Services_TimingWheelScheduler_SetWorkerCount(fixture.wheel, 3u);
+    const std::size_t count = 4000u;
+    std::atomic<std::size_t> runs(0u);
+    std::atomic<std::size_t> wrongIds(0u);
+    std::vector<root_Smp_Services_EventId> ids(count);
+    std::vector<std::unique_ptr<EntryPoint>> entryPoints;
+    std::vector<std::thread::id> threads(count);
+    for (std::size_t i = 0u; i < count; ++i) {
+        entryPoints.emplace_back(new EntryPoint("Work", "", nullptr, [&, i]() {
+            if (root_Smp_Services_IScheduler_GetCurrentEventId(fixture.scheduler) != ids[i]) {
+                ++wrongIds;
+            }
+            threads[i] = std::this_thread::get_id();
+            volatile double sink = 0.0;
+            for (int k = 0; k < 2000; ++k) {
+                sink = sink + k;
+            }
+            ++runs;
+        }));
+    }
+    for (std::size_t i = 0u; i < count; ++i) {
+        ids[i] = root_Smp_Services_IScheduler_AddSimulationTimeEvent(
+            fixture.scheduler, entryPoints[i].get(), static_cast<Smp::Duration>(i % 4u) * millisecond, 0, 0);
+        root_Smp_Services_TimingWheelScheduler_SetEventIndependent(fixture.wheel, ids[i], i % 100u != 0u);
+    }
+    CHECK(root_Smp_Services_TimingWheelScheduler_Advance(fixture.wheel, 10 * millisecond) == count);
+    CHECK(runs.load() == count);
+    CHECK(wrongIds.load() == 0u);
+    std::size_t otherThreads = 0u;
+    for (const std::thread::id &thread : threads) {
+        otherThreads += thread != std::this_thread::get_id() ? 1u : 0u;
+    }
+    CHECK(otherThreads > 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+/* The pool is not replaced while a group of independent events runs on it */
+void TestWorkerCountDuringGroup() {
+    Fixture fixture;
+    root_Smp_Services_TimingWheelScheduler_SetWorkerCount(fixture.wheel, 2u);
+    const std::size_t count = 64u;
+    std::atomic<std::size_t> refused(0u);
+    std::vector<std::unique_ptr<EntryPoint>> entryPoints;
+    for (std::size_t i = 0u; i < count; ++i) {
+        entryPoints.emplace_back(new EntryPoint("Resize", "", nullptr, [&]() {
+            root_Smp_Services_TimingWheelScheduler_SetWorkerCount(fixture.wheel, 0u);
+            if (root_Smp_ExceptionRecord_GetLast() != nullptr) {
+                ++refused;
+                root_Smp_ExceptionRecord_Clear();
+            }
+        }));
+        const root_Smp_Services_EventId id = root_Smp_Services_IScheduler_AddSimulationTimeEvent(
+            fixture.scheduler, entryPoints[i].get(), millisecond, 0, 0);
+        root_Smp_Services_TimingWheelScheduler_SetEventIndependent(fixture.wheel, id, true);
+    }
+    CHECK(root_Smp_Services_TimingWheelScheduler_Advance(fixture.wheel, 2 * millisecond) == count);
+    CHECK(refused.load() == count);
+    root_Smp_Services_TimingWheelScheduler_SetWorkerCount(fixture.wheel, 0u);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == nullptr);
+}
+
+} /* namespace */
+
+int main() {
+    TestSameOrderAsStandIn();
+    TestCyclicEvents();
+    TestErrors();
+    TestStandInBatch();
+    TestIndependentEvents();
+    TestWorkerCountDuringGroup();
+    return CHECK_RESULT();
+}
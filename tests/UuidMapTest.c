@@ -0,0 +1,107 @@
+/**
+ * Uuid and UuidMap, from C: Parse and Format round trip the canonical
+ * form, and the map keeps finding every key while others are removed
+ * around it.
+ */
+#include "Check.h"
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/Uuid.h"
+#include "Smp-C/UuidMap.h"
+#include <string.h>
+
+#define KEY_COUNT 1000u
+
+static root_Smp_Uuid keys[KEY_COUNT];
+static int values[KEY_COUNT];
+
+static void TestParseFormat(void) {
+    root_Smp_Uuid uuid;
+    root_Smp_Uuid upper;
+    char text[root_Smp_Uuid_StringLength];
+    CHECK(root_Smp_Uuid_Parse(&uuid, "0123abcd-4567-89ef-fedc-ba9876543210"));
+    CHECK(uuid.Data1 == 0x0123abcdu);
+    CHECK(uuid.Data2[0] == 0x4567u && uuid.Data2[1] == 0x89efu && uuid.Data2[2] == 0xfedcu);
+    CHECK(uuid.Data3[0] == 0xbau && uuid.Data3[5] == 0x10u);
+    root_Smp_Uuid_Format(&uuid, text);
+    CHECK(strcmp(text, "0123abcd-4567-89ef-fedc-ba9876543210") == 0);
+
+    CHECK(root_Smp_Uuid_Parse(&upper, "0123ABCD-4567-89EF-FEDC-BA9876543210"));
+    CHECK(root_Smp_Uuid_Equals(&uuid, &upper));
+    CHECK(root_Smp_Uuid_Hash(&uuid) == root_Smp_Uuid_Hash(&upper));
+
+    /* A rejected text leaves the Uuid as it was */
+    CHECK(!root_Smp_Uuid_Parse(&upper, "0123abcd-4567-89ef-fedc-ba987654321"));
+    CHECK(!root_Smp_Uuid_Parse(&upper, "0123abcd-4567-89ef-fedc-ba98765432100"));
+    CHECK(!root_Smp_Uuid_Parse(&upper, "0123abcd_4567-89ef-fedc-ba9876543210"));
+    CHECK(!root_Smp_Uuid_Parse(&upper, "0123abcg-4567-89ef-fedc-ba9876543210"));
+    CHECK(!root_Smp_Uuid_Parse(&upper, NULL));
+    CHECK(root_Smp_Uuid_Equals(&uuid, &upper));
+
+    upper.Data3[5] = 0x11u;
+    CHECK(root_Smp_Uuid_Compare(&uuid, &upper) < 0);
+    CHECK(root_Smp_Uuid_Compare(&upper, &uuid) > 0);
+}
+
+/* Keys differing in a single field, so that many of them share a probe sequence */
+static void MakeKeys(void) {
+    unsigned i;
+    for (i = 0u; i < KEY_COUNT; ++i) {
+        memset(&keys[i], 0, sizeof(keys[i]));
+        keys[i].Data1 = 0x5eed0000u;
+        keys[i].Data2[2] = (uint16_t) i;
+        values[i] = (int) i;
+    }
+}
+
+static void TestInsertFindRemove(void) {
+    unsigned i;
+    int found = 1;
+    root_Smp_UuidMap *map = root_Smp_UuidMap_Create(0u);
+    MakeKeys();
+    for (i = 0u; i < KEY_COUNT; ++i) {
+        found = found && root_Smp_UuidMap_Insert(map, &keys[i], &values[i]);
+    }
+    CHECK(found);
+    CHECK(root_Smp_UuidMap_GetCount(map) == KEY_COUNT);
+    CHECK(!root_Smp_UuidMap_Insert(map, &keys[7], &values[8]));
+    CHECK(root_Smp_UuidMap_Find(map, &keys[7]) == &values[8]);
+    CHECK(!root_Smp_UuidMap_Insert(map, &keys[7], &values[7]));
+    CHECK(root_Smp_UuidMap_GetCount(map) == KEY_COUNT);
+
+    /* Every removal shifts the following keys back: the others must stay reachable */
+    for (i = 0u; i < KEY_COUNT; i += 3u) {
+        CHECK(root_Smp_UuidMap_Remove(map, &keys[i]));
+    }
+    CHECK(!root_Smp_UuidMap_Remove(map, &keys[0]));
+    for (i = 0u; i < KEY_COUNT; ++i) {
+        void *expected = i % 3u == 0u ? NULL : &values[i];
+        found = found && root_Smp_UuidMap_Find(map, &keys[i]) == expected;
+    }
+    CHECK(found);
+    CHECK(root_Smp_UuidMap_GetCount(map) == KEY_COUNT - (KEY_COUNT + 2u) / 3u);
+
+    /* Removed keys can come back */
+    for (i = 0u; i < KEY_COUNT; i += 3u) {
+        found = found && root_Smp_UuidMap_Insert(map, &keys[i], &values[i]);
+    }
+    for (i = 0u; i < KEY_COUNT; ++i) {
+        found = found && root_Smp_UuidMap_Find(map, &keys[i]) == &values[i];
+    }
+    CHECK(found);
+    CHECK(root_Smp_UuidMap_GetCount(map) == KEY_COUNT);
+
+    for (i = 0u; i < KEY_COUNT; ++i) {
+        found = found && root_Smp_UuidMap_Remove(map, &keys[i]);
+    }
+    CHECK(found);
+    CHECK(root_Smp_UuidMap_GetCount(map) == 0u);
+    CHECK(root_Smp_UuidMap_Find(map, &keys[1]) == NULL);
+    CHECK(root_Smp_ExceptionRecord_GetLast() == NULL);
+    root_Smp_UuidMap_Destroy(map);
+}
+
+int main(void) {
+    TestParseFormat();
+    TestInsertFindRemove();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,74 @@
+/**
+ * WorkStealingPool: every job of a batch runs exactly once, on any thread,
+ * and Run returns once the whole batch is done, batch after batch.
+ */
+#include "Check.h"
+#include "WorkStealingPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void TestEveryJobOnce(std::size_t threadCount) {
+    CWraPPer::WorkStealingPool pool(threadCount);
+    CHECK(pool.GetThreadCount() == threadCount);
+    for (std::size_t count : {0u, 1u, 2u, 7u, 1000u, 100000u}) {
+        std::vector<std::atomic<int>> runs(count);
+        pool.Run(count, [&runs](std::size_t i) {
+            runs[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        bool once = true;
+        for (const std::atomic<int> &run : runs) {
+            once = once && run.load() == 1;
+        }
+        CHECK(once);
+    }
+}
+
+/* Uneven jobs: the threads that finish early steal from the others */
+void TestStealing() {
+    CWraPPer::WorkStealingPool pool(3u);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<std::size_t> done(0u);
+    pool.Run(64u, [&](std::size_t i) {
+        if (i < 8u) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        }
+        ++done;
+    });
+    CHECK(done.load() == 64u);
+    CHECK(threads.size() > 1u);
+}
+
+/* Many small batches in a row, as the scheduler does for each time step */
+void TestBatches() {
+    CWraPPer::WorkStealingPool pool(4u);
+    std::atomic<long> sum(0);
+    for (int batch = 0; batch < 2000; ++batch) {
+        pool.Run(16u, [&sum](std::size_t i) {
+            sum += static_cast<long>(i);
+        });
+    }
+    CHECK(sum.load() == 2000L * 120L);
+}
+
+} /* namespace */
+
+int main() {
+    TestEveryJobOnce(0u);
+    TestEveryJobOnce(1u);
+    TestEveryJobOnce(4u);
+    TestStealing();
+    TestBatches();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,26 @@
+/**
+ * Turns a binary RingLogger log into its text form.
+ *
+ * Usage: RingLogDecode <binary log> <text file>
+ */
+#include "Smp-C/ExceptionRecord.h"
+#include "Smp-C/Services/RingLogger.h"
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+    root_Smp_UInt64 count;
+    const root_Smp_ExceptionRecord *failure;
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <binary log> <text file>\n", argv[0]);
+        return 2;
+    }
+    root_Smp_ExceptionRecord_Clear();
+    count = root_Smp_Services_RingLogger_Decode(argv[1], argv[2]);
+    failure = root_Smp_ExceptionRecord_GetLast();
+    if (failure != NULL) {
+        fprintf(stderr, "%s: %s: %s\n", argv[0], failure->name, failure->message);
+        return 1;
+    }
+    printf("%llu records\n", (unsigned long long) count);
+    return 0;
+}